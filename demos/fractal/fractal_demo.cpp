@@ -1,26 +1,12 @@
 #include "fractal_demo.hpp"
 
-#include <cassert>
-#include <cmath>
-#include <future>
-#include <thread>
-#include <utility>
-#include <vector>
-
 #include <termox/termox.hpp>
 
-#include "float_t.hpp"
-#include "julia.hpp"
-#include "mandelbrot.hpp"
+#include "fractal_view.hpp"
+#include "tile_renderer.hpp"
 
 namespace {
 
-using fractal::Float_t;
-
-auto constexpr zoom_scale = 0.05;
-
-auto constexpr default_boundary = ox::Boundary<Float_t>{-2, 2, 2, -2};
-
 using ox::Color;
 using ox::RGB;
 
@@ -67,92 +53,6 @@ auto const custom_palette = ox::Palette{
     {Color{90}, RGB{0x3e0055}},       {Color{91}, RGB{0x330154}},
     {Color{92}, RGB{0x270252}},       {Color{93}, RGB{0x180450}}};
 
-/// Adds the given offset in each direction to the given boundary.
-[[nodiscard]] auto apply_offsets(ox::Boundary<Float_t> boundary,
-                                 ox::Boundary<Float_t> const& offsets)
-    -> ox::Boundary<Float_t>
-{
-    boundary.west += offsets.west;
-    boundary.east += offsets.east;
-    boundary.north += offsets.north;
-    boundary.south += offsets.south;
-    return boundary;
-}
-
-/// Given a fractal function for a single point, will generate a field of points
-template <typename Fn>
-[[nodiscard]] auto generate_points(ox::Boundary<Float_t> boundary,
-                                   Float_t x_step,
-                                   Float_t y_step,
-                                   unsigned int resolution,
-                                   Fn&& generator)
-    -> std::vector<std::pair<ox::Color_graph<Float_t>::Coordinate, ox::Color>>
-{
-    auto result = std::vector<
-        std::pair<ox::Color_graph<Float_t>::Coordinate, ox::Color>>{};
-    auto const count = ((boundary.east - boundary.west) / x_step) *
-                       ((boundary.north - boundary.south) / y_step);
-    result.reserve(count);
-    for (auto x = boundary.west; x <= boundary.east; x += x_step) {
-        for (auto y = boundary.south; y <= boundary.north; y += y_step) {
-            result.push_back(
-                {{x, y},
-                 ox::Color(
-                     ((std::forward<Fn>(generator)(x, y, resolution) - 1) %
-                      (custom_palette.size() - 2)) +
-                     16)});
-        }
-    }
-    return result;
-}
-
-/// Generates a field of fractal values in parallel, depending on hardward cores
-template <typename Fn>
-[[nodiscard]] auto par_generate_points(ox::Boundary<Float_t> boundary,
-                                       Float_t x_step,
-                                       Float_t y_step,
-                                       unsigned int resolution,
-                                       Fn&& generator)
-    -> std::vector<std::pair<ox::Color_graph<Float_t>::Coordinate, ox::Color>>
-{
-    auto result = std::vector<
-        std::pair<ox::Color_graph<Float_t>::Coordinate, ox::Color>>{};
-    auto const count = ((boundary.east - boundary.west) / x_step) *
-                       ((boundary.north - boundary.south) / y_step);
-    result.reserve(count);
-
-    // Break Into Chunks
-    auto const thread_count = std::thread::hardware_concurrency();
-    auto const chunk_distance =
-        (boundary.east - boundary.west) / (double)thread_count;
-    auto boundaries = std::vector<ox::Boundary<Float_t>>{};
-    boundaries.reserve(thread_count);
-    for (auto i = 0uL; i < thread_count; ++i) {
-        auto b = boundary;
-        b.west = b.west + (i * chunk_distance);
-        b.east = b.west + chunk_distance;
-        boundaries.push_back(b);
-    }
-
-    // Launch Threads
-    auto futs = std::vector<std::future<std::vector<
-        std::pair<ox::Color_graph<Float_t>::Coordinate, ox::Color>>>>{};
-    futs.reserve(thread_count);
-    for (auto const& b : boundaries) {
-        futs.push_back(std::async(std::launch::async, [=] {
-            return generate_points(b, x_step, y_step, resolution, generator);
-        }));
-    }
-
-    // Wait and Concat Results
-    for (auto& f : futs) {
-        auto points = f.get();
-        result.insert(std::end(result), std::begin(points), std::end(points));
-    }
-
-    return result;
-}
-
 [[nodiscard]] auto make_instructions() -> ox::Glyph_string
 {
     using ox::Trait;
@@ -227,9 +127,9 @@ Instructions::Instructions() : ox::Text_view{make_instructions()}
 }
 
 Fractal_demo::Fractal_demo()
-    : ox::VPair<Top_bar, ox::SPair<ox::Color_graph<Float_t>, Instructions>>{
+    : ox::VPair<Top_bar, ox::SPair<Fractal_view, Instructions>>{
           {},
-          {{{-2, 2, 2, -2}}, {}}}
+          {{(int)custom_palette.size() - 2}, {}}}
 {
     using namespace ox::pipe;
 
@@ -249,7 +149,7 @@ Fractal_demo::Fractal_demo()
 
     top_bar.fractal_changed.connect([this](auto type) {
         fractal_type_ = type;
-        this->reset();
+        graph.set_fractal(type);
     });
 
     graph.mouse_moved.connect([this](auto const& m) {
@@ -258,177 +158,31 @@ Fractal_demo::Fractal_demo()
         auto const b  = graph.boundary();
         auto const hr = ((b.east - b.west) / (double)graph.area().width);
         auto const vr = ((b.north - b.south) / (double)graph.area().height);
-        julia_c_.real(b.west + (m.at.x * hr));
-        julia_c_.imag(b.south + (m.at.y * vr));
-        this->reset();
+        graph.set_julia_c({b.west + (m.at.x * hr), b.south + (m.at.y * vr)});
     });
 
     graph.key_pressed.connect([this](auto k) {
         switch (k) {
-            case ox::Key::Arrow_right:
-                this->increment_h_offset(+1);
-                this->reset();
-                break;
-            case ox::Key::Arrow_left:
-                this->increment_h_offset(-1);
-                this->reset();
-                break;
-            case ox::Key::Arrow_up:
-                this->increment_v_offset(+1);
-                this->reset();
-                break;
-            case ox::Key::Arrow_down:
-                this->increment_v_offset(-1);
-                this->reset();
-                break;
+            case ox::Key::Arrow_right: graph.pan(+1, 0); break;
+            case ox::Key::Arrow_left: graph.pan(-1, 0); break;
+            case ox::Key::Arrow_up: graph.pan(0, +1); break;
+            case ox::Key::Arrow_down: graph.pan(0, -1); break;
             default: break;
         }
         // If statements to get around switch warning, not in enum.
         if (k == (ox::Mod::Ctrl | ox::Key::Arrow_up))
-            this->zoom_in();
+            graph.zoom(+2);
         else if (k == (ox::Mod::Ctrl | ox::Key::Arrow_down))
-            this->zoom_out();
+            graph.zoom(-2);
     });
 
     graph.mouse_wheel_scrolled.connect([this](auto m) {
         switch (m.button) {
-            case ox::Mouse::Button::ScrollUp: this->zoom_in_at(m.at); break;
-            case ox::Mouse::Button::ScrollDown: this->zoom_out_at(m.at); break;
+            case ox::Mouse::Button::ScrollUp: graph.zoom_at(m.at, +1); break;
+            case ox::Mouse::Button::ScrollDown: graph.zoom_at(m.at, -1); break;
             default: break;
         }
     });
-
-    graph | on_resize([this](auto, auto) { this->reset(); });
-    graph | on_enable([this] { this->reset(); });
-
-    this->reset(default_boundary);
-}
-
-void Fractal_demo::reset(ox::Boundary<Float_t> b)
-{
-    if (graph.area().height == 0 || graph.area().width == 0)
-        return;
-    graph.set_boundary(b);
-
-    auto const x_interval =
-        Float_t(b.east - b.west) / (graph.area().width * 1.001);
-    auto const y_interval =
-        Float_t(b.north - b.south) / (graph.area().height * 2.001);
-
-    auto const distance   = b.east - b.west;
-    auto const resolution = std::clamp((int)std::log(1. / distance), 1, 8) *
-                            (custom_palette.size() - 2);
-
-    switch (fractal_type_) {
-        case Fractal::Mandelbrot:
-            graph.reset(par_generate_points(b, x_interval, y_interval,
-                                            resolution, mandelbrot));
-            break;
-        case Fractal::Julia:
-            graph.reset(
-                par_generate_points(b, x_interval, y_interval, resolution,
-                                    [&](auto x, auto y, auto mi) {
-                                        return julia(x, y, julia_c_, mi);
-                                    }));
-            break;
-    }
-}
-
-void Fractal_demo::reset()
-{
-    this->reset(apply_offsets(default_boundary, offsets_));
-}
-
-void Fractal_demo::increment_h_offset(int direction)
-{
-    assert(direction == 1 || direction == -1);
-    auto constexpr fraction = (Float_t)1. / (Float_t)25.;
-
-    auto const b      = graph.boundary();
-    auto const amount = direction * (b.east - b.west) * fraction;
-    offsets_.west += amount;
-    offsets_.east += amount;
-}
-
-void Fractal_demo::increment_v_offset(int direction)
-{
-    assert(direction == 1 || direction == -1);
-    auto constexpr fraction = (Float_t)1. / (Float_t)25.;
-
-    auto const b      = graph.boundary();
-    auto const amount = direction * (b.north - b.south) * fraction;
-    offsets_.north += amount;
-    offsets_.south += amount;
-}
-
-void Fractal_demo::zoom_in()
-{
-    auto const b          = graph.boundary();
-    auto const h_distance = (b.east - b.west);
-    auto const v_distance = (b.north - b.south);
-
-    offsets_.west += h_distance * zoom_scale;
-    offsets_.east -= h_distance * zoom_scale;
-    offsets_.north -= v_distance * zoom_scale;
-    offsets_.south += v_distance * zoom_scale;
-
-    this->reset();
-}
-
-void Fractal_demo::zoom_in_at(ox::Point p)
-{
-    auto const b = graph.boundary();
-
-    // Horizontal
-    auto const h_distance = b.east - b.west;
-    auto const h_ratio    = h_distance / graph.area().width;
-    auto const h_coord    = h_ratio * p.x;
-    offsets_.west += h_coord * zoom_scale;
-    offsets_.east -= (h_distance - h_coord) * zoom_scale;
-
-    // Vertical
-    auto const v_distance = b.north - b.south;
-    auto const v_ratio    = v_distance / graph.area().height;
-    auto const v_coord    = v_ratio * (graph.area().height - p.y);
-    offsets_.south += v_coord * zoom_scale;
-    offsets_.north -= (v_distance - v_coord) * zoom_scale;
-
-    this->reset();
-}
-
-void Fractal_demo::zoom_out()
-{
-    auto const b          = graph.boundary();
-    auto const h_distance = (b.east - b.west);
-    auto const v_distance = (b.north - b.south);
-
-    offsets_.west -= h_distance * zoom_scale;
-    offsets_.east += h_distance * zoom_scale;
-    offsets_.north += v_distance * zoom_scale;
-    offsets_.south -= v_distance * zoom_scale;
-
-    this->reset();
-}
-
-void Fractal_demo::zoom_out_at(ox::Point p)
-{
-    auto const b = graph.boundary();
-
-    // Horizontal
-    auto const h_distance = b.east - b.west;
-    auto const h_ratio    = h_distance / graph.area().width;
-    auto const h_coord    = h_ratio * p.x;
-    offsets_.west -= h_coord * zoom_scale;
-    offsets_.east += (h_distance - h_coord) * zoom_scale;
-
-    // Vertical
-    auto const v_distance = b.north - b.south;
-    auto const v_ratio    = v_distance / graph.area().height;
-    auto const v_coord    = v_ratio * (graph.area().height - p.y);
-    offsets_.south -= v_coord * zoom_scale;
-    offsets_.north += (v_distance - v_coord) * zoom_scale;
-
-    this->reset();
 }
 
 }  // namespace fractal
@@ -0,0 +1,163 @@
+#include "fractal_view.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <complex>
+#include <cstddef>
+
+#include <termox/common/fps.hpp>
+#include <termox/painter/color.hpp>
+#include <termox/painter/glyph.hpp>
+#include <termox/painter/painter.hpp>
+#include <termox/widget/area.hpp>
+#include <termox/widget/boundary.hpp>
+#include <termox/widget/point.hpp>
+#include <termox/widget/widget.hpp>
+
+#include "float_t.hpp"
+#include "tile_renderer.hpp"
+
+namespace fractal {
+
+Fractal_view::Fractal_view(int color_count) : color_count_{color_count} {}
+
+Fractal_view::Fractal_view(Parameters p) : Fractal_view{p.color_count} {}
+
+void Fractal_view::set_fractal(Fractal type)
+{
+    type_ = type;
+    this->request();
+}
+
+void Fractal_view::set_julia_c(std::complex<Float_t> c)
+{
+    julia_c_ = c;
+    this->request();
+}
+
+void Fractal_view::pan(int h, int v)
+{
+    auto const view = this->view();
+    left_ += h * std::max(1, view.width / 25);
+    top_ -= v * std::max(1, view.height / 25);
+    this->request();
+}
+
+void Fractal_view::zoom_at(ox::Point p, int levels)
+{
+    auto const zoom = std::clamp(zoom_ + levels, min_zoom, max_zoom);
+    if (zoom == zoom_)
+        return;
+
+    // Pixel coordinates scale by the ratio of pixel sizes between levels.
+    auto const ratio =
+        std::pow(Tile_renderer::zoom_factor, (Float_t)(zoom_ - zoom));
+    auto const x = (Float_t)p.x;
+    auto const y = (Float_t)p.y * 2;
+    left_        = std::llround((left_ + x) * ratio - x);
+    top_         = std::llround((top_ + y) * ratio - y);
+    zoom_        = zoom;
+    this->request();
+}
+
+void Fractal_view::zoom(int levels)
+{
+    this->zoom_at({this->area().width / 2, this->area().height / 2}, levels);
+}
+
+void Fractal_view::reset_view()
+{
+    auto const view = this->view();
+    zoom_           = 0;
+    left_           = -view.width / 2;
+    top_            = -view.height / 2;
+    this->request();
+}
+
+auto Fractal_view::boundary() const -> ox::Boundary<Float_t>
+{
+    auto const view = this->view();
+    auto const size = renderer_.pixel_size(zoom_);
+    return {left_ * size.real(), (left_ + view.width) * size.real(),
+            -top_ * size.imag(), -(top_ + view.height) * size.imag()};
+}
+
+auto Fractal_view::paint_event(ox::Painter& p) -> bool
+{
+    auto const area = this->area();
+    if (area.width == 0 || area.height == 0)
+        return Widget::paint_event(p);
+    renderer_.paint_to(zoom_, this->view(), pixels_);
+    auto const width = (std::size_t)area.width;
+    for (auto y = 0; y < area.height; ++y) {
+        auto const top    = (std::size_t)y * 2 * width;
+        auto const bottom = top + width;
+        for (auto x = 0; x < area.width; ++x) {
+            p.put(U'▀' | fg(pixels_[top + x]) | bg(pixels_[bottom + x]),
+                  {x, y});
+        }
+    }
+    return Widget::paint_event(p);
+}
+
+auto Fractal_view::timer_event() -> bool
+{
+    // Checked first, so the updates of a job that just finished are painted.
+    auto const is_busy = renderer_.is_busy();
+    if (renderer_.take_updates())
+        this->update();
+    if (!is_busy)
+        this->disable_animation();
+    return Widget::timer_event();
+}
+
+auto Fractal_view::resize_event(ox::Area new_size, ox::Area old_size) -> bool
+{
+    // Keep the complex plane point at the center of the view in place.
+    auto const old_pixel = renderer_.pixel_size(zoom_);
+    auto const center_x  = (left_ + old_size.width / 2.L) * old_pixel.real();
+    auto const center_y  = (top_ + (Float_t)old_size.height) * old_pixel.imag();
+    renderer_.set_scene(this->scene());
+    auto const pixel = renderer_.pixel_size(zoom_);
+    left_ = std::llround(center_x / pixel.real() - new_size.width / 2.L);
+    top_  = std::llround(center_y / pixel.imag() - (Float_t)new_size.height);
+    this->request();
+    return Widget::resize_event(new_size, old_size);
+}
+
+auto Fractal_view::enable_event() -> bool
+{
+    this->request();
+    return Widget::enable_event();
+}
+
+auto Fractal_view::view() const -> Pixel_rect
+{
+    auto const area = this->area();
+    return {left_, top_, area.width, area.height * 2};
+}
+
+auto Fractal_view::scene() const -> Scene
+{
+    auto result        = Scene{};
+    result.type        = type_;
+    result.julia_c     = julia_c_;
+    result.width       = this->area().width;
+    result.height      = this->area().height * 2;
+    result.color_count = color_count_;
+    return result;
+}
+
+void Fractal_view::request()
+{
+    auto const view = this->view();
+    if (view.width == 0 || view.height == 0)
+        return;
+    renderer_.set_scene(this->scene());
+    renderer_.request(zoom_, view);
+    if (!this->is_animated())
+        this->enable_animation(ox::FPS{30});
+    this->update();
+}
+
+}  // namespace fractal
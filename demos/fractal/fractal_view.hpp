@@ -0,0 +1,96 @@
+#ifndef TERMOX_DEMOS_FRACTAL_FRACTAL_VIEW_HPP
+#define TERMOX_DEMOS_FRACTAL_FRACTAL_VIEW_HPP
+#include <complex>
+#include <cstdint>
+#include <vector>
+
+#include <termox/painter/color.hpp>
+#include <termox/painter/painter.hpp>
+#include <termox/widget/area.hpp>
+#include <termox/widget/boundary.hpp>
+#include <termox/widget/point.hpp>
+#include <termox/widget/widget.hpp>
+
+#include "float_t.hpp"
+#include "tile_renderer.hpp"
+
+namespace fractal {
+
+/// Displays a fractal from a Tile_renderer, two pixels per cell.
+/** The view is a pixel rectangle at a zoom level, moving it only requests the
+ *  tiles that are not cached yet. Rendering happens in the background, the
+ *  view repaints on its animation timer while passes are finishing. */
+class Fractal_view : public ox::Widget {
+   public:
+    /// Zoom levels are clamped to this range, past it long double runs out.
+    static constexpr auto min_zoom = -20;
+    static constexpr auto max_zoom = 700;
+
+    struct Parameters {
+        int color_count = 1;
+    };
+
+   public:
+    /// Fractal colors are Color{16} up to, not including, Color{16 + count}.
+    explicit Fractal_view(int color_count = 1);
+
+    explicit Fractal_view(Parameters p);
+
+   public:
+    /// Display \p type, keeping the current view.
+    void set_fractal(Fractal type);
+
+    /// Set the constant used by the Julia set.
+    void set_julia_c(std::complex<Float_t> c);
+
+    /// Move the view by a fraction of its size in each direction.
+    /** Positive \p h moves right, positive \p v moves up. */
+    void pan(int h, int v);
+
+    /// Zoom in by \p levels, negative zooms out, keeping \p p in place.
+    void zoom_at(ox::Point p, int levels);
+
+    /// Zoom in by \p levels, negative zooms out, keeping the center in place.
+    void zoom(int levels);
+
+    /// Return to zoom level zero, centered on the origin.
+    void reset_view();
+
+    /// Return the complex plane region currently displayed.
+    [[nodiscard]] auto boundary() const -> ox::Boundary<Float_t>;
+
+   protected:
+    auto paint_event(ox::Painter& p) -> bool override;
+
+    auto timer_event() -> bool override;
+
+    auto resize_event(ox::Area new_size, ox::Area old_size) -> bool override;
+
+    auto enable_event() -> bool override;
+
+   private:
+    Tile_renderer renderer_;
+    Fractal type_                  = Fractal::Mandelbrot;
+    std::complex<Float_t> julia_c_ = {-0.79, 0.15};
+    int color_count_;
+
+    // Top left pixel of the view, at zoom_.
+    int zoom_          = 0;
+    std::int64_t left_ = 0;
+    std::int64_t top_  = 0;
+
+    std::vector<ox::Color> pixels_;
+
+   private:
+    /// Return the pixel rectangle currently displayed.
+    [[nodiscard]] auto view() const -> Pixel_rect;
+
+    /// Return the Scene for the current fractal and size.
+    [[nodiscard]] auto scene() const -> Scene;
+
+    /// Update the Scene and request the visible tiles.
+    void request();
+};
+
+}  // namespace fractal
+#endif  // TERMOX_DEMOS_FRACTAL_FRACTAL_VIEW_HPP
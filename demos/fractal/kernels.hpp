@@ -0,0 +1,186 @@
+#ifndef TERMOX_DEMOS_FRACTAL_KERNELS_HPP
+#define TERMOX_DEMOS_FRACTAL_KERNELS_HPP
+#include <complex>
+#include <cstddef>
+#include <cstdint>
+#include <type_traits>
+
+#include "float_t.hpp"
+#include "julia.hpp"
+#include "mandelbrot.hpp"
+
+namespace fractal {
+
+/// Floating point type the iteration kernels run in.
+enum class Precision { Float, Double, Long_double };
+
+/// Return the cheapest Precision that resolves neighboring pixels.
+/** \p pixel_size is the complex plane distance between pixels. Points are at
+ *  most about 2 from the origin, each tier is used while a pixel is still
+ *  several hundred units in the last place, so rounding in the iteration does
+ *  not show until deep into the fractal boundary. */
+[[nodiscard]] inline auto precision_for(Float_t pixel_size) -> Precision
+{
+    if (pixel_size >= (Float_t)1 / (1 << 14))
+        return Precision::Float;
+    if (pixel_size >= (Float_t)1 / (std::uint64_t{1} << 43))
+        return Precision::Double;
+    return Precision::Long_double;
+}
+
+namespace detail {
+
+#if defined(__GNUC__)
+
+/// Register width, wider vectors are split up and run slower than these.
+#if defined(__AVX__)
+inline constexpr auto vector_bytes = 32;
+#else
+inline constexpr auto vector_bytes = 16;
+#endif
+
+template <typename T>
+struct Lanes;
+
+template <>
+struct Lanes<float> {
+    static constexpr auto size = vector_bytes / (int)sizeof(float);
+    typedef float Vector __attribute__((vector_size(vector_bytes)));
+    typedef std::int32_t Mask __attribute__((vector_size(vector_bytes)));
+};
+
+template <>
+struct Lanes<double> {
+    static constexpr auto size = vector_bytes / (int)sizeof(double);
+    typedef double Vector __attribute__((vector_size(vector_bytes)));
+    typedef std::int64_t Mask __attribute__((vector_size(vector_bytes)));
+};
+
+/// Iterate z = z^2 + c for Lanes<T>::size points at once.
+/** A lane stops counting when |z| reaches 2, all stop at \p max_iterations.
+ *  The loop ends as soon as every lane has stopped. */
+template <typename T>
+void iterate_lanes(typename Lanes<T>::Vector const& z0x,
+                   typename Lanes<T>::Vector const& z0y,
+                   typename Lanes<T>::Vector const& cx,
+                   typename Lanes<T>::Vector const& cy,
+                   unsigned int max_iterations,
+                   unsigned int* out)
+{
+    using Mask  = typename Lanes<T>::Mask;
+    auto zx     = z0x;
+    auto zy     = z0y;
+    auto counts = Mask{};
+    auto active = ~Mask{};
+    for (auto i = 0u; i < max_iterations; ++i) {
+        auto const xx = zx * zx;
+        auto const yy = zy * zy;
+        active &= xx + yy < 4;
+        auto is_any = false;
+        for (auto lane = 0; lane < Lanes<T>::size; ++lane)
+            is_any |= active[lane] != 0;
+        if (!is_any)
+            break;
+        counts -= active;  // True lanes are -1.
+        zy = T{2} * zx * zy + cy;
+        zx = xx - yy + cx;
+    }
+    for (auto lane = 0; lane < Lanes<T>::size; ++lane)
+        out[lane] = (unsigned int)counts[lane];
+}
+
+/// Run iterate_lanes over \p count points, the last batch is padded.
+/** Points are the starting z if \p is_julia, otherwise they are c. */
+template <typename T>
+void iterate_points(T const* x,
+                    T const* y,
+                    std::size_t count,
+                    bool is_julia,
+                    std::complex<T> c,
+                    unsigned int max_iterations,
+                    unsigned int* out)
+{
+    using Vector     = typename Lanes<T>::Vector;
+    auto constexpr n = (std::size_t)Lanes<T>::size;
+    for (auto first = std::size_t{0}; first < count; first += n) {
+        auto const size = count - first < n ? count - first : n;
+        auto px         = Vector{};
+        auto py         = Vector{};
+        for (auto lane = std::size_t{0}; lane < size; ++lane) {
+            px[lane] = x[first + lane];
+            py[lane] = y[first + lane];
+        }
+        unsigned int result[n];
+        if (is_julia) {
+            auto const cx = Vector{} + c.real();
+            auto const cy = Vector{} + c.imag();
+            iterate_lanes<T>(px, py, cx, cy, max_iterations, result);
+        }
+        else {
+            auto const zero = Vector{};
+            iterate_lanes<T>(zero, zero, px, py, max_iterations, result);
+        }
+        for (auto lane = std::size_t{0}; lane < size; ++lane)
+            out[first + lane] = result[lane];
+    }
+}
+
+#else
+
+/// Compilers without GNU vector extensions use the long double functions.
+template <typename T>
+void iterate_points(T const* x,
+                    T const* y,
+                    std::size_t count,
+                    bool is_julia,
+                    std::complex<T> c,
+                    unsigned int max_iterations,
+                    unsigned int* out)
+{
+    for (auto i = std::size_t{0}; i < count; ++i) {
+        out[i] = is_julia ? julia(x[i], y[i], c, max_iterations)
+                          : mandelbrot(x[i], y[i], max_iterations);
+    }
+}
+
+#endif
+
+}  // namespace detail
+
+/// Write mandelbrot(x[i], y[i], max_iterations) to out[i] for each point.
+/** float and double run several points at once, long double one at a time. */
+template <typename T>
+void mandelbrot_points(T const* x,
+                       T const* y,
+                       std::size_t count,
+                       unsigned int max_iterations,
+                       unsigned int* out)
+{
+    if constexpr (std::is_same_v<T, long double>) {
+        for (auto i = std::size_t{0}; i < count; ++i)
+            out[i] = mandelbrot(x[i], y[i], max_iterations);
+    }
+    else
+        detail::iterate_points<T>(x, y, count, false, {}, max_iterations, out);
+}
+
+/// Write julia(x[i], y[i], c, max_iterations) to out[i] for each point.
+/** float and double run several points at once, long double one at a time. */
+template <typename T>
+void julia_points(T const* x,
+                  T const* y,
+                  std::size_t count,
+                  std::complex<T> c,
+                  unsigned int max_iterations,
+                  unsigned int* out)
+{
+    if constexpr (std::is_same_v<T, long double>) {
+        for (auto i = std::size_t{0}; i < count; ++i)
+            out[i] = julia(x[i], y[i], c, max_iterations);
+    }
+    else
+        detail::iterate_points<T>(x, y, count, true, c, max_iterations, out);
+}
+
+}  // namespace fractal
+#endif  // TERMOX_DEMOS_FRACTAL_KERNELS_HPP
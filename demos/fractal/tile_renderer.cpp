@@ -0,0 +1,339 @@
+#include "tile_renderer.hpp"
+
+#include <algorithm>
+#include <array>
+#include <chrono>
+#include <cmath>
+#include <complex>
+#include <cstddef>
+#include <cstdint>
+#include <future>
+#include <iterator>
+#include <memory>
+#include <mutex>
+#include <utility>
+#include <vector>
+
+#include <termox/common/thread_pool.hpp>
+#include <termox/painter/color.hpp>
+
+#include "float_t.hpp"
+#include "kernels.hpp"
+
+namespace {
+
+/// Integer division rounding towards negative infinity.
+[[nodiscard]] auto floor_div(std::int64_t a, std::int64_t b) -> std::int64_t
+{
+    return a / b - ((a % b != 0) && ((a < 0) != (b < 0)) ? 1 : 0);
+}
+
+[[nodiscard]] auto pixel_size_of(fractal::Scene const& scene, int zoom)
+    -> std::complex<fractal::Float_t>
+{
+    using fractal::Float_t;
+    auto const scale =
+        std::pow(fractal::Tile_renderer::zoom_factor, (Float_t)zoom);
+    return {scene.span_x * scale / std::max(scene.width, 1),
+            scene.span_y * scale / std::max(scene.height, 1)};
+}
+
+[[nodiscard]] auto max_iterations_of(fractal::Scene const& scene, int zoom)
+    -> unsigned int
+{
+    using fractal::Float_t;
+    auto const span =
+        scene.span_x *
+        std::pow(fractal::Tile_renderer::zoom_factor, (Float_t)zoom);
+    return std::clamp((int)std::log(1. / span), 1, 8) * scene.color_count;
+}
+
+/// Write the iteration counts of the first \p count points of a row.
+/** The points are reals[i] + imag * i, converted to T. */
+template <typename T>
+void iterate_row(
+    fractal::Scene const& scene,
+    std::array<fractal::Float_t, fractal::Tile_renderer::tile_size> const&
+        reals,
+    fractal::Float_t imag,
+    std::size_t count,
+    unsigned int max_iterations,
+    std::array<unsigned int, fractal::Tile_renderer::tile_size>& out)
+{
+    auto x = std::array<T, fractal::Tile_renderer::tile_size>{};
+    auto y = std::array<T, fractal::Tile_renderer::tile_size>{};
+    for (auto i = std::size_t{0}; i < count; ++i) {
+        x[i] = (T)reals[i];
+        y[i] = (T)imag;
+    }
+    if (scene.type == fractal::Fractal::Mandelbrot) {
+        fractal::mandelbrot_points<T>(x.data(), y.data(), count,
+                                      max_iterations, out.data());
+    }
+    else {
+        fractal::julia_points<T>(x.data(), y.data(), count,
+                                 std::complex<T>(scene.julia_c),
+                                 max_iterations, out.data());
+    }
+}
+
+}  // namespace
+
+namespace fractal {
+
+Tile_renderer::Tile_renderer(std::size_t max_tiles) : max_tiles_{max_tiles} {}
+
+Tile_renderer::~Tile_renderer() { this->cancel(); }
+
+void Tile_renderer::set_scene(Scene const& scene)
+{
+    if (scene == scene_)
+        return;
+    ++epoch_;
+    scene_ = scene;
+    tiles_.clear();
+}
+
+void Tile_renderer::request(int zoom, Pixel_rect view)
+{
+    auto const epoch = ++epoch_;
+    drivers_.erase(
+        std::remove_if(std::begin(drivers_), std::end(drivers_),
+                       [](auto const& f) {
+                           return f.wait_for(std::chrono::seconds{0}) ==
+                                  std::future_status::ready;
+                       }),
+        std::end(drivers_));
+
+    // Tiles nearest the center of the view first.
+    auto keys           = keys_of(zoom, view);
+    auto const center_x = view.left * 2 + view.width;
+    auto const center_y = view.top * 2 + view.height;
+    auto const distance = [&](Key const& k) {
+        auto const dx = (k.x * 2 + 1) * tile_size - center_x;
+        auto const dy = (k.y * 2 + 1) * tile_size - center_y;
+        return dx * dx + dy * dy;
+    };
+    std::sort(std::begin(keys), std::end(keys),
+              [&](Key const& a, Key const& b) {
+                  return distance(a) < distance(b);
+              });
+
+    ++stamp_;
+    auto visible = std::vector<std::shared_ptr<Tile>>{};
+    for (auto const& key : keys) {
+        auto& tile = tiles_[key];
+        if (tile == nullptr)
+            tile = std::make_shared<Tile>();
+        tile->last_used = stamp_;
+        visible.push_back(tile);
+    }
+
+    auto job   = std::make_shared<Job>();
+    job->epoch = epoch;
+    job->scene = scene_;
+    for (auto pass = 0; pass < (int)pass_steps.size(); ++pass) {
+        for (auto i = std::size_t{0}; i < keys.size(); ++i) {
+            auto const lock = std::lock_guard{visible[i]->mtx};
+            if (!visible[i]->is_pass_done[pass])
+                job->items.push_back({visible[i], keys[i], pass});
+        }
+    }
+    job->remaining = job->items.size();
+    job_           = job;
+
+    auto& pool              = ox::shared_thread_pool();
+    auto const driver_count = std::min(pool.thread_count(), job->items.size());
+    for (auto i = std::size_t{0}; i < driver_count; ++i)
+        drivers_.push_back(pool.submit([this, job] { this->drive(*job); }));
+
+    this->evict(keys);
+}
+
+void Tile_renderer::paint_to(int zoom,
+                             Pixel_rect view,
+                             std::vector<ox::Color>& pixels)
+{
+    auto const count = (std::size_t)view.width * view.height;
+    pixels.assign(count, ox::Color::Background);
+    for (auto const& key : keys_of(zoom, view)) {
+        auto const at = tiles_.find(key);
+        if (at == std::end(tiles_))
+            continue;
+        auto& tile      = *at->second;
+        auto const lock = std::lock_guard{tile.mtx};
+        if (tile.done < 0)
+            continue;
+        auto const step = pass_steps[tile.done];
+
+        // Intersection of the tile and the view, in tile pixel coordinates.
+        auto const x0      = key.x * tile_size;
+        auto const y0      = key.y * tile_size;
+        auto const x_begin = (int)std::max(view.left - x0, std::int64_t{0});
+        auto const y_begin = (int)std::max(view.top - y0, std::int64_t{0});
+        auto const x_end   = (int)std::min(view.left + view.width - x0,
+                                         std::int64_t{tile_size});
+        auto const y_end   = (int)std::min(view.top + view.height - y0,
+                                         std::int64_t{tile_size});
+        for (auto y = y_begin; y < y_end; ++y) {
+            auto const src_row = (y - y % step) * tile_size;
+            auto const dst_row = (std::size_t)(y0 + y - view.top) * view.width;
+            for (auto x = x_begin; x < x_end; ++x) {
+                pixels[dst_row + (std::size_t)(x0 + x - view.left)] =
+                    tile.pixels[src_row + (x - x % step)];
+            }
+        }
+    }
+}
+
+auto Tile_renderer::take_updates() -> bool { return updated_.exchange(false); }
+
+auto Tile_renderer::is_busy() const -> bool
+{
+    return job_ != nullptr && job_->remaining != 0;
+}
+
+auto Tile_renderer::tile_count() const -> std::size_t { return tiles_.size(); }
+
+auto Tile_renderer::pixel_size(int zoom) const -> std::complex<Float_t>
+{
+    return pixel_size_of(scene_, zoom);
+}
+
+auto Tile_renderer::max_iterations(int zoom) const -> unsigned int
+{
+    return max_iterations_of(scene_, zoom);
+}
+
+void Tile_renderer::drive(Job& job)
+{
+    for (auto i = job.next++; i < job.items.size(); i = job.next++) {
+        if (epoch_ != job.epoch || !this->render(job.items[i], job))
+            return;
+        --job.remaining;
+    }
+}
+
+auto Tile_renderer::render(Work const& w, Job const& job) -> bool
+{
+    {
+        auto const lock = std::lock_guard{w.tile->mtx};
+        if (w.tile->is_pass_done[w.pass])
+            return true;
+    }
+
+    // Pixels of this pass, those on the previous pass's grid are skipped.
+    auto const step    = pass_steps[w.pass];
+    auto const coarser = w.pass == 0 ? 0 : pass_steps[w.pass - 1];
+    auto const is_new  = [coarser](int x, int y) {
+        return coarser == 0 || x % coarser != 0 || y % coarser != 0;
+    };
+
+    auto const& scene = job.scene;
+    auto const size   = pixel_size_of(scene, w.key.zoom);
+    auto const limit  = max_iterations_of(scene, w.key.zoom);
+    auto const x0     = w.key.x * tile_size;
+    auto const y0     = w.key.y * tile_size;
+
+    auto const precision = precision_for(std::min(size.real(), size.imag()));
+    auto values =
+        std::vector<ox::Color>(tile_size * tile_size, ox::Color::Background);
+
+    // New pixels of a row are iterated together, in precision's type.
+    auto columns    = std::array<int, tile_size>{};
+    auto reals      = std::array<Float_t, tile_size>{};
+    auto iterations = std::array<unsigned int, tile_size>{};
+    for (auto y = 0; y < tile_size; y += step) {
+        if (epoch_ != job.epoch)
+            return false;
+        auto count = std::size_t{0};
+        for (auto x = 0; x < tile_size; x += step) {
+            if (is_new(x, y)) {
+                columns[count] = x;
+                reals[count]   = (Float_t)(x0 + x) * size.real();
+                ++count;
+            }
+        }
+        auto const imag = -(Float_t)(y0 + y) * size.imag();
+        switch (precision) {
+            case Precision::Float:
+                iterate_row<float>(scene, reals, imag, count, limit,
+                                   iterations);
+                break;
+            case Precision::Double:
+                iterate_row<double>(scene, reals, imag, count, limit,
+                                    iterations);
+                break;
+            case Precision::Long_double:
+                iterate_row<long double>(scene, reals, imag, count, limit,
+                                         iterations);
+                break;
+        }
+        for (auto i = std::size_t{0}; i < count; ++i) {
+            values[y * tile_size + columns[i]] =
+                ox::Color((iterations[i] - 1) % scene.color_count +
+                          scene.first_color);
+        }
+    }
+
+    auto& tile      = *w.tile;
+    auto const lock = std::lock_guard{tile.mtx};
+    for (auto y = 0; y < tile_size; y += step) {
+        for (auto x = 0; x < tile_size; x += step) {
+            if (is_new(x, y))
+                tile.pixels[y * tile_size + x] = values[y * tile_size + x];
+        }
+    }
+    tile.is_pass_done[w.pass] = true;
+    while (tile.done + 1 < (int)pass_steps.size() &&
+           tile.is_pass_done[tile.done + 1]) {
+        ++tile.done;
+    }
+    updated_ = true;
+    return true;
+}
+
+void Tile_renderer::cancel()
+{
+    ++epoch_;
+    for (auto& f : drivers_)
+        f.wait();
+    drivers_.clear();
+}
+
+void Tile_renderer::evict(std::vector<Key> const& keep)
+{
+    if (tiles_.size() <= max_tiles_)
+        return;
+    auto by_age = std::vector<std::pair<std::uint64_t, Key>>{};
+    for (auto const& [key, tile] : tiles_) {
+        if (tile->last_used != stamp_)
+            by_age.push_back({tile->last_used, key});
+    }
+    std::sort(std::begin(by_age), std::end(by_age),
+              [](auto const& a, auto const& b) { return a.first < b.first; });
+    auto const target = std::max(max_tiles_ * 3 / 4, keep.size());
+    for (auto const& [age, key] : by_age) {
+        if (tiles_.size() <= target)
+            break;
+        tiles_.erase(key);
+    }
+}
+
+auto Tile_renderer::keys_of(int zoom, Pixel_rect view) -> std::vector<Key>
+{
+    auto result = std::vector<Key>{};
+    if (view.width <= 0 || view.height <= 0)
+        return result;
+    auto const first_x = floor_div(view.left, tile_size);
+    auto const first_y = floor_div(view.top, tile_size);
+    auto const last_x  = floor_div(view.left + view.width - 1, tile_size);
+    auto const last_y  = floor_div(view.top + view.height - 1, tile_size);
+    for (auto y = first_y; y <= last_y; ++y) {
+        for (auto x = first_x; x <= last_x; ++x)
+            result.push_back({zoom, x, y});
+    }
+    return result;
+}
+
+}  // namespace fractal
@@ -0,0 +1,183 @@
+#ifndef TERMOX_DEMOS_FRACTAL_TILE_RENDERER_HPP
+#define TERMOX_DEMOS_FRACTAL_TILE_RENDERER_HPP
+#include <array>
+#include <atomic>
+#include <complex>
+#include <cstddef>
+#include <cstdint>
+#include <future>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <tuple>
+#include <vector>
+
+#include <termox/painter/color.hpp>
+
+#include "float_t.hpp"
+
+namespace fractal {
+
+enum class Fractal { Mandelbrot, Julia };
+
+/// Everything a pixel's color depends on, other than its position and zoom.
+struct Scene {
+    Fractal type                  = Fractal::Mandelbrot;
+    std::complex<Float_t> julia_c = {0, 0};
+
+    // Complex plane size of the view at zoom level zero, and its pixel count.
+    Float_t span_x = 4;
+    Float_t span_y = 4;
+    int width      = 0;
+    int height     = 0;
+
+    // Colors used, iteration count i is Color{first_color + (i-1) % count}.
+    int first_color = 16;
+    int color_count = 1;
+};
+
+[[nodiscard]] inline auto operator==(Scene const& a, Scene const& b) -> bool
+{
+    return a.type == b.type && a.julia_c == b.julia_c &&
+           a.span_x == b.span_x && a.span_y == b.span_y &&
+           a.width == b.width && a.height == b.height &&
+           a.first_color == b.first_color && a.color_count == b.color_count;
+}
+
+/// Pixel rectangle in the pixel grid of one zoom level.
+/** Pixel x, y is at the complex plane point x * pixel_width, -y * pixel_height
+ *  for that zoom level. */
+struct Pixel_rect {
+    std::int64_t left;
+    std::int64_t top;
+    int width;
+    int height;
+};
+
+/// Renders a Scene in square tiles of pixels on the shared Thread_pool.
+/** Tiles are identified by zoom level and tile grid position, and cached, so
+ *  panning only renders the newly visible tiles. Each tile is rendered in
+ *  passes from every eighth pixel down to every pixel, all visible tiles get
+ *  a coarse pass before any gets a finer one. A new request() cancels the work
+ *  of the previous one. Workers only touch the tiles they are given, the cache
+ *  itself is only used from the thread that calls request() and paint_to().
+ *  Pixels are iterated in the Precision that precision_for() picks for the
+ *  zoom level. */
+class Tile_renderer {
+   public:
+    static constexpr auto tile_size = 32;
+
+    /// Complex plane span multiplier of each zoom level.
+    static constexpr auto zoom_factor = Float_t{0.95};
+
+    /// Pixel step of each pass, the last pass computes every pixel.
+    static constexpr auto pass_steps = std::array{8, 4, 2, 1};
+
+   public:
+    /// Cache at most \p max_tiles tiles, least recently requested are evicted.
+    explicit Tile_renderer(std::size_t max_tiles = 2'048);
+
+    Tile_renderer(Tile_renderer const&) = delete;
+    auto operator=(Tile_renderer const&) -> Tile_renderer& = delete;
+
+    /// Cancel work in progress and wait for it to stop.
+    ~Tile_renderer();
+
+   public:
+    /// Render with \p scene from now on, clears the cache if it is new.
+    void set_scene(Scene const& scene);
+
+    /// Cancel previous work and render the tiles covering \p view at \p zoom.
+    void request(int zoom, Pixel_rect view);
+
+    /// Write the best available colors of \p view at \p zoom to \p pixels.
+    /** \p pixels is row major, view.width by view.height. Pixels that have
+     *  not been rendered are set to Color::Background. */
+    void paint_to(int zoom, Pixel_rect view, std::vector<ox::Color>& pixels);
+
+    /// Return true if any pass finished since the last call.
+    [[nodiscard]] auto take_updates() -> bool;
+
+    /// Return true if the last request() still has work to do.
+    [[nodiscard]] auto is_busy() const -> bool;
+
+    /// Return the number of cached tiles.
+    [[nodiscard]] auto tile_count() const -> std::size_t;
+
+    /// Return the complex plane distance between pixels at \p zoom.
+    [[nodiscard]] auto pixel_size(int zoom) const -> std::complex<Float_t>;
+
+    /// Return the iteration limit used at \p zoom.
+    [[nodiscard]] auto max_iterations(int zoom) const -> unsigned int;
+
+   private:
+    struct Key {
+        int zoom;
+        std::int64_t x;  // Tile grid position, pixel / tile_size.
+        std::int64_t y;
+
+        [[nodiscard]] auto operator<(Key const& k) const -> bool
+        {
+            return std::tie(zoom, y, x) < std::tie(k.zoom, k.y, k.x);
+        }
+    };
+
+    struct Tile {
+        std::mutex mtx;
+        std::vector<ox::Color> pixels = std::vector<ox::Color>(
+            tile_size * tile_size, ox::Color::Background);
+        std::array<bool, pass_steps.size()> is_pass_done = {};
+
+        // Index into pass_steps of the finest pass with all coarser done.
+        int done = -1;
+
+        std::uint64_t last_used = 0;  // Only used from the requesting thread.
+    };
+
+    /// One pass over one tile.
+    struct Work {
+        std::shared_ptr<Tile> tile;
+        Key key;
+        int pass;
+    };
+
+    /// Work items of one request(), taken in order by the driver tasks.
+    struct Job {
+        std::vector<Work> items;
+        std::atomic<std::size_t> next{0};
+        std::atomic<std::size_t> remaining{0};
+        std::uint64_t epoch;
+        Scene scene;
+    };
+
+   private:
+    Scene scene_;
+    std::map<Key, std::shared_ptr<Tile>> tiles_;
+    std::size_t max_tiles_;
+    std::uint64_t stamp_ = 0;
+
+    std::atomic<std::uint64_t> epoch_{0};
+    std::atomic<bool> updated_{false};
+    std::shared_ptr<Job> job_;
+    std::vector<std::future<void>> drivers_;
+
+   private:
+    /// Take and run items from \p job until none are left or it is stale.
+    void drive(Job& job);
+
+    /// Compute pass \p w.pass of \p w.tile, return false if cancelled.
+    auto render(Work const& w, Job const& job) -> bool;
+
+    /// Cancel the current job and wait for its drivers.
+    void cancel();
+
+    /// Remove least recently used tiles not in \p keep until under the limit.
+    void evict(std::vector<Key> const& keep);
+
+    /// Return the keys of the tiles covering \p view at \p zoom.
+    [[nodiscard]] static auto keys_of(int zoom, Pixel_rect view)
+        -> std::vector<Key>;
+};
+
+}  // namespace fractal
+#endif  // TERMOX_DEMOS_FRACTAL_TILE_RENDERER_HPP
@@ -158,13 +158,43 @@ struct Rainbow_btn : ox::HCheckbox_label {
     Rainbow_btn() : ox::HCheckbox_label{{U"Rainbow Mode"}} {}
 };
 
+struct Hashlife_btn : ox::HCheckbox_label {
+    Hashlife_btn() : ox::HCheckbox_label{{U"HashLife Engine"}} {}
+};
+
+/// Button to advance 2^k generations at once, with an edit for k.
+struct Jump_box : ox::layout::Horizontal<> {
+   public:
+    ox::Button& jump_btn = this->make_child<ox::Button>(U"Jump 2^");
+    ox::Unsigned_edit& exponent =
+        this->make_child<ox::Unsigned_edit>({10, {0, 60}});
+
+   public:
+    sl::Signal<void(unsigned)> jump_request;
+
+   public:
+    Jump_box()
+    {
+        using namespace ox;
+        using namespace ox::pipe;
+
+        *this | fixed_height(1);
+        jump_btn | bg(color::Teal) | fg(color::Light_green) | fixed_width(7);
+        exponent | bg(color::White) | fg(color::Teal);
+
+        jump_btn.pressed.connect([this] { jump_request(exponent.value()); });
+    }
+};
+
 struct Controls_box : ox::VTuple<Interval_box,
                                  ox::HLine,
                                  Start_pause_btns,
                                  Clear_step_box,
+                                 Jump_box,
                                  ox::HLine,
                                  Grid_hi_res,
                                  Rainbow_btn,
+                                 Hashlife_btn,
                                  ox::HLine,
                                  Rule_edit,
                                  ox::HLine> {
@@ -173,12 +203,14 @@ struct Controls_box : ox::VTuple<Interval_box,
     ox::HLine& break_0                 = this->get<1>() | fg(color::Teal);
     Start_pause_btns& start_pause_btns = this->get<2>();
     Clear_step_box& clear_step_btns    = this->get<3>();
-    ox::HLine& break_1                 = this->get<4>() | fg(color::Teal);
-    Grid_hi_res& grid_hi_res           = this->get<5>();
-    Rainbow_btn& rainbow_btn           = this->get<6>();
-    ox::HLine& break_2                 = this->get<7>() | fg(color::Teal);
-    Rule_edit& rule_edit               = this->get<8>();
-    ox::HLine& break_3                 = this->get<9>() | fg(color::Teal);
+    Jump_box& jump_box                 = this->get<4>();
+    ox::HLine& break_1                 = this->get<5>() | fg(color::Teal);
+    Grid_hi_res& grid_hi_res           = this->get<6>();
+    Rainbow_btn& rainbow_btn           = this->get<7>();
+    Hashlife_btn& hashlife_btn         = this->get<8>();
+    ox::HLine& break_2                 = this->get<9>() | fg(color::Teal);
+    Rule_edit& rule_edit               = this->get<10>();
+    ox::HLine& break_3                 = this->get<11>() | fg(color::Teal);
 
    public:
     sl::Signal<void(std::string const&)>& rule_change = rule_edit.rule_change;
@@ -186,14 +218,17 @@ struct Controls_box : ox::VTuple<Interval_box,
     sl::Signal<void()>& grid_toggled = grid_hi_res.grid_box.checkbox.toggled;
     sl::Signal<void()>& hi_res_toggled =
         grid_hi_res.hi_res_box.checkbox.toggled;
-    sl::Signal<void()>& clear_request  = clear_step_btns.clear_btn.pressed;
-    sl::Signal<void()>& step_request   = clear_step_btns.step_btn.pressed;
-    sl::Signal<void()>& rainbow_toggle = rainbow_btn.checkbox.toggled;
+    sl::Signal<void()>& clear_request   = clear_step_btns.clear_btn.pressed;
+    sl::Signal<void()>& step_request    = clear_step_btns.step_btn.pressed;
+    sl::Signal<void()>& rainbow_toggle  = rainbow_btn.checkbox.toggled;
+    sl::Signal<void()>& hashlife_toggle = hashlife_btn.checkbox.toggled;
+
+    sl::Signal<void(unsigned)>& jump_request = jump_box.jump_request;
 
    public:
     Controls_box()
     {
-        *this | ox::pipe::fixed_height(12);
+        *this | ox::pipe::fixed_height(14);
 
         interval_edit.submitted.connect([this](int value) {
             interval_set(std::chrono::milliseconds{value});
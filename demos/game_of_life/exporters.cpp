@@ -3,6 +3,7 @@
 #include <fstream>
 #include <string>
 
+#include "coordinate.hpp"
 #include "game_of_life_engine.hpp"
 
 namespace gol {
@@ -40,10 +41,8 @@ void export_as_life_1_06(std::string const& filename,
 {
     auto file = std::ofstream{filename};
     file << "#Life 1.06\n";
-    for (auto const cell : engine) {
-        if (cell.is_alive)
-            file << cell.coordinate.x << ' ' << cell.coordinate.y << '\n';
-    }
+    engine.for_each_alive(
+        [&file](Coordinate c) { file << c.x << ' ' << c.y << '\n'; });
 }
 
 void export_as_plaintext(std::string const& /* filename */,
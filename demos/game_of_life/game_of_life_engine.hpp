@@ -1,21 +1,29 @@
 #ifndef TERMOX_DEMOS_GAME_OF_LIFE_GAME_OF_LIFE_ENGINE_HPP
 #define TERMOX_DEMOS_GAME_OF_LIFE_GAME_OF_LIFE_ENGINE_HPP
+#include <cstddef>
 #include <cstdint>
-#include <vector>
+#include <variant>
 
 #include <signals_light/signal.hpp>
 
-#include "bitset.hpp"
 #include "coordinate.hpp"
+#include "hashlife.hpp"
+#include "life_kernel.hpp"
 #include "pattern.hpp"
 #include "rule.hpp"
 
 namespace gol {
 
 /// Holds game state and provides an interface to update to the next pattern.
+/** Cells are stored and stepped by a Life_kernel in Mode::Tiled, or by a
+ *  Hashlife in Mode::Hashlife, see their bounds. */
 class Game_of_life_engine {
    public:
-    sl::Signal<void(std::uint32_t)> generation_count_changed;
+    /// Cell storage and stepping algorithm.
+    enum class Mode { Tiled, Hashlife };
+
+   public:
+    sl::Signal<void(std::uint64_t)> generation_count_changed;
 
    public:
     /// Create a living cell at \p c and reset the generation count.
@@ -30,8 +38,26 @@ class Game_of_life_engine {
     void kill_all();
 
     /// Updates the engine state to the next generation of cells.
+    /** Mode::Hashlife throws std::length_error if the world is full. */
     void step_to_next_generation();
 
+    /// Largest k accepted by jump() in Mode::Tiled.
+    /** Mode::Tiled steps one generation at a time on the calling thread. */
+    static constexpr auto max_tiled_jump = 10;
+
+    /// Advance 2^k generations.
+    /** Mode::Hashlife jumps directly, Mode::Tiled steps 2^k times. Throws
+     *  std::out_of_range if \p k is not in [0, max_jump()]. Mode::Hashlife
+     *  throws std::length_error if the world is full. */
+    void jump(int k);
+
+    /// Move the living cells to the storage for \p m.
+    /** Cells outside of the new storage's bounds are dropped. */
+    void set_mode(Mode m);
+
+    /// Set the memory budget for Mode::Hashlife, in bytes.
+    void set_memory_budget(std::size_t bytes);
+
     /// Import a pattern, set the rules, and reset the generation count.
     /** This does not clear the current alive cells. */
     void import(Pattern const& pattern);
@@ -40,44 +66,45 @@ class Game_of_life_engine {
     void set_rules(Rule r);
 
    public:
-    /// Begin iterator to boolean is_alive and Coordinate.
-    [[nodiscard]] auto begin() const -> Bitset::const_iterator;
-
-    /// End iterator to boolean is_alive and Coordinate.
-    [[nodiscard]] auto end() const -> Bitset::const_iterator;
-
     /// Check if a cell is alive at the given Coordinate.
     [[nodiscard]] auto is_alive_at(Coordinate c) const -> bool;
 
     /// Return a copy of the currently set Rule.
     [[nodiscard]] auto rules() const -> Rule;
 
+    /// Return the number of living cells.
+    [[nodiscard]] auto population() const -> std::uint64_t;
+
+    /// Return the current cell storage and stepping algorithm.
+    [[nodiscard]] auto mode() const -> Mode;
+
+    /// Return the largest k that jump() accepts in the current Mode.
+    [[nodiscard]] auto max_jump() const -> int;
+
+    /// Call \p f with the Coordinate of each living cell.
+    template <typename F>
+    void for_each_alive(F&& f) const
+    {
+        std::visit([&f](auto const& cells) { cells.for_each_alive(f); },
+                   cells_);
+    }
+
    private:
-    Bitset cells_;
-    std::vector<Coordinate> volatiles_;
+    std::variant<Life_kernel, Hashlife> cells_;
     Rule rules_;
-    std::uint32_t generation_count_ = 0;
+    std::uint64_t generation_count_ = 0;
+    std::size_t memory_budget_      = Hashlife::default_memory_budget;
 
    private:
-    /// Add live cells and volatiles to the engine from a Pattern.
+    /// Add live cells to the engine from a Pattern.
     /** Does not clear the state. */
-    void add_cells(Pattern::Cells cells);
+    void add_cells(Pattern::Cells const& cells);
 
-    /// Increment the generation count by 1 and emit generation_count_changed.
-    void increment_generation_count();
+    /// Increment the generation count by \p n, emit generation_count_changed.
+    void increment_generation_count(std::uint64_t n = 1);
 
     /// Set the generation count to 0 and emit generation_count_changed.
     void reset_generation_count();
-
-    /// Add a live cell at the given position and adds to volatile cells.
-    void add_cell_at(Coordinate c);
-
-    /// Remove a live cell at the given position and adds to volatile cells.
-    void remove_cell_at(Coordinate c);
-
-    /// Make every live cell a volatile cell.
-    /** Used when changing the Rule. */
-    void make_all_volatile();
 };
 
 }  // namespace gol
@@ -39,6 +39,10 @@ GoL_demo::GoL_demo()
     side_panel.settings.clear_request.connect(
         [this]() { gol_display.clear(); });
     side_panel.settings.step_request.connect([this]() { gol_display.step(); });
+    side_panel.settings.jump_request.connect(
+        [this](unsigned k) { gol_display.jump((int)k); });
+    side_panel.settings.hashlife_toggle.connect(
+        [this]() { gol_display.toggle_hashlife(); });
     side_panel.settings.start_pause_btns.start_requested.connect(
         [this]() { gol_display.start(); });
     side_panel.settings.start_pause_btns.pause_requested.connect(
@@ -66,7 +70,7 @@ GoL_demo::GoL_demo()
             gol_display.set_offset({gol_display.offset().x, y});
         });
 
-    gol_display.generation_count_changed.connect([this](std::uint32_t count) {
+    gol_display.generation_count_changed.connect([this](std::uint64_t count) {
         side_panel.status.gen_count.update_count(count);
     });
 
@@ -71,10 +71,39 @@ void GoL_widget::step()
 {
     if (this->is_animated())
         return;
-    engine_.step_to_next_generation();
+    try {
+        engine_.step_to_next_generation();
+    }
+    catch (std::length_error const&) {
+    }
+    this->update();
+}
+
+void GoL_widget::jump(int k)
+{
+    if (this->is_animated())
+        return;
+    try {
+        engine_.jump(std::clamp(k, 0, engine_.max_jump()));
+    }
+    catch (std::length_error const&) {
+    }
+    this->update();
+}
+
+void GoL_widget::enable_hashlife(bool enabled)
+{
+    using Mode = Game_of_life_engine::Mode;
+    engine_.set_mode(enabled ? Mode::Hashlife : Mode::Tiled);
     this->update();
 }
 
+void GoL_widget::toggle_hashlife()
+{
+    this->enable_hashlife(engine_.mode() !=
+                          Game_of_life_engine::Mode::Hashlife);
+}
+
 void GoL_widget::enable_hi_res(bool enabled)
 {
     hi_res_ = enabled;
@@ -242,7 +271,13 @@ auto GoL_widget::mouse_wheel_event(ox::Mouse const& m) -> bool
 
 auto GoL_widget::timer_event() -> bool
 {
-    engine_.step_to_next_generation();
+    try {
+        engine_.step_to_next_generation();
+    }
+    catch (std::length_error const&) {
+        // The HashLife world is full, nothing further can be stepped.
+        this->pause();
+    }
     this->update();
     return Widget::timer_event();
 }
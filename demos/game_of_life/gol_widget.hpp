@@ -43,6 +43,18 @@ class GoL_widget : public ox::Widget {
     /// Progress to the next iteration of the game.
     void step();
 
+    /// Progress 2^k iterations of the game at once.
+    /** \p k is clamped to [0, 60] with the HashLife engine enabled, otherwise
+     *  to [0, Game_of_life_engine::max_tiled_jump], since each generation is
+     *  then stepped on the UI thread. */
+    void jump(int k);
+
+    /// Store and step cells with HashLife instead of the tiled engine.
+    void enable_hashlife(bool enabled = true);
+
+    /// Alternate between the HashLife and tiled engines.
+    void toggle_hashlife();
+
     /// Set Hi-Resolution Mode.
     void enable_hi_res(bool enabled = true);
 
@@ -158,7 +170,7 @@ class GoL_widget : public ox::Widget {
    public:
     sl::Signal<void(Coordinate)> offset_changed;
     sl::Signal<void(Rule)> rule_changed;
-    sl::Signal<void(std::uint32_t)>& generation_count_changed{
+    sl::Signal<void(std::uint64_t)>& generation_count_changed{
         engine_.generation_count_changed};
 };
 
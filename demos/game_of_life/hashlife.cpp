@@ -0,0 +1,423 @@
+#include "hashlife.hpp"
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <stdexcept>
+#include <vector>
+
+#include "coordinate.hpp"
+#include "rule.hpp"
+
+namespace {
+
+[[nodiscard]] auto hash(std::uint32_t nw,
+                        std::uint32_t ne,
+                        std::uint32_t sw,
+                        std::uint32_t se) -> std::size_t
+{
+    auto constexpr k = std::uint64_t{0x9E37'79B9'7F4A'7C15};
+    auto h           = ((((nw * k) ^ ne) * k ^ sw) * k ^ se) * k;
+    return static_cast<std::size_t>(h ^ (h >> 32));
+}
+
+/// Return the 2x2 center of the 4x4 \p cells one generation ahead.
+/** Cell x, y is bit y * 4 + x, in the result it is bit (y-1) * 2 + (x-1). */
+[[nodiscard]] auto step_center(std::uint16_t cells, gol::Rule const& rule)
+    -> std::uint8_t
+{
+    auto const at = [cells](int x, int y) {
+        return (cells >> (y * 4 + x)) & 1;
+    };
+
+    auto result = std::uint8_t{0};
+    for (auto y = 1; y < 3; ++y) {
+        for (auto x = 1; x < 3; ++x) {
+            auto count = 0;
+            for (auto dy = -1; dy <= 1; ++dy) {
+                for (auto dx = -1; dx <= 1; ++dx) {
+                    if (dx != 0 || dy != 0)
+                        count += at(x + dx, y + dy);
+                }
+            }
+            auto const next = at(x, y) != 0 ? rule.survival[count]
+                                            : count != 0 && rule.birth[count];
+            if (next)
+                result |= 1 << ((y - 1) * 2 + (x - 1));
+        }
+    }
+    return result;
+}
+
+}  // namespace
+
+namespace gol {
+
+Hashlife::Hashlife(std::size_t memory_budget) : memory_budget_{memory_budget}
+{
+    nodes_.push_back({0, no_node, no_node, no_node, no_node, no_node, -1, 0,
+                      false});
+    nodes_.push_back({1, no_node, no_node, no_node, no_node, no_node, -1, 0,
+                      false});
+    for (auto i = 0; i < (int)base_.size(); ++i)
+        base_[i] = step_center((std::uint16_t)i, rule_);
+    this->rebuild_table();
+    root_ = this->empty(3);
+}
+
+void Hashlife::set(Coordinate c, bool is_alive)
+{
+    auto const x = std::int64_t{c.x};
+    auto const y = std::int64_t{c.y};
+    auto half    = std::int64_t{1} << (nodes_[root_].level - 1);
+    while (x < -half || x >= half || y < -half || y >= half) {
+        if (!is_alive)
+            return;
+        this->expand();
+        half *= 2;
+    }
+    root_ = this->set(root_, x + half, y + half, is_alive);
+}
+
+auto Hashlife::is_alive_at(Coordinate c) const -> bool
+{
+    auto half = std::int64_t{1} << (nodes_[root_].level - 1);
+    auto x    = std::int64_t{c.x} + half;
+    auto y    = std::int64_t{c.y} + half;
+    if (x < 0 || y < 0 || x >= 2 * half || y >= 2 * half)
+        return false;
+    auto n = root_;
+    while (nodes_[n].level != 0) {
+        auto const& node = nodes_[n];
+        if (node.population == 0)
+            return false;
+        half = std::int64_t{1} << (node.level - 1);
+        if (y < half)
+            n = x < half ? node.nw : node.ne;
+        else
+            n = x < half ? node.sw : node.se;
+        x %= half;
+        y %= half;
+    }
+    return n == alive;
+}
+
+void Hashlife::clear()
+{
+    root_ = this->empty(3);
+    this->collect_garbage(false);
+}
+
+void Hashlife::step(Rule const& rule)
+{
+    this->use_rule(rule);
+    this->advance(0);
+    this->trim();
+}
+
+void Hashlife::jump(Rule const& rule, int k)
+{
+    if (k < 0 || k > 60)
+        throw std::out_of_range{"Hashlife::jump: k must be in [0, 60]."};
+    this->use_rule(rule);
+    this->advance(k);
+    this->trim();
+}
+
+auto Hashlife::population() const -> std::uint64_t
+{
+    return nodes_[root_].population;
+}
+
+void Hashlife::set_memory_budget(std::size_t bytes)
+{
+    memory_budget_ = bytes;
+    this->trim();
+}
+
+auto Hashlife::memory_budget() const -> std::size_t { return memory_budget_; }
+
+auto Hashlife::memory_usage() const -> std::size_t
+{
+    return this->node_count() * sizeof(Node) + table_.size() * sizeof(Id);
+}
+
+auto Hashlife::node_count() const -> std::size_t
+{
+    return nodes_.size() - free_.size();
+}
+
+void Hashlife::collect_garbage(bool keep_results)
+{
+    // Mark
+    auto stack = std::vector<Id>{root_};
+    stack.insert(std::end(stack), std::cbegin(empty_), std::cend(empty_));
+    while (!stack.empty()) {
+        auto& node = nodes_[stack.back()];
+        stack.pop_back();
+        if (node.is_marked)
+            continue;
+        node.is_marked = true;
+        if (node.level == 0)
+            continue;
+        stack.insert(std::end(stack), {node.nw, node.ne, node.sw, node.se});
+        if (keep_results && node.result_step >= 0)
+            stack.push_back(node.result);
+    }
+
+    // Sweep
+    free_.clear();
+    for (auto id = Id{0}; id < nodes_.size(); ++id) {
+        auto& node = nodes_[id];
+        if (id > alive && (node.level == freed || !node.is_marked)) {
+            node.level = freed;
+            free_.push_back(id);
+            continue;
+        }
+        node.is_marked = false;
+        if (!keep_results)
+            node.result_step = -1;
+    }
+    this->rebuild_table();
+}
+
+auto Hashlife::join(Id nw, Id ne, Id sw, Id se) -> Id
+{
+    auto const mask = table_.size() - 1;
+    auto i          = hash(nw, ne, sw, se) & mask;
+    for (; table_[i] != no_node; i = (i + 1) & mask) {
+        auto const& n = nodes_[table_[i]];
+        if (n.nw == nw && n.ne == ne && n.sw == sw && n.se == se)
+            return table_[i];
+    }
+
+    auto const population = nodes_[nw].population + nodes_[ne].population +
+                            nodes_[sw].population + nodes_[se].population;
+    auto const level = static_cast<std::uint8_t>(nodes_[nw].level + 1);
+    auto const node =
+        Node{population, nw, ne, sw, se, no_node, -1, level, false};
+    auto id = Id{0};
+    if (free_.empty()) {
+        id = static_cast<Id>(nodes_.size());
+        nodes_.push_back(node);
+    }
+    else {
+        id = free_.back();
+        free_.pop_back();
+        nodes_[id] = node;
+    }
+    table_[i] = id;
+    if (this->node_count() * 2 > table_.size())
+        this->rebuild_table();
+    return id;
+}
+
+auto Hashlife::empty(int level) -> Id
+{
+    if (empty_.empty())
+        empty_.push_back(dead);
+    while ((int)empty_.size() <= level) {
+        auto const e = empty_.back();
+        empty_.push_back(this->join(e, e, e, e));
+    }
+    return empty_[level];
+}
+
+auto Hashlife::result(Id n, int j) -> Id
+{
+    if (nodes_[n].result_step == j)
+        return nodes_[n].result;
+
+    auto const level = nodes_[n].level;
+    auto r           = Id{0};
+    if (nodes_[n].population == 0)
+        r = this->empty(level - 1);
+    else if (level == 2)
+        r = this->base_result(n);
+    else {
+        auto const node = nodes_[n];
+        auto const nw   = nodes_[node.nw];
+        auto const ne   = nodes_[node.ne];
+        auto const sw   = nodes_[node.sw];
+        auto const se   = nodes_[node.se];
+
+        // Nine overlapping subnodes, each half the size of n.
+        auto const n00 = node.nw;
+        auto const n01 = this->join(nw.ne, ne.nw, nw.se, ne.sw);
+        auto const n02 = node.ne;
+        auto const n10 = this->join(nw.sw, nw.se, sw.nw, sw.ne);
+        auto const n11 = this->join(nw.se, ne.sw, sw.ne, se.nw);
+        auto const n12 = this->join(ne.sw, ne.se, se.nw, se.ne);
+        auto const n20 = node.sw;
+        auto const n21 = this->join(sw.ne, se.nw, sw.se, se.sw);
+        auto const n22 = node.se;
+
+        // At full speed both halves advance, otherwise only the second.
+        auto const is_full = j == level - 2;
+        auto const first   = [&](Id x) {
+            return is_full ? this->result(x, j - 1) : this->center(x);
+        };
+        auto const second = is_full ? j - 1 : j;
+
+        auto const r00 = first(n00);
+        auto const r01 = first(n01);
+        auto const r02 = first(n02);
+        auto const r10 = first(n10);
+        auto const r11 = first(n11);
+        auto const r12 = first(n12);
+        auto const r20 = first(n20);
+        auto const r21 = first(n21);
+        auto const r22 = first(n22);
+
+        r = this->join(
+            this->result(this->join(r00, r01, r10, r11), second),
+            this->result(this->join(r01, r02, r11, r12), second),
+            this->result(this->join(r10, r11, r20, r21), second),
+            this->result(this->join(r11, r12, r21, r22), second));
+    }
+    nodes_[n].result      = r;
+    nodes_[n].result_step = static_cast<std::int8_t>(j);
+    return r;
+}
+
+auto Hashlife::base_result(Id n) -> Id
+{
+    auto cells      = std::uint16_t{0};
+    auto const& q   = nodes_[n];
+    auto const quad = [&](Id id, int x, int y) {
+        auto const& c = nodes_[id];
+        auto const at = [&](Id leaf, int dx, int dy) {
+            if (leaf == alive)
+                cells |= 1 << ((y + dy) * 4 + x + dx);
+        };
+        at(c.nw, 0, 0);
+        at(c.ne, 1, 0);
+        at(c.sw, 0, 1);
+        at(c.se, 1, 1);
+    };
+    quad(q.nw, 0, 0);
+    quad(q.ne, 2, 0);
+    quad(q.sw, 0, 2);
+    quad(q.se, 2, 2);
+    auto const next = base_[cells];
+    auto const leaf = [next](int bit) {
+        return ((next >> bit) & 1) != 0 ? alive : dead;
+    };
+    return this->join(leaf(0), leaf(1), leaf(2), leaf(3));
+}
+
+auto Hashlife::center(Id n) -> Id
+{
+    auto const node = nodes_[n];
+    return this->join(nodes_[node.nw].se, nodes_[node.ne].sw,
+                      nodes_[node.sw].ne, nodes_[node.se].nw);
+}
+
+void Hashlife::expand()
+{
+    auto const r  = nodes_[root_];
+    auto const e  = this->empty(r.level - 1);
+    auto const nw = this->join(e, e, e, r.nw);
+    auto const ne = this->join(e, e, r.ne, e);
+    auto const sw = this->join(e, r.sw, e, e);
+    auto const se = this->join(r.se, e, e, e);
+    root_         = this->join(nw, ne, sw, se);
+}
+
+auto Hashlife::padded_level() const -> int
+{
+    auto const& r = nodes_[root_];
+
+    // True if every live cell is within the innermost descendants of the
+    // quadrants, \p depth levels down.
+    auto const is_within = [&](int depth) {
+        auto const inner = [&](Id n, Id Node::*toward_center) {
+            for (auto i = 0; i < depth; ++i)
+                n = nodes_[n].*toward_center;
+            return nodes_[n].population;
+        };
+        return inner(r.nw, &Node::se) + inner(r.ne, &Node::sw) +
+                   inner(r.sw, &Node::ne) + inner(r.se, &Node::nw) ==
+               r.population;
+    };
+
+    // Each expand() halves the share of the root's width the cells span.
+    if (is_within(2))
+        return r.level;
+    return is_within(1) ? r.level + 1 : r.level + 2;
+}
+
+void Hashlife::advance(int j)
+{
+    // The pattern must be within the center quarter of the root, and the
+    // root large enough, to not grow past the result in 2^j generations. The
+    // result is one level below the root.
+    auto const level = std::max(this->padded_level(), j + 3);
+    if (level - 1 > max_level)
+        throw std::length_error{"Hashlife: the world would pass max_level."};
+    while (nodes_[root_].level < level)
+        this->expand();
+    root_ = this->result(root_, j);
+}
+
+auto Hashlife::set(Id n, std::int64_t x, std::int64_t y, bool is_alive) -> Id
+{
+    auto const node = nodes_[n];
+    if (node.level == 0)
+        return is_alive ? alive : dead;
+    auto const half = std::int64_t{1} << (node.level - 1);
+    auto const sx   = x % half;
+    auto const sy   = y % half;
+    if (y < half) {
+        if (x < half)
+            return this->join(this->set(node.nw, sx, sy, is_alive), node.ne,
+                              node.sw, node.se);
+        return this->join(node.nw, this->set(node.ne, sx, sy, is_alive),
+                          node.sw, node.se);
+    }
+    if (x < half)
+        return this->join(node.nw, node.ne,
+                          this->set(node.sw, sx, sy, is_alive), node.se);
+    return this->join(node.nw, node.ne, node.sw,
+                      this->set(node.se, sx, sy, is_alive));
+}
+
+void Hashlife::use_rule(Rule const& rule)
+{
+    if (rule.birth == rule_.birth && rule.survival == rule_.survival)
+        return;
+    rule_ = rule;
+    for (auto i = 0; i < (int)base_.size(); ++i)
+        base_[i] = step_center((std::uint16_t)i, rule_);
+    for (auto& node : nodes_)
+        node.result_step = -1;
+}
+
+void Hashlife::trim()
+{
+    if (this->memory_usage() <= memory_budget_)
+        return;
+    this->collect_garbage(true);
+    if (this->memory_usage() > memory_budget_ / 2)
+        this->collect_garbage(false);
+}
+
+void Hashlife::rebuild_table()
+{
+    auto size = std::size_t{1'024};
+    while (size < this->node_count() * 4)
+        size *= 2;
+    table_.assign(size, no_node);
+    auto const mask = size - 1;
+    for (auto id = alive + 1; id < nodes_.size(); ++id) {
+        auto const& n = nodes_[id];
+        if (n.level == freed)
+            continue;
+        auto i = hash(n.nw, n.ne, n.sw, n.se) & mask;
+        while (table_[i] != no_node)
+            i = (i + 1) & mask;
+        table_[i] = id;
+    }
+}
+
+}  // namespace gol
@@ -0,0 +1,184 @@
+#ifndef TERMOX_DEMOS_GAME_OF_LIFE_HASHLIFE_HPP
+#define TERMOX_DEMOS_GAME_OF_LIFE_HASHLIFE_HPP
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <vector>
+
+#include "coordinate.hpp"
+#include "rule.hpp"
+
+namespace gol {
+
+/// Memoized quadtree Life cell storage and stepping, Gosper's HashLife.
+/** The world is a quadtree of canonical nodes, equal subtrees are stored once.
+ *  Each node caches its center some power of two generations ahead, so
+ *  repetitive patterns advance exponentially fast with jump(). Any B/S Rule
+ *  is supported, except that birth on zero neighbors is ignored. The world is
+ *  2^max_level cells across, though only cells within Coordinate's range can
+ *  be set or read. Unreachable nodes and memoized results are collected between generations
+ *  to stay within the memory budget, a single jump() may exceed it. */
+class Hashlife {
+   public:
+    static constexpr auto default_memory_budget = std::size_t{256} << 20;
+
+    /// Largest level of the world, so cell offsets fit in std::int64_t.
+    static constexpr auto max_level = 62;
+
+   public:
+    /// Create an empty world, \p memory_budget is in bytes.
+    explicit Hashlife(std::size_t memory_budget = default_memory_budget);
+
+   public:
+    /// Set the cell at \p c alive or dead.
+    void set(Coordinate c, bool is_alive);
+
+    /// Return true if the cell at \p c is alive.
+    [[nodiscard]] auto is_alive_at(Coordinate c) const -> bool;
+
+    /// Kill every cell.
+    void clear();
+
+    /// Advance one generation with \p rule.
+    /** Throws std::length_error if the world would grow past max_level, the
+     *  cells are then unchanged. */
+    void step(Rule const& rule);
+
+    /// Advance 2^k generations with \p rule.
+    /** Throws std::out_of_range if \p k is not in [0, 60]. Throws
+     *  std::length_error if the world would grow past max_level, the cells are
+     *  then unchanged. */
+    void jump(Rule const& rule, int k);
+
+    /// Return the number of living cells.
+    [[nodiscard]] auto population() const -> std::uint64_t;
+
+    /// Call \p f with the Coordinate of each living cell within range.
+    template <typename F>
+    void for_each_alive(F&& f) const
+    {
+        auto const half = std::int64_t{1} << (nodes_[root_].level - 1);
+        this->for_each_alive(root_, -half, -half, f);
+    }
+
+    /// Set the number of bytes the node store may use.
+    void set_memory_budget(std::size_t bytes);
+
+    /// Return the number of bytes the node store may use.
+    [[nodiscard]] auto memory_budget() const -> std::size_t;
+
+    /// Return the number of bytes currently used by the node store.
+    [[nodiscard]] auto memory_usage() const -> std::size_t;
+
+    /// Return the number of nodes in use.
+    [[nodiscard]] auto node_count() const -> std::size_t;
+
+    /// Free every node not reachable from the world.
+    /** Memoized results are kept if \p keep_results is true and they fit. */
+    void collect_garbage(bool keep_results = true);
+
+   private:
+    using Id = std::uint32_t;
+
+    static constexpr auto no_node = std::numeric_limits<Id>::max();
+    static constexpr auto dead    = Id{0};
+    static constexpr auto alive   = Id{1};
+    static constexpr auto freed   = std::uint8_t{0xFF};  // Level of free nodes.
+
+    struct Node {
+        std::uint64_t population;
+        Id nw;
+        Id ne;
+        Id sw;
+        Id se;
+
+        // Center of this node, 2^result_step generations ahead, if not -1.
+        Id result;
+        std::int8_t result_step;
+
+        std::uint8_t level;  // Side length of 2^level cells.
+        bool is_marked;
+    };
+
+   private:
+    std::vector<Node> nodes_;
+    std::vector<Id> free_;
+
+    // Canonical node of each value, open addressing with linear probing.
+    std::vector<Id> table_;
+
+    // Empty node of each level.
+    std::vector<Id> empty_;
+
+    // Center 2x2 cells of each 4x4 cells one generation ahead, for rule_.
+    std::array<std::uint8_t, 1 << 16> base_;
+    Rule rule_;
+
+    Id root_;
+    std::size_t memory_budget_;
+
+   private:
+    /// Return the canonical node with the given quadrants.
+    auto join(Id nw, Id ne, Id sw, Id se) -> Id;
+
+    /// Return the empty node at \p level.
+    auto empty(int level) -> Id;
+
+    /// Return the center of \p n, one level down, 2^j generations ahead.
+    /** Requires 0 <= j <= level - 2. */
+    auto result(Id n, int j) -> Id;
+
+    /// Step a level 2 node one generation with the base_ table.
+    auto base_result(Id n) -> Id;
+
+    /// Return the center of \p n, one level down.
+    auto center(Id n) -> Id;
+
+    /// Grow the root by one level, keeping the world centered on the origin.
+    void expand();
+
+    /// Return the level the root must be expanded to for advance().
+    /** Live cells must be within the center 1/4 of the root's width. */
+    [[nodiscard]] auto padded_level() const -> int;
+
+    /// Advance the world 2^j generations.
+    /** Throws std::length_error if the result would be past max_level. */
+    void advance(int j);
+
+    /// Return \p n with the cell at \p x, \p y, relative to its top left, set.
+    auto set(Id n, std::int64_t x, std::int64_t y, bool is_alive) -> Id;
+
+    /// Rebuild base_ and drop memoized results if \p rule is new.
+    void use_rule(Rule const& rule);
+
+    /// Collect garbage if over the memory budget.
+    void trim();
+
+    /// Reinsert every live node into a table sized for them.
+    void rebuild_table();
+
+    template <typename F>
+    void for_each_alive(Id n, std::int64_t x, std::int64_t y, F& f) const
+    {
+        auto const& node = nodes_[n];
+        if (node.population == 0)
+            return;
+        if (node.level == 0) {
+            using Limits = std::numeric_limits<Coordinate::Value_t>;
+            if (x >= Limits::min() && x <= Limits::max() &&
+                y >= Limits::min() && y <= Limits::max()) {
+                f(Coordinate{(int)x, (int)y});
+            }
+            return;
+        }
+        auto const half = std::int64_t{1} << (node.level - 1);
+        this->for_each_alive(node.nw, x, y, f);
+        this->for_each_alive(node.ne, x + half, y, f);
+        this->for_each_alive(node.sw, x, y + half, f);
+        this->for_each_alive(node.se, x + half, y + half, f);
+    }
+};
+
+}  // namespace gol
+#endif  // TERMOX_DEMOS_GAME_OF_LIFE_HASHLIFE_HPP
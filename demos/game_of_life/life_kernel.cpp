@@ -0,0 +1,317 @@
+#include "life_kernel.hpp"
+
+#include <algorithm>
+#include <array>
+#include <bitset>
+#include <cstddef>
+#include <cstdint>
+#include <utility>
+#include <vector>
+
+#include <termox/common/thread_pool.hpp>
+
+#include "coordinate.hpp"
+#include "rule.hpp"
+
+namespace {
+
+using Word = std::uint64_t;
+
+/// Two bit result of adding single bits, for each of the 64 bit positions.
+struct Sum {
+    Word low;
+    Word high;
+};
+
+[[nodiscard]] auto half_add(Word a, Word b) -> Sum { return {a ^ b, a & b}; }
+
+[[nodiscard]] auto full_add(Word a, Word b, Word c) -> Sum
+{
+    auto const partial = a ^ b;
+    return {partial ^ c, (a & b) | (partial & c)};
+}
+
+/// Neighbor count for each of the 64 cells in a row, as four bit slices.
+struct Count {
+    Word ones;
+    Word twos;
+    Word fours;
+    Word eights;
+};
+
+/// Add the eight neighbor words of a row with a carry-save adder network.
+[[nodiscard]] auto count_neighbors(std::array<Word, 8> const& n) -> Count
+{
+    auto const a     = full_add(n[0], n[1], n[2]);
+    auto const b     = full_add(n[3], n[4], n[5]);
+    auto const c     = half_add(n[6], n[7]);
+    auto const ones  = full_add(a.low, b.low, c.low);
+    auto const t     = full_add(a.high, b.high, c.high);
+    auto const twos  = half_add(t.low, ones.high);
+    auto const fours = half_add(t.high, twos.high);
+    return {ones.low, twos.low, fours.low, fours.high};
+}
+
+/// Return a mask of the cells in \p c with exactly \p n neighbors.
+[[nodiscard]] auto equals(Count const& c, int n) -> Word
+{
+    return ((n & 1) != 0 ? c.ones : ~c.ones) &
+           ((n & 2) != 0 ? c.twos : ~c.twos) &
+           ((n & 4) != 0 ? c.fours : ~c.fours) &
+           ((n & 8) != 0 ? c.eights : ~c.eights);
+}
+
+/// Return true if \p v is within the bounded world.
+[[nodiscard]] auto is_in_bounds(int v) -> bool
+{
+    return v >= -gol::Life_kernel::outer_bound &&
+           v <= gol::Life_kernel::outer_bound;
+}
+
+/// Return the mask of in bound cells of a 64 cell span starting at \p first.
+[[nodiscard]] auto bounds_mask(int first) -> Word
+{
+    auto mask = Word{0};
+    for (auto i = 0; i < 64; ++i) {
+        if (is_in_bounds(first + i))
+            mask |= Word{1} << i;
+    }
+    return mask;
+}
+
+[[nodiscard]] auto is_empty(std::array<Word, 64> const& rows) -> bool
+{
+    return std::all_of(std::cbegin(rows), std::cend(rows),
+                       [](Word w) { return w == 0; });
+}
+
+}  // namespace
+
+namespace gol {
+
+Life_kernel::Life_kernel()
+    : grid_(tiles_per_side * tiles_per_side, no_tile),
+      marks_(tiles_per_side * tiles_per_side, 0),
+      is_active_(tiles_per_side * tiles_per_side, 0)
+{}
+
+void Life_kernel::set(Coordinate c, bool is_alive)
+{
+    if (!is_in_bounds(c.x) || !is_in_bounds(c.y))
+        return;
+    auto const x  = c.x + tile_origin;
+    auto const y  = c.y + tile_origin;
+    auto const at = std::size_t(y / tile_length * tiles_per_side +
+                                x / tile_length);
+    if (!is_alive && grid_[at] == no_tile)
+        return;
+    auto& row       = this->tile_at(at).cells[y % tile_length];
+    auto const mask = Word{1} << (x % tile_length);
+    row             = is_alive ? (row | mask) : (row & ~mask);
+    this->activate(at);
+}
+
+auto Life_kernel::is_alive_at(Coordinate c) const -> bool
+{
+    auto const x = c.x + tile_origin;
+    auto const y = c.y + tile_origin;
+    if (x < 0 || y < 0 || x >= tiles_per_side * tile_length ||
+        y >= tiles_per_side * tile_length) {
+        return false;
+    }
+    auto const& rows = this->rows_at(x / tile_length, y / tile_length);
+    return ((rows[y % tile_length] >> (x % tile_length)) & 1) != 0;
+}
+
+void Life_kernel::clear()
+{
+    tiles_.clear();
+    free_tiles_.clear();
+    active_.clear();
+    std::fill(std::begin(grid_), std::end(grid_), no_tile);
+    std::fill(std::begin(is_active_), std::end(is_active_), 0);
+}
+
+void Life_kernel::step(Rule const& rule)
+{
+    auto terms = std::vector<Rule_term>{};
+    for (auto n = 0; n < 9; ++n) {
+        if (rule.birth[n] || rule.survival[n])
+            terms.push_back({n, rule.birth[n], rule.survival[n]});
+    }
+
+    // Active tiles and their neighbors, each once.
+    if (++stamp_ == 0) {
+        std::fill(std::begin(marks_), std::end(marks_), 0);
+        stamp_ = 1;
+    }
+    candidates_.clear();
+    for (auto const at : active_) {
+        is_active_[at] = 0;
+        auto const x   = (int)(at % tiles_per_side);
+        auto const y   = (int)(at / tiles_per_side);
+        for (auto ny = std::max(y - 1, 0);
+             ny <= std::min(y + 1, tiles_per_side - 1); ++ny) {
+            for (auto nx = std::max(x - 1, 0);
+                 nx <= std::min(x + 1, tiles_per_side - 1); ++nx) {
+                auto const n = std::size_t(ny * tiles_per_side + nx);
+                if (marks_[n] != stamp_) {
+                    marks_[n] = stamp_;
+                    candidates_.push_back(n);
+                }
+            }
+        }
+    }
+    active_.clear();
+
+    // Allocate first, compute_next() only reads other tiles.
+    for (auto const at : candidates_)
+        (void)this->tile_at(at);
+
+    changed_.assign(candidates_.size(), 0);
+    auto const compute = [this, &terms](std::size_t i) {
+        changed_[i] = this->compute_next(tiles_[grid_[candidates_[i]]], terms);
+    };
+    if (candidates_.size() < 256) {
+        for (auto i = std::size_t{0}; i < candidates_.size(); ++i)
+            compute(i);
+    }
+    else
+        ox::shared_thread_pool().parallel_for(0, candidates_.size(), compute);
+
+    for (auto i = std::size_t{0}; i < candidates_.size(); ++i) {
+        auto const at = candidates_[i];
+        auto& tile    = tiles_[grid_[at]];
+        tile.cells    = tile.next;
+        if (changed_[i] != 0)
+            this->activate(at);
+        else if (is_empty(tile.cells))
+            this->release(at);
+    }
+}
+
+void Life_kernel::activate_all()
+{
+    for (auto at = std::size_t{0}; at < grid_.size(); ++at) {
+        if (grid_[at] != no_tile)
+            this->activate(at);
+    }
+}
+
+auto Life_kernel::population() const -> std::size_t
+{
+    auto count = std::size_t{0};
+    for (auto const at : grid_) {
+        if (at == no_tile)
+            continue;
+        for (auto const row : tiles_[at].cells)
+            count += std::bitset<64>{row}.count();
+    }
+    return count;
+}
+
+auto Life_kernel::active_tile_count() const -> std::size_t
+{
+    return active_.size();
+}
+
+auto Life_kernel::tile_at(std::size_t at) -> Tile&
+{
+    if (grid_[at] == no_tile) {
+        auto const x = (int)(at % tiles_per_side);
+        auto const y = (int)(at / tiles_per_side);
+        if (free_tiles_.empty()) {
+            grid_[at] = tiles_.size();
+            tiles_.push_back({Rows{}, Rows{}, x, y});
+        }
+        else {
+            grid_[at] = free_tiles_.back();
+            free_tiles_.pop_back();
+            tiles_[grid_[at]] = {Rows{}, Rows{}, x, y};
+        }
+    }
+    return tiles_[grid_[at]];
+}
+
+auto Life_kernel::rows_at(int x, int y) const -> Rows const&
+{
+    static auto const empty = Rows{};
+    if (x < 0 || y < 0 || x >= tiles_per_side || y >= tiles_per_side)
+        return empty;
+    auto const at = grid_[std::size_t(y * tiles_per_side + x)];
+    return at == no_tile ? empty : tiles_[at].cells;
+}
+
+auto Life_kernel::compute_next(Tile& tile,
+                               std::vector<Rule_term> const& terms) const
+    -> bool
+{
+    auto constexpr n = tile_length;
+
+    // Rows -1 through 64 of the tile's column and the columns either side.
+    auto west   = std::array<Word, n + 2>{};
+    auto middle = std::array<Word, n + 2>{};
+    auto east   = std::array<Word, n + 2>{};
+    for (auto dx = -1; dx <= 1; ++dx) {
+        auto& column      = dx == -1 ? west : dx == 0 ? middle : east;
+        auto const& above = this->rows_at(tile.x + dx, tile.y - 1);
+        auto const& rows  = this->rows_at(tile.x + dx, tile.y);
+        auto const& below = this->rows_at(tile.x + dx, tile.y + 1);
+        column[0]         = above[n - 1];
+        std::copy(std::cbegin(rows), std::cend(rows), std::begin(column) + 1);
+        column[n + 1] = below[0];
+    }
+
+    // Bit i of left holds the west neighbor of cell i, right holds the east.
+    auto left  = std::array<Word, n + 2>{};
+    auto right = std::array<Word, n + 2>{};
+    for (auto k = 0; k < n + 2; ++k) {
+        left[k]  = (middle[k] << 1) | (west[k] >> (n - 1));
+        right[k] = (middle[k] >> 1) | (east[k] << (n - 1));
+    }
+
+    for (auto r = 0; r < n; ++r) {
+        auto const k     = r + 1;
+        auto const count = count_neighbors(
+            {left[k - 1], middle[k - 1], right[k - 1], left[k], right[k],
+             left[k + 1], middle[k + 1], right[k + 1]});
+        auto birth    = Word{0};
+        auto survival = Word{0};
+        for (auto const& term : terms) {
+            auto const matches = equals(count, term.count);
+            if (term.birth)
+                birth |= matches;
+            if (term.survival)
+                survival |= matches;
+        }
+        auto const alive = middle[k];
+        tile.next[r]     = (alive & survival) | (~alive & birth);
+    }
+
+    // Clip to the bounded world.
+    auto const first_x = tile.x * n - tile_origin;
+    auto const first_y = tile.y * n - tile_origin;
+    if (!is_in_bounds(first_x) || !is_in_bounds(first_x + n - 1) ||
+        !is_in_bounds(first_y) || !is_in_bounds(first_y + n - 1)) {
+        auto const mask = bounds_mask(first_x);
+        for (auto r = 0; r < n; ++r)
+            tile.next[r] &= is_in_bounds(first_y + r) ? mask : 0;
+    }
+    return tile.next != tile.cells;
+}
+
+void Life_kernel::activate(std::size_t at)
+{
+    if (is_active_[at] == 0) {
+        is_active_[at] = 1;
+        active_.push_back(at);
+    }
+}
+
+void Life_kernel::release(std::size_t at)
+{
+    free_tiles_.push_back(grid_[at]);
+    grid_[at] = no_tile;
+}
+
+}  // namespace gol
@@ -0,0 +1,126 @@
+#ifndef TERMOX_DEMOS_GAME_OF_LIFE_LIFE_KERNEL_HPP
+#define TERMOX_DEMOS_GAME_OF_LIFE_LIFE_KERNEL_HPP
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+#include "coordinate.hpp"
+#include "rule.hpp"
+
+namespace gol {
+
+/// Bit-parallel Life cell storage and stepping.
+/** Cells are stored in 64x64 tiles, each row of a tile is a single 64 bit word.
+ *  A generation is computed 64 cells at a time with a bit sliced adder
+ *  network, for any B/S Rule. Only tiles that changed in the last generation,
+ *  and their neighbors, are stepped; empty tiles are not stored. The world is
+ *  bounded, cells outside of [-outer_bound, outer_bound] on either axis are
+ *  always dead. */
+class Life_kernel {
+   public:
+    static constexpr auto outer_bound = 5'000;
+
+   public:
+    Life_kernel();
+
+   public:
+    /// Set the cell at \p c alive or dead. No-op if \p c is out of bounds.
+    void set(Coordinate c, bool is_alive);
+
+    /// Return true if the cell at \p c is alive.
+    [[nodiscard]] auto is_alive_at(Coordinate c) const -> bool;
+
+    /// Kill every cell.
+    void clear();
+
+    /// Compute the next generation of every active tile with \p rule.
+    void step(Rule const& rule);
+
+    /// Mark every stored tile as active, used when the Rule changes.
+    void activate_all();
+
+    /// Return the number of living cells.
+    [[nodiscard]] auto population() const -> std::size_t;
+
+    /// Return the number of tiles that will be stepped by the next step().
+    [[nodiscard]] auto active_tile_count() const -> std::size_t;
+
+    /// Call \p f with the Coordinate of each living cell.
+    template <typename F>
+    void for_each_alive(F&& f) const
+    {
+        for (auto const at : grid_) {
+            if (at == no_tile)
+                continue;
+            auto const& tile = tiles_[at];
+            auto const x     = tile.x * tile_length - tile_origin;
+            auto const y     = tile.y * tile_length - tile_origin;
+            for (auto r = 0; r < tile_length; ++r) {
+                auto const row = tile.cells[r];
+                for (auto i = 0; row != 0 && i < tile_length; ++i) {
+                    if (((row >> i) & 1) != 0)
+                        f(Coordinate{x + i, y + r});
+                }
+            }
+        }
+    }
+
+   private:
+    static constexpr auto tile_length    = 64;
+    static constexpr auto tiles_per_side = 160;  // Covers [-5'120, 5'120).
+    static constexpr auto tile_origin    = tiles_per_side * tile_length / 2;
+
+    using Rows = std::array<std::uint64_t, tile_length>;
+
+    struct Tile {
+        Rows cells;
+        Rows next;
+        int x;  // Tile grid position, not cell Coordinates.
+        int y;
+    };
+
+    /// Bit sliced neighbor count value and the rule outcomes for it.
+    struct Rule_term {
+        int count;
+        bool birth;
+        bool survival;
+    };
+
+   private:
+    std::vector<Tile> tiles_;
+    std::vector<std::size_t> free_tiles_;
+
+    // Index into tiles_ for each grid position, or no_tile.
+    std::vector<std::size_t> grid_;
+
+    // Grid positions to step next, and scratch space for step().
+    std::vector<std::size_t> active_;
+    std::vector<std::size_t> candidates_;
+    std::vector<std::uint32_t> marks_;
+    std::uint32_t stamp_ = 0;
+    std::vector<std::uint8_t> is_active_;
+    std::vector<std::uint8_t> changed_;  // Written by multiple threads.
+
+    static constexpr auto no_tile = static_cast<std::size_t>(-1);
+
+   private:
+    /// Return the Tile at grid position \p at, allocating it if needed.
+    auto tile_at(std::size_t at) -> Tile&;
+
+    /// Return the rows of the tile at grid \p x, \p y, all zero if not stored.
+    [[nodiscard]] auto rows_at(int x, int y) const -> Rows const&;
+
+    /// Compute next from cells for \p tile, return true if it changed.
+    auto compute_next(Tile& tile,
+                      std::vector<Rule_term> const& terms) const -> bool;
+
+    /// Add grid position \p at to the tiles stepped next, if not already.
+    void activate(std::size_t at);
+
+    /// Return the tile at grid position \p at to the free list.
+    void release(std::size_t at);
+};
+
+}  // namespace gol
+#endif  // TERMOX_DEMOS_GAME_OF_LIFE_LIFE_KERNEL_HPP
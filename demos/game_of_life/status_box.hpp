@@ -18,10 +18,13 @@
 
 namespace gol {
 
-class Generation_count : public ox::HPair<ox::HLabel, ox::Int_view> {
+class Generation_count
+    : public ox::HPair<ox::HLabel, ox::Number_view<std::uint64_t>> {
    public:
     Generation_count()
-        : ox::HPair<ox::HLabel, ox::Int_view>{{U"Generation"}, {0}}
+        : ox::HPair<ox::HLabel, ox::Number_view<std::uint64_t>>{
+              {U"Generation"},
+              {0}}
     {
         using namespace ox::pipe;
         *this | fixed_height(1) | hide_cursor();
@@ -30,11 +33,11 @@ class Generation_count : public ox::HPair<ox::HLabel, ox::Int_view> {
     }
 
    public:
-    void update_count(std::uint32_t count) { count_.set_value(count); }
+    void update_count(std::uint64_t count) { count_.set_value(count); }
 
    private:
-    ox::HLabel& title_   = this->first;
-    ox::Int_view& count_ = this->second;
+    ox::HLabel& title_                     = this->first;
+    ox::Number_view<std::uint64_t>& count_ = this->second;
 };
 
 struct Coord_view : ox::HPair<ox::HLabel, ox::Int_edit> {
@@ -57,7 +60,7 @@ struct Coord_view : ox::HPair<ox::HLabel, ox::Int_edit> {
 
 struct Center_offset : ox::VTuple<ox::HLabel, Coord_view, Coord_view> {
    public:
-    ox::HLabel& title_   = this->get<0>();
+    ox::HLabel& title_                     = this->get<0>();
     Coord_view& x_coords = this->get<1>();
     Coord_view& y_coords = this->get<2>();
 
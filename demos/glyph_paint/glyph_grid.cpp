@@ -0,0 +1,80 @@
+#include "glyph_grid.hpp"
+
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+
+#include <termox/painter/glyph.hpp>
+#include <termox/widget/point.hpp>
+
+namespace {
+
+/// Return the bit of the occupancy word for column \p x.
+[[nodiscard]] auto bit(int x) -> std::uint64_t
+{
+    return std::uint64_t{1} << (x % paint::Glyph_grid::chunk_width);
+}
+
+/// Return the index into Chunk::glyphs for \p p.
+[[nodiscard]] auto cell(ox::Point p) -> std::size_t
+{
+    using paint::Glyph_grid;
+    return (p.y % Glyph_grid::chunk_height) * Glyph_grid::chunk_width +
+           (p.x % Glyph_grid::chunk_width);
+}
+
+}  // namespace
+
+namespace paint {
+
+void Glyph_grid::set(ox::Point p, ox::Glyph g)
+{
+    if (p.x < 0 || p.y < 0)
+        return;
+    auto const row = static_cast<std::size_t>(p.y / chunk_height);
+    if (row >= chunk_rows_.size())
+        chunk_rows_.resize(row + 1);
+    auto& chunks      = chunk_rows_[row];
+    auto const column  = static_cast<std::size_t>(p.x / chunk_width);
+    if (column >= chunks.size())
+        chunks.resize(column + 1);
+    if (chunks[column] == nullptr)
+        chunks[column] = std::make_unique<Chunk>();
+    auto& chunk = *chunks[column];
+    chunk.painted[p.y % chunk_height] |= bit(p.x);
+    chunk.glyphs[cell(p)] = g;
+}
+
+void Glyph_grid::erase(ox::Point p)
+{
+    if (auto* const chunk = this->chunk_at(p); chunk != nullptr)
+        chunk->painted[p.y % chunk_height] &= ~bit(p.x);
+}
+
+auto Glyph_grid::find(ox::Point p) const -> ox::Glyph const*
+{
+    auto const* const chunk = this->chunk_at(p);
+    if (chunk == nullptr ||
+        (chunk->painted[p.y % chunk_height] & bit(p.x)) == 0) {
+        return nullptr;
+    }
+    return &chunk->glyphs[cell(p)];
+}
+
+void Glyph_grid::clear() { chunk_rows_.clear(); }
+
+auto Glyph_grid::chunk_at(ox::Point p) const -> Chunk*
+{
+    if (p.x < 0 || p.y < 0)
+        return nullptr;
+    auto const row = static_cast<std::size_t>(p.y / chunk_height);
+    if (row >= chunk_rows_.size())
+        return nullptr;
+    auto const& chunks = chunk_rows_[row];
+    auto const column  = static_cast<std::size_t>(p.x / chunk_width);
+    if (column >= chunks.size())
+        return nullptr;
+    return chunks[column].get();
+}
+
+}  // namespace paint
@@ -0,0 +1,99 @@
+#ifndef DEMOS_GLYPH_PAINT_GLYPH_GRID_HPP
+#define DEMOS_GLYPH_PAINT_GLYPH_GRID_HPP
+#include <algorithm>
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <vector>
+
+#include <termox/painter/glyph.hpp>
+#include <termox/widget/area.hpp>
+#include <termox/widget/point.hpp>
+
+namespace paint {
+
+/// Painted Glyphs of the canvas, stored in dense chunks allocated on demand.
+/** Each Chunk holds a block of Glyphs and a bit per cell marking which are
+ *  painted, so setting, erasing and finding a cell is a couple of indexing
+ *  operations, and empty rows of a Chunk are skipped a word at a time. Points
+ *  with a negative coordinate are never painted. */
+class Glyph_grid {
+   public:
+    /// Cells in one Chunk row, the occupancy bits of a row are one word.
+    static constexpr auto chunk_width = 64;
+
+    /// Rows in one Chunk.
+    static constexpr auto chunk_height = 16;
+
+   public:
+    /// Paint \p g at \p p, replacing any Glyph already there.
+    void set(ox::Point p, ox::Glyph g);
+
+    /// Remove the Glyph at \p p, if any.
+    void erase(ox::Point p);
+
+    /// Return the Glyph painted at \p p, or nullptr if there is none.
+    [[nodiscard]] auto find(ox::Point p) const -> ox::Glyph const*;
+
+    /// Remove every Glyph and release all Chunks.
+    void clear();
+
+    /// Return one past the last row that might hold a painted Glyph.
+    [[nodiscard]] auto height() const -> int
+    {
+        return static_cast<int>(chunk_rows_.size()) * chunk_height;
+    }
+
+    /// Call \p f(x, glyph) for each painted Glyph of row \p y, left to right.
+    template <typename F>
+    void for_each_in_row(int y, F&& f) const
+    {
+        if (y < 0 || y >= this->height())
+            return;
+        auto const& chunks = chunk_rows_[y / chunk_height];
+        auto const row     = y % chunk_height;
+        for (auto i = std::size_t{0}; i < chunks.size(); ++i) {
+            if (chunks[i] == nullptr)
+                continue;
+            auto const& chunk = *chunks[i];
+            auto const left   = static_cast<int>(i) * chunk_width;
+            auto x            = 0;
+            for (auto bits = chunk.painted[row]; bits != 0; bits >>= 1, ++x) {
+                if ((bits & 1) != 0)
+                    f(left + x, chunk.glyphs[row * chunk_width + x]);
+            }
+        }
+    }
+
+    /// Call \p f(point, glyph) for each painted Glyph within \p bounds.
+    /** \p bounds is measured from the origin. */
+    template <typename F>
+    void for_each_within(ox::Area bounds, F&& f) const
+    {
+        auto const rows = std::min(bounds.height, this->height());
+        for (auto y = 0; y < rows; ++y) {
+            this->for_each_in_row(y, [&](int x, ox::Glyph const& g) {
+                if (x < bounds.width)
+                    f(ox::Point{x, y}, g);
+            });
+        }
+    }
+
+   private:
+    struct Chunk {
+        std::array<std::uint64_t, chunk_height> painted = {};
+        std::array<ox::Glyph, chunk_width * chunk_height> glyphs;
+    };
+
+    using Chunk_row = std::vector<std::unique_ptr<Chunk>>;
+
+    std::vector<Chunk_row> chunk_rows_;
+
+   private:
+    /// Return the Chunk holding \p p, nullptr if it has not been allocated.
+    [[nodiscard]] auto chunk_at(ox::Point p) const -> Chunk*;
+};
+
+}  // namespace paint
+#endif  // DEMOS_GLYPH_PAINT_GLYPH_GRID_HPP
@@ -1,23 +1,22 @@
 #include "paint_area.hpp"
 
 #include <cctype>
-#include <codecvt>
 #include <cstddef>
 #include <cwctype>
 #include <iostream>
 #include <iterator>
-#include <locale>
 #include <optional>
+#include <stdexcept>
 #include <string>
+#include <string_view>
 #include <utility>
 
 #include <signals_light/signal.hpp>
 
-#include <termox/common/u32_to_mb.hpp>
+#include <termox/common/utf8.hpp>
 #include <termox/painter/brush.hpp>
 #include <termox/painter/color.hpp>
 #include <termox/painter/glyph.hpp>
-#include <termox/painter/glyph_string.hpp>
 #include <termox/painter/trait.hpp>
 #include <termox/system/key.hpp>
 #include <termox/widget/detail/link_lifetimes.hpp>
@@ -29,19 +28,18 @@ using namespace ox;
 
 namespace {
 
-void insert_newline(Point first, Point second, std::ostream& os)
+/// Decode \p line into \p out, one symbol per byte if it is not UTF-8.
+void decode_row(std::string_view line, std::u32string& out)
 {
-    if (first.y >= second.y)
-        return;
-    os << std::string(second.y - first.y, '\n');
-}
-
-void insert_space(Point first, Point second, std::ostream& os)
-{
-    auto spaces_n = second.x;
-    if (first.y == second.y)
-        spaces_n -= first.x + 1;
-    os << std::string(spaces_n, ' ');
+    out.resize(line.size());
+    try {
+        out.resize(utf8_decode(line, out.data()));
+    }
+    catch (std::runtime_error const&) {
+        out.assign(std::begin(line), std::end(line));
+        for (auto& c : out)
+            c &= 0xFF;
+    }
 }
 
 }  // namespace
@@ -50,31 +48,37 @@ namespace paint {
 
 void Paint_area::write(std::ostream& os)
 {
-    auto previous_nl = Point{0, 0};
-    auto previous_s  = Point{0, -1};
-    for (auto const& [point, glyph] : glyphs_painted_) {
-        insert_newline(previous_nl, point, os);
-        insert_space(previous_s, point, os);
-        os << ox::u32_to_mb(glyph.symbol);
-        previous_nl = point;
-        previous_s  = point;
+    // Each row, preceded by the newlines since the last row written, is
+    // encoded into one buffer and written with a single call.
+    auto buffer     = std::string{};
+    auto previous_y = 0;
+    for (auto y = 0; y < glyphs_painted_.height(); ++y) {
+        buffer.assign(y - previous_y, '\n');
+        auto const start = buffer.size();
+        auto next_x      = 0;
+        glyphs_painted_.for_each_in_row(y, [&](int x, Glyph const& g) {
+            buffer.append(x - next_x, ' ');
+            char bytes[4];
+            buffer.append(bytes, utf8_encode(g.symbol, bytes));
+            next_x = x + 1;
+        });
+        if (buffer.size() == start)
+            continue;
+        os.write(buffer.data(), buffer.size());
+        previous_y = y;
     }
 }
 
 void Paint_area::read(std::istream& is)
 {
     this->clear();
-    auto at = Point{0, 0};
-    is >> std::noskipws;
-    auto const text = Glyph_string{std::istream_iterator<char>{is},
-                                   std::istream_iterator<char>()};
-    for (auto const& glyph : text) {
-        if (!std::iswspace(glyph.symbol))
-            glyphs_painted_[at] = glyph;
-        ++at.x;
-        if (glyph.symbol == U'\n') {
-            ++at.y;
-            at.x = 0;
+    auto line    = std::string{};
+    auto symbols = std::u32string{};
+    for (auto y = 0; std::getline(is, line); ++y) {
+        decode_row(line, symbols);
+        for (auto x = 0; x < static_cast<int>(symbols.size()); ++x) {
+            if (!std::iswspace(symbols[x]))
+                glyphs_painted_.set({x, y}, Glyph{symbols[x]});
         }
     }
 }
@@ -126,15 +130,15 @@ auto Paint_area::key_press_event(Key k) -> bool
 void Paint_area::place_glyph(ox::Point p)
 {
     if (clone_enabled_) {
-        if (glyphs_painted_.count(p) == 1) {
-            this->set_glyph(glyphs_painted_[p]);
+        if (auto const* g = glyphs_painted_.find(p); g != nullptr) {
+            this->set_glyph(*g);
             this->toggle_clone();
         }
     }
     else if (erase_enabled_)
         this->remove_glyph(p);
     else {
-        glyphs_painted_[p] = current_glyph_;
+        glyphs_painted_.set(p, current_glyph_);
         this->update();
     }
 }
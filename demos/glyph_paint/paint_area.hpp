@@ -2,7 +2,6 @@
 #define DEMOS_GLYPH_PAINT_PAINT_AREA_HPP
 #include <cstddef>
 #include <iostream>
-#include <map>
 
 #include <signals_light/signal.hpp>
 
@@ -15,6 +14,8 @@
 #include <termox/widget/pipe.hpp>
 #include <termox/widget/widget.hpp>
 
+#include "glyph_grid.hpp"
+
 namespace paint {
 
 class Paint_area : public ox::Widget {
@@ -120,11 +121,9 @@ class Paint_area : public ox::Widget {
    protected:
     auto paint_event(ox::Painter& p) -> bool override
     {
-        auto const a = this->area();
-        for (auto const& [at, glyph] : glyphs_painted_) {
-            if (at.x < a.width && at.y < a.height)
-                p.put(glyph, at);
-        }
+        glyphs_painted_.for_each_within(
+            this->area(),
+            [&p](ox::Point at, ox::Glyph const& glyph) { p.put(glyph, at); });
         return Widget::paint_event(p);
     }
 
@@ -135,8 +134,8 @@ class Paint_area : public ox::Widget {
             case Button::Left: this->place_glyph(m.at); break;
             case Button::Right: this->remove_glyph(m.at); break;
             case Button::Middle:
-                if (glyphs_painted_.count(m.at) == 1)
-                    this->set_glyph(glyphs_painted_[m.at]);
+                if (auto const* g = glyphs_painted_.find(m.at); g != nullptr)
+                    this->set_glyph(*g);
                 break;
             default: break;
         }
@@ -150,8 +149,8 @@ class Paint_area : public ox::Widget {
             case Button::Left: this->place_glyph(m.at); break;
             case Button::Right: this->remove_glyph(m.at); break;
             case Button::Middle:
-                if (glyphs_painted_.count(m.at) == 1)
-                    this->set_glyph(glyphs_painted_[m.at]);
+                if (auto const* g = glyphs_painted_.find(m.at); g != nullptr)
+                    this->set_glyph(*g);
                 break;
             default: break;
         }
@@ -161,7 +160,7 @@ class Paint_area : public ox::Widget {
     auto key_press_event(ox::Key k) -> bool override;
 
    private:
-    std::map<ox::Point, ox::Glyph> glyphs_painted_;
+    Glyph_grid glyphs_painted_;
     ox::Glyph current_glyph_ = U'x';
     ox::Glyph before_erase_  = U'x';
     bool clone_enabled_      = false;
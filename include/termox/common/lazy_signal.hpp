@@ -0,0 +1,92 @@
+#ifndef TERMOX_COMMON_LAZY_SIGNAL_HPP
+#define TERMOX_COMMON_LAZY_SIGNAL_HPP
+#include <memory>
+#include <utility>
+
+#include <signals_light/signal.hpp>
+
+namespace ox {
+
+template <typename Signature>
+class Lazy_signal;
+
+/// An sl::Signal that is only allocated on the first call to connect().
+/** Takes the space of a single pointer until something is connected, emitting
+ *  an unconnected Lazy_signal is a no-op. Intended for the many event Signals
+ *  of each Widget, where most are never connected to. */
+template <typename R, typename... Args>
+class Lazy_signal<R(Args...)> {
+   public:
+    using Signal_t = sl::Signal<R(Args...)>;
+
+   public:
+    Lazy_signal() = default;
+
+    Lazy_signal(Lazy_signal const&) = delete;
+    Lazy_signal(Lazy_signal&&)      = default;
+    auto operator=(Lazy_signal const&) -> Lazy_signal& = delete;
+    auto operator=(Lazy_signal&&) -> Lazy_signal& = default;
+
+   public:
+    /// Connect \p slot to the Signal, allocating the Signal if needed.
+    /** Returns the Signal's connection identifier. */
+    template <typename Slot_t>
+    auto connect(Slot_t&& slot)
+    {
+        return this->get().connect(std::forward<Slot_t>(slot));
+    }
+
+    /// Disconnect the Slot at \p id. No-op if nothing has been connected.
+    template <typename Identifier>
+    void disconnect(Identifier id)
+    {
+        if (signal_ != nullptr)
+            signal_->disconnect(id);
+    }
+
+    /// Disconnect all Slots. Keeps the Signal allocated.
+    void disconnect_all()
+    {
+        if (signal_ != nullptr)
+            signal_->disconnect_all();
+    }
+
+    /// Call each connected Slot with \p args.
+    /** Returns a default constructed result if nothing has been connected. */
+    template <typename... Arguments>
+    auto emit(Arguments&&... args) const
+    {
+        using Result_t = decltype(std::declval<Signal_t const&>().emit(
+            std::forward<Arguments>(args)...));
+        if (signal_ == nullptr)
+            return Result_t();
+        return signal_->emit(std::forward<Arguments>(args)...);
+    }
+
+    /// Call each connected Slot with \p args.
+    template <typename... Arguments>
+    auto operator()(Arguments&&... args) const
+    {
+        return this->emit(std::forward<Arguments>(args)...);
+    }
+
+    /// Return true if connect() has allocated the underlying Signal.
+    [[nodiscard]] auto is_allocated() const -> bool
+    {
+        return signal_ != nullptr;
+    }
+
+    /// Return the underlying Signal, allocating it if needed.
+    [[nodiscard]] auto get() -> Signal_t&
+    {
+        if (signal_ == nullptr)
+            signal_ = std::make_unique<Signal_t>();
+        return *signal_;
+    }
+
+   private:
+    std::unique_ptr<Signal_t> signal_ = nullptr;
+};
+
+}  // namespace ox
+#endif  // TERMOX_COMMON_LAZY_SIGNAL_HPP
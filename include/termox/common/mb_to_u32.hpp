@@ -6,7 +6,8 @@
 namespace ox {
 
 /// Multi-byte string to char32_t string conversion.
-/** Depends on the currently set clocale to transform the bytes. */
+/** Uses the locale independent UTF-8 codec if the current clocale is UTF-8,
+ *  otherwise depends on the currently set clocale to transform the bytes. */
 [[nodiscard]] auto mb_to_u32(std::string_view sv) -> std::u32string;
 
 }  // namespace ox
@@ -0,0 +1,82 @@
+#ifndef TERMOX_COMMON_RECORD_RING_HPP
+#define TERMOX_COMMON_RECORD_RING_HPP
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+
+namespace ox {
+
+/// Fixed size, lock-free ring of records, each a fixed number of words.
+/** Any number of threads can push() and read() concurrently, writers never
+ *  block. Once full, each push() overwrites the oldest record. Every slot is a
+ *  seqlock, read() reports a record that was overwritten while being copied
+ *  instead of returning a torn copy. Records are numbered in push() order. */
+template <std::size_t Words, std::size_t Capacity>
+class Record_ring {
+   public:
+    using Record = std::array<std::uint64_t, Words>;
+
+    static constexpr auto capacity = Capacity;
+
+   public:
+    /// Append \p r, overwriting the oldest record if full.
+    void push(Record const& r)
+    {
+        auto const i = head_.fetch_add(1, std::memory_order_relaxed);
+        auto& slot   = slots_[i % Capacity];
+        slot.sequence.store(2 * i + 1, std::memory_order_relaxed);
+        std::atomic_thread_fence(std::memory_order_release);
+        for (auto k = std::size_t{0}; k < Words; ++k)
+            slot.words[k].store(r[k], std::memory_order_relaxed);
+        slot.sequence.store(2 * i + 2, std::memory_order_release);
+    }
+
+    /// Copy record \p i into \p out, return false if it is not held.
+    /** Records being written, overwritten or cleared are not held. */
+    [[nodiscard]] auto read(std::uint64_t i, Record& out) const -> bool
+    {
+        auto const& slot  = slots_[i % Capacity];
+        auto const before = slot.sequence.load(std::memory_order_acquire);
+        if (before != 2 * i + 2)
+            return false;
+        for (auto k = std::size_t{0}; k < Words; ++k)
+            out[k] = slot.words[k].load(std::memory_order_relaxed);
+        std::atomic_thread_fence(std::memory_order_acquire);
+        return slot.sequence.load(std::memory_order_relaxed) == before;
+    }
+
+    /// Return the number of the oldest record that might still be held.
+    [[nodiscard]] auto begin() const -> std::uint64_t
+    {
+        auto const end = this->end();
+        return std::max(first_.load(std::memory_order_relaxed),
+                        end > Capacity ? end - Capacity : 0);
+    }
+
+    /// Return the number the next pushed record will have.
+    [[nodiscard]] auto end() const -> std::uint64_t
+    {
+        return head_.load(std::memory_order_acquire);
+    }
+
+    /// Drop every record pushed so far.
+    void clear() { first_.store(this->end(), std::memory_order_relaxed); }
+
+   private:
+    /// Words are atomic so a reader racing a writer is not undefined behavior.
+    /** sequence is odd while the slot is being written, 2 * i + 2 once it
+     *  holds record i. */
+    struct Slot {
+        std::atomic<std::uint64_t> sequence = 0;
+        std::array<std::atomic<std::uint64_t>, Words> words;
+    };
+
+    std::array<Slot, Capacity> slots_;
+    std::atomic<std::uint64_t> head_  = 0;
+    std::atomic<std::uint64_t> first_ = 0;
+};
+
+}  // namespace ox
+#endif  // TERMOX_COMMON_RECORD_RING_HPP
@@ -0,0 +1,107 @@
+#ifndef TERMOX_COMMON_SPAN_HPP
+#define TERMOX_COMMON_SPAN_HPP
+#include <cassert>
+#include <cstddef>
+#include <type_traits>
+#include <vector>
+
+namespace ox {
+
+/// Non-owning view of a contiguous sequence of T, a minimal std::span.
+/** Relies on the viewed memory outliving the Span. */
+template <typename T>
+class Span {
+   public:
+    using element_type    = T;
+    using value_type      = std::remove_cv_t<T>;
+    using size_type       = std::size_t;
+    using difference_type = std::ptrdiff_t;
+    using pointer         = T*;
+    using reference       = T&;
+    using iterator        = T*;
+
+   public:
+    /// Construct an empty Span.
+    constexpr Span() = default;
+
+    /// Construct a view of \p size elements starting at \p data.
+    constexpr Span(T* data, size_type size) : data_{data}, size_{size} {}
+
+    /// Construct a view of the range [first, last).
+    constexpr Span(T* first, T* last)
+        : data_{first}, size_{static_cast<size_type>(last - first)}
+    {}
+
+    /// Construct a view of an entire std::vector.
+    template <typename U,
+              typename = std::enable_if_t<std::is_convertible_v<U*, T*>>>
+    Span(std::vector<U>& v) : data_{v.data()}, size_{v.size()}
+    {}
+
+    /// Construct a view of an entire std::vector.
+    template <typename U,
+              typename = std::enable_if_t<std::is_convertible_v<U const*, T*>>>
+    Span(std::vector<U> const& v) : data_{v.data()}, size_{v.size()}
+    {}
+
+    /// Allow Span<T> to Span<T const> conversion.
+    template <typename U,
+              typename = std::enable_if_t<std::is_convertible_v<U*, T*>>>
+    constexpr Span(Span<U> other) : data_{other.data()}, size_{other.size()}
+    {}
+
+   public:
+    [[nodiscard]] constexpr auto data() const -> T* { return data_; }
+
+    [[nodiscard]] constexpr auto size() const -> size_type { return size_; }
+
+    [[nodiscard]] constexpr auto empty() const -> bool { return size_ == 0; }
+
+    [[nodiscard]] constexpr auto begin() const -> iterator { return data_; }
+
+    [[nodiscard]] constexpr auto end() const -> iterator
+    {
+        return data_ + size_;
+    }
+
+    /// No bounds checking, asserts in debug builds.
+    [[nodiscard]] constexpr auto operator[](size_type i) const -> T&
+    {
+        assert(i < size_);
+        return data_[i];
+    }
+
+    [[nodiscard]] constexpr auto front() const -> T& { return data_[0]; }
+
+    [[nodiscard]] constexpr auto back() const -> T&
+    {
+        return data_[size_ - 1];
+    }
+
+    /// Return a view of \p count elements starting at \p offset.
+    [[nodiscard]] constexpr auto subspan(size_type offset,
+                                         size_type count) const -> Span
+    {
+        assert(offset + count <= size_);
+        return {data_ + offset, count};
+    }
+
+    /// Return a view of the first \p count elements.
+    [[nodiscard]] constexpr auto first(size_type count) const -> Span
+    {
+        return this->subspan(0, count);
+    }
+
+    /// Return a view of the last \p count elements.
+    [[nodiscard]] constexpr auto last(size_type count) const -> Span
+    {
+        return this->subspan(size_ - count, count);
+    }
+
+   private:
+    T* data_        = nullptr;
+    size_type size_ = 0;
+};
+
+}  // namespace ox
+#endif  // TERMOX_COMMON_SPAN_HPP
@@ -0,0 +1,177 @@
+#ifndef TERMOX_COMMON_THREAD_POOL_HPP
+#define TERMOX_COMMON_THREAD_POOL_HPP
+#include <algorithm>
+#include <atomic>
+#include <condition_variable>
+#include <cstddef>
+#include <deque>
+#include <exception>
+#include <functional>
+#include <future>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+namespace ox {
+
+/// Fixed set of worker threads that run submitted tasks.
+/** Each worker has its own task queue. Tasks submitted from a worker go to
+ *  that worker's queue and are run newest first, idle workers steal the oldest
+ *  task from other queues. Tasks submitted from any other thread are spread
+ *  across the queues. The destructor runs every queued task before joining. */
+class Thread_pool {
+   public:
+    /// Start \p thread_count workers, at least one.
+    explicit Thread_pool(
+        std::size_t thread_count = std::thread::hardware_concurrency());
+
+    Thread_pool(Thread_pool const&) = delete;
+    Thread_pool(Thread_pool&&)      = delete;
+    auto operator=(Thread_pool const&) -> Thread_pool& = delete;
+    auto operator=(Thread_pool&&) -> Thread_pool& = delete;
+
+    ~Thread_pool();
+
+   public:
+    /// Run \p f on a worker, the future holds its result or exception.
+    template <typename F>
+    auto submit(F&& f) -> std::future<std::invoke_result_t<std::decay_t<F>>>
+    {
+        using Result_t = std::invoke_result_t<std::decay_t<F>>;
+        auto task      = std::make_shared<std::packaged_task<Result_t()>>(
+            std::forward<F>(f));
+        auto result = task->get_future();
+        this->push([task] { (*task)(); });
+        return result;
+    }
+
+    /// Call \p f(i) for each i in [first, last), blocks until all return.
+    /** Indices are handed out in chunks of \p grain, zero picks a grain that
+     *  gives each worker several chunks. The calling thread runs chunks too, so
+     *  this can be called from within a task. The first exception thrown by
+     *  \p f stops further chunks from starting and is rethrown here. */
+    template <typename F>
+    void parallel_for(std::size_t first,
+                      std::size_t last,
+                      F&& f,
+                      std::size_t grain = 0)
+    {
+        if (first >= last)
+            return;
+        auto const count = last - first;
+        if (grain == 0) {
+            auto const target = this->thread_count() * 4;
+            grain             = std::max(count / target, std::size_t{1});
+        }
+        auto const chunks = (count + grain - 1) / grain;
+        if (chunks == 1) {
+            for (auto i = first; i < last; ++i)
+                f(i);
+            return;
+        }
+
+        auto const state = std::make_shared<Loop_state>();
+        state->chunks    = chunks;
+        auto const run   = [state, first, last, grain, &f] {
+            for (auto c = state->next++; c < state->chunks; c = state->next++) {
+                if (!state->error) {
+                    try {
+                        auto const begin = first + c * grain;
+                        auto const end   = std::min(begin + grain, last);
+                        for (auto i = begin; i < end; ++i)
+                            f(i);
+                    }
+                    catch (...) {
+                        state->fail(std::current_exception());
+                    }
+                }
+                state->finish_chunk();
+            }
+        };
+
+        // Helpers that start late find no chunks left and return at once.
+        auto const helpers = std::min(chunks - 1, this->thread_count());
+        for (auto i = std::size_t{0}; i < helpers; ++i)
+            this->push(run);
+        run();
+        state->wait();
+        if (state->error)
+            std::rethrow_exception(state->exception);
+    }
+
+    /// Return the number of worker threads.
+    [[nodiscard]] auto thread_count() const -> std::size_t;
+
+   private:
+    using Task = std::function<void()>;
+
+    struct Worker {
+        std::mutex mtx;
+        std::deque<Task> tasks;
+    };
+
+    /// Shared by the calling thread and the helpers of one parallel_for.
+    struct Loop_state {
+        std::size_t chunks = 0;
+        std::atomic<std::size_t> next{0};
+        std::atomic<bool> error{false};
+        std::exception_ptr exception;
+        std::mutex mtx;
+        std::condition_variable done;
+        std::size_t finished = 0;
+
+        void fail(std::exception_ptr e)
+        {
+            auto const lock = std::lock_guard{mtx};
+            if (!error) {
+                exception = std::move(e);
+                error     = true;
+            }
+        }
+
+        void finish_chunk()
+        {
+            auto const lock = std::lock_guard{mtx};
+            if (++finished == chunks)
+                done.notify_all();
+        }
+
+        void wait()
+        {
+            auto lock = std::unique_lock{mtx};
+            done.wait(lock, [this] { return finished == chunks; });
+        }
+    };
+
+   private:
+    std::vector<std::unique_ptr<Worker>> workers_;
+    std::vector<std::thread> threads_;
+    std::atomic<std::size_t> next_worker_{0};
+
+    // Queued task count, incremented under sleep_mtx_ so wakeups aren't lost.
+    std::atomic<std::size_t> pending_{0};
+    std::mutex sleep_mtx_;
+    std::condition_variable wake_;
+    bool stop_ = false;
+
+   private:
+    /// Queue \p task, on the calling worker's queue if called from a worker.
+    void push(Task task);
+
+    /// Pop from worker \p index's queue, or steal from another, or return {}.
+    [[nodiscard]] auto take(std::size_t index) -> Task;
+
+    /// Run tasks until stopped with nothing left to run.
+    void work(std::size_t index);
+};
+
+/// Return the process wide Thread_pool, started on first use.
+/** Shared by the library and the demos so that parallel work does not create
+ *  threads per frame. */
+[[nodiscard]] auto shared_thread_pool() -> Thread_pool&;
+
+}  // namespace ox
+#endif  // TERMOX_COMMON_THREAD_POOL_HPP
@@ -6,11 +6,13 @@
 namespace ox {
 
 /// char32_t to Multi-byte char conversion.
-/** Depends on the currently set clocale to transform the bytes. */
+/** Uses the locale independent UTF-8 codec if the current clocale is UTF-8,
+ *  otherwise depends on the currently set clocale to transform the bytes. */
 [[nodiscard]] auto u32_to_mb(char32_t c) -> std::string;
 
 /// char32_t string to Multi-byte string conversion.
-/** Depends on the currently set clocale to transform the bytes. */
+/** Uses the locale independent UTF-8 codec if the current clocale is UTF-8,
+ *  otherwise depends on the currently set clocale to transform the bytes. */
 [[nodiscard]] auto u32_to_mb(std::u32string_view sv) -> std::string;
 
 }  // namespace ox
@@ -0,0 +1,41 @@
+#ifndef TERMOX_COMMON_UTF8_HPP
+#define TERMOX_COMMON_UTF8_HPP
+#include <cstddef>
+#include <string_view>
+
+namespace ox {
+
+/// Return true if the current C locale uses the UTF-8 character encoding.
+/** mb_to_u32() and u32_to_mb() use the locale independent UTF-8 codec below
+ *  when this is true, and the C library's locale dependent functions when it
+ *  is false. The locale is queried on each call, once per converted string. */
+[[nodiscard]] auto is_utf8_locale() -> bool;
+
+/// Decode the UTF-8 bytes of \p bytes into \p out, return the symbol count.
+/** \p out must have space for at least bytes.size() char32_t values. Locale
+ *  independent. Runs of ASCII are processed a machine word at a time. Throws
+ *  std::runtime_error on malformed, overlong, surrogate or out of range
+ *  sequences. */
+[[nodiscard]] auto utf8_decode(std::string_view bytes, char32_t* out)
+    -> std::size_t;
+
+/// Encode \p symbol as UTF-8 into \p out, return the number of bytes written.
+/** \p out must have space for at least four chars. Throws std::runtime_error
+ *  if \p symbol is a surrogate or larger than U+10FFFF. */
+[[nodiscard]] auto utf8_encode(char32_t symbol, char* out) -> std::size_t;
+
+/// Encode \p symbol as UTF-8 into \p out, return the number of bytes written.
+/** \p out must have space for at least four chars. Writes U+FFFD in place of
+ *  a surrogate or a value larger than U+10FFFF, for output that must not
+ *  throw, such as rendering. */
+[[nodiscard]] auto utf8_encode_lossy(char32_t symbol, char* out) noexcept
+    -> std::size_t;
+
+/// Encode \p symbols as UTF-8 into \p out, return the number of bytes written.
+/** \p out must have space for at least symbols.size() * 4 chars. Throws
+ *  std::runtime_error if any symbol is a surrogate or larger than U+10FFFF. */
+[[nodiscard]] auto utf8_encode(std::u32string_view symbols, char* out)
+    -> std::size_t;
+
+}  // namespace ox
+#endif  // TERMOX_COMMON_UTF8_HPP
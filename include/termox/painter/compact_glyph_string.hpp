@@ -0,0 +1,280 @@
+#ifndef TERMOX_PAINTER_COMPACT_GLYPH_STRING_HPP
+#define TERMOX_PAINTER_COMPACT_GLYPH_STRING_HPP
+#include <cstddef>
+#include <iterator>
+#include <string>
+#include <string_view>
+#include <utility>
+#include <vector>
+
+#include <termox/common/mb_to_u32.hpp>
+#include <termox/painter/brush.hpp>
+#include <termox/painter/color.hpp>
+#include <termox/painter/glyph.hpp>
+#include <termox/painter/trait.hpp>
+
+namespace ox {
+class Glyph_string;
+}  // namespace ox
+
+namespace ox {
+
+/// Read-mostly Glyph_string alternative that stores each Brush once per run.
+/** Symbols are held in a std::u32string alongside a run-length list of
+ *  Brushes, about half the memory of a Glyph_string for uniformly styled
+ *  text. Element access returns Glyphs by value, modifications go through
+ *  member functions.
+ *
+ *  Meant for long text that is set once and painted whole with
+ *  Painter::put(Compact_glyph_string const&, Point), such as a read-only
+ *  document or help page. Text_view keeps a Glyph_string: text() hands out a
+ *  Glyph_string& that Textbox and user code edit in place, and paint_event()
+ *  puts each line as a Span of contiguous Glyphs, which this does not have. */
+class Compact_glyph_string {
+   public:
+    /// A Brush applied to every symbol from the previous run's end up to end.
+    struct Run {
+        int end;  // One past the last index covered by this run.
+        Brush brush;
+    };
+
+    /// Random access const_iterator, dereferences to Glyph values.
+    class Iterator;
+
+    using size_type       = int;
+    using value_type      = Glyph;
+    using difference_type = std::ptrdiff_t;
+    using const_iterator  = Iterator;
+    using iterator        = Iterator;
+
+    /// Used to indicate 'Until the end of the string'.
+    static constexpr auto npos = -1;
+
+   public:
+    /// Default constructs an empty Compact_glyph_string.
+    Compact_glyph_string() = default;
+
+    /// Construct with \p symbols as a single run with Brush \p b.
+    Compact_glyph_string(std::u32string symbols, Brush b);
+
+    /// Construct with each char32_t in \p symbols, with a Brush of \p attrs.
+    /** Attributes can be background/foreground Colors and Traits. */
+    template <typename... Attributes>
+    Compact_glyph_string(std::u32string_view symbols, Attributes... attrs)
+        : Compact_glyph_string{std::u32string{symbols}, Brush{attrs...}}
+    {}
+
+    template <typename... Attributes>
+    Compact_glyph_string(char32_t const* symbols, Attributes... attrs)
+        : Compact_glyph_string{std::u32string{symbols}, Brush{attrs...}}
+    {}
+
+    template <typename... Attributes>
+    Compact_glyph_string(std::u32string const& symbols, Attributes... attrs)
+        : Compact_glyph_string{std::u32string{symbols}, Brush{attrs...}}
+    {}
+
+    /// Construct with each character in \p symbols, with a Brush of \p attrs.
+    /** Multi-byte characters are decoded directly into the symbol buffer. */
+    template <typename... Attributes>
+    Compact_glyph_string(std::string_view symbols, Attributes... attrs)
+        : Compact_glyph_string{mb_to_u32(symbols), Brush{attrs...}}
+    {}
+
+    template <typename... Attributes>
+    Compact_glyph_string(char const* symbols, Attributes... attrs)
+        : Compact_glyph_string{std::string_view{symbols}, attrs...}
+    {}
+
+    template <typename... Attributes>
+    Compact_glyph_string(std::string const& symbols, Attributes... attrs)
+        : Compact_glyph_string{std::string_view{symbols}, attrs...}
+    {}
+
+    /// Compress \p gs, adjacent Glyphs with equal Brushes share a single run.
+    explicit Compact_glyph_string(Glyph_string const& gs);
+
+   public:
+    /// Append a single Glyph to the end of *this.
+    auto append(Glyph g) -> Compact_glyph_string&;
+
+    /// Append \p symbols to the end of *this, each with Brush \p b.
+    auto append(std::u32string_view symbols, Brush b) -> Compact_glyph_string&;
+
+    /// Append another Compact_glyph_string to the end of *this.
+    auto append(Compact_glyph_string const& x) -> Compact_glyph_string&;
+
+    /// Append each Glyph of \p gs to the end of *this.
+    auto append(Glyph_string const& gs) -> Compact_glyph_string&;
+
+    /// Insert \p symbols with Brush \p b before \p index.
+    /** \p index can be one past the end, to append. */
+    void insert(int index, std::u32string_view symbols, Brush b);
+
+    /// Remove \p count Glyphs starting at \p index.
+    /** Removes until the end of the string if \p count is npos. */
+    void erase(int index, int count = npos);
+
+    /// Remove all Glyphs.
+    void clear();
+
+    /// Reserve space for \p symbol_count symbols.
+    void reserve(int symbol_count);
+
+   public:
+    /// Return the number of Glyphs in *this.
+    [[nodiscard]] auto size() const -> int;
+
+    /// Return the number of Glyphs in *this.
+    [[nodiscard]] auto length() const -> int;
+
+    /// Return true if there are no Glyphs in *this.
+    [[nodiscard]] auto empty() const -> bool;
+
+    /// Return the Glyph at \p index, no bounds checking.
+    [[nodiscard]] auto operator[](int index) const -> Glyph;
+
+    /// Return the Glyph at \p index, throws std::out_of_range if invalid.
+    [[nodiscard]] auto at(int index) const -> Glyph;
+
+    /// Return the first Glyph, undefined if empty.
+    [[nodiscard]] auto front() const -> Glyph;
+
+    /// Return the last Glyph, undefined if empty.
+    [[nodiscard]] auto back() const -> Glyph;
+
+    /// Return the Brush of the Glyph at \p index, no bounds checking.
+    /** Binary search over the runs. */
+    [[nodiscard]] auto brush_at(int index) const -> Brush;
+
+    [[nodiscard]] auto begin() const -> Iterator;
+
+    [[nodiscard]] auto end() const -> Iterator;
+
+    [[nodiscard]] auto cbegin() const -> Iterator;
+
+    [[nodiscard]] auto cend() const -> Iterator;
+
+   public:
+    /// Return the symbol buffer, one char32_t per Glyph.
+    [[nodiscard]] auto symbols() const -> std::u32string const&;
+
+    /// Return the Brush runs, ordered by Run::end.
+    [[nodiscard]] auto runs() const -> std::vector<Run> const&;
+
+    /// Convert to a std::u32string, all Brush attributes are lost.
+    [[nodiscard]] auto u32str() const -> std::u32string;
+
+    /// Convert to a multi-byte std::string, all Brush attributes are lost.
+    [[nodiscard]] auto str() const -> std::string;
+
+    /// Expand into a Glyph_string, one Glyph per symbol.
+    [[nodiscard]] auto to_glyph_string() const -> Glyph_string;
+
+   public:
+    /// Set the Brush of \p count Glyphs starting at \p index to \p b.
+    void set_brush(int index, int count, Brush b);
+
+    /// Add \p traits to every Glyph contained in *this.
+    void add_traits(Traits traits);
+
+    /// Remove a series of Traits from every Glyph contained in *this.
+    void remove_traits(Traits traits);
+
+    /// Remove all currently set traits on each Glyph.
+    void clear_traits();
+
+    /// Add \p bg as the background color to every Glyph contained in *this.
+    void add_color(Background_color bg);
+
+    /// Add \p fg as the foreground color to every Glyph contained in *this.
+    void add_color(Foreground_color fg);
+
+    /// Set the background color as the default for every Glyph in *this.
+    void remove_background();
+
+    /// Set the foreground color as the default for every Glyph in *this.
+    void remove_foreground();
+
+   private:
+    std::u32string symbols_;
+    std::vector<Run> runs_;
+
+   private:
+    /// Apply \p modify to each run's Brush, then merge equal neighbors.
+    template <typename Modify_fn>
+    void modify_brushes(Modify_fn&& modify);
+
+    /// Return the index into runs_ of the run containing symbol \p index.
+    [[nodiscard]] auto run_index_at(int index) const -> std::size_t;
+};
+
+/// Random access const_iterator, dereferences to Glyph values.
+/** Tracks the current run, so sequential iteration does no searching. */
+class Compact_glyph_string::Iterator {
+   public:
+    using iterator_category = std::random_access_iterator_tag;
+    using value_type        = Glyph;
+    using difference_type   = std::ptrdiff_t;
+    using pointer           = void;
+    using reference         = Glyph;
+
+   public:
+    Iterator() = default;
+
+    Iterator(Compact_glyph_string const& str, int index);
+
+   public:
+    [[nodiscard]] auto operator*() const -> Glyph;
+
+    [[nodiscard]] auto operator[](difference_type n) const -> Glyph;
+
+    auto operator++() -> Iterator&;
+
+    auto operator++(int) -> Iterator;
+
+    auto operator--() -> Iterator&;
+
+    auto operator--(int) -> Iterator;
+
+    auto operator+=(difference_type n) -> Iterator&;
+
+    auto operator-=(difference_type n) -> Iterator&;
+
+    [[nodiscard]] auto operator+(difference_type n) const -> Iterator;
+
+    [[nodiscard]] auto operator-(difference_type n) const -> Iterator;
+
+    [[nodiscard]] auto operator-(Iterator const& other) const
+        -> difference_type;
+
+    [[nodiscard]] auto operator==(Iterator const& other) const -> bool;
+
+    [[nodiscard]] auto operator!=(Iterator const& other) const -> bool;
+
+    [[nodiscard]] auto operator<(Iterator const& other) const -> bool;
+
+    [[nodiscard]] auto operator>(Iterator const& other) const -> bool;
+
+    [[nodiscard]] auto operator<=(Iterator const& other) const -> bool;
+
+    [[nodiscard]] auto operator>=(Iterator const& other) const -> bool;
+
+   private:
+    Compact_glyph_string const* str_ = nullptr;
+    int index_                       = 0;
+    std::size_t run_                 = 0;
+};
+
+// Comparison ------------------------------------------------------------------
+
+/// Equality comparison on each Glyph in the Compact_glyph_strings.
+[[nodiscard]] auto operator==(Compact_glyph_string const& x,
+                              Compact_glyph_string const& y) -> bool;
+
+/// Inequality comparison on each Glyph in the Compact_glyph_strings.
+[[nodiscard]] auto operator!=(Compact_glyph_string const& x,
+                              Compact_glyph_string const& y) -> bool;
+
+}  // namespace ox
+#endif  // TERMOX_PAINTER_COMPACT_GLYPH_STRING_HPP
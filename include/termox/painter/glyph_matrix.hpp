@@ -2,6 +2,7 @@
 #define TERMOX_PAINTER_GLYPH_MATRIX_HPP
 #include <vector>
 
+#include <termox/common/span.hpp>
 #include <termox/painter/glyph.hpp>
 #include <termox/widget/area.hpp>
 #include <termox/widget/point.hpp>
@@ -9,6 +10,8 @@
 namespace ox {
 
 /// Holds a matrix of Glyphs, provides simple access by indices.
+/** Glyphs are stored in a single contiguous row-major buffer, row y + 1
+ *  directly follows row y in memory. */
 class Glyph_matrix {
    public:
     /// Construct with a set width and height, or defaults to 0 for each.
@@ -18,7 +21,8 @@ class Glyph_matrix {
    public:
     /// Resize the width and height of the matrix.
     /** New Glyphs will be default constructed, Glyphs no longer within the
-     *  bounds of the matrix will be destructed. */
+     *  bounds of the matrix will be destructed. Existing Glyphs keep their
+     *  Point. Changing only the height does not move any existing rows. */
     void resize(Area area);
 
     /// Remove all Glyphs from the matrix and set width/height to 0.
@@ -30,6 +34,12 @@ class Glyph_matrix {
     /// Return the height of the matrix.
     [[nodiscard]] auto height() const -> int;
 
+    /// Return the Area of the matrix.
+    [[nodiscard]] auto area() const -> Area;
+
+    /// Return the number of Glyphs between the start of two adjacent rows.
+    [[nodiscard]] auto stride() const -> int;
+
     /// Glyph access operator. {0, 0} is top left. x grows south and y east.
     /** Provides no bounds checking. */
     [[nodiscard]] auto operator()(Point p) -> Glyph&;
@@ -46,8 +56,30 @@ class Glyph_matrix {
     /** Has bounds checking and throws std::out_of_range if not within range. */
     [[nodiscard]] auto at(Point p) const -> Glyph;
 
+    /// Return a view of the entire row at \p y. Provides no bounds checking.
+    [[nodiscard]] auto row(int y) -> Span<Glyph>;
+
+    /// Return a view of the entire row at \p y. Provides no bounds checking.
+    [[nodiscard]] auto row(int y) const -> Span<Glyph const>;
+
+    /// Return a pointer to the first Glyph of the contiguous row-major buffer.
+    [[nodiscard]] auto data() -> Glyph*;
+
+    /// Return a pointer to the first Glyph of the contiguous row-major buffer.
+    [[nodiscard]] auto data() const -> Glyph const*;
+
+   public:
+    /// Assign \p g to every Glyph in the matrix.
+    void fill(Glyph g);
+
+    /// Copy \p source into *this with the top left of \p source at \p at.
+    /** Glyphs of \p source that do not land within *this are ignored, \p at
+     *  can be negative. Each row is copied as a single contiguous block. */
+    void blit(Glyph_matrix const& source, Point at);
+
    private:
-    std::vector<std::vector<Glyph>> matrix_;
+    std::vector<Glyph> buffer_;
+    Area area_;
 };
 
 }  // namespace ox
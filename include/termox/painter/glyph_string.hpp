@@ -33,6 +33,7 @@ class Glyph_string : private std::vector<Glyph> {
     template <typename... Attributes>
     Glyph_string(std::u32string_view symbols, Attributes... attrs)
     {
+        this->reserve(symbols.size());
         for (char32_t c : symbols)
             this->append(Glyph{c, Brush{attrs...}});
     }
@@ -1,10 +1,13 @@
 #ifndef TERMOX_PAINTER_PAINTER_HPP
 #define TERMOX_PAINTER_PAINTER_HPP
+#include <termox/common/span.hpp>
 #include <termox/painter/brush.hpp>
 #include <termox/widget/area.hpp>
 #include <termox/widget/point.hpp>
 
 namespace ox {
+class Compact_glyph_string;
+class Glyph_matrix;
 class Glyph_string;
 struct Glyph;
 class Widget;
@@ -35,6 +38,20 @@ class Painter {
     /// Put Glyph_string to local coordinates.
     auto put(Glyph_string const& text, Point p) -> Painter&;
 
+    /// Put Compact_glyph_string to local coordinates.
+    /** The Widget Brush is merged once per Brush run of \p text. */
+    auto put(Compact_glyph_string const& text, Point p) -> Painter&;
+
+    /// Put a contiguous run of Glyphs to local coordinates, left to right.
+    /** The run is clipped to the Widget once and the visible portion is
+     *  written directly into the canvas row. */
+    auto put(Span<Glyph const> glyphs, Point p) -> Painter&;
+
+    /// Put Glyph_matrix with its top left at local coordinates \p p.
+    /** The matrix is clipped to the Widget's area once, then each visible
+     *  row is copied into the canvas as a single contiguous block. */
+    auto put(Glyph_matrix const& matrix, Point p) -> Painter&;
+
     /// Return a copy of the Glyph at \p p, is U'\0' if Glyph is not set yet.
     [[nodiscard]] auto at(Point p) const -> Glyph;
 
@@ -42,13 +59,19 @@ class Painter {
     [[nodiscard]] auto at(Point p) -> Glyph&;
 
     /// Fill the Widget with \p tile Glyphs starting at the top left \p point.
-    /** \p point is in Widget local coordinates. */
+    /** \p point is in Widget local coordinates. The rectangle is clipped to
+     *  the Widget once and the Brush is merged into \p tile once. */
     auto fill(Glyph tile, Point point, Area area) -> Painter&;
 
+    /// Fill the entire Widget with \p tile Glyphs.
+    auto fill(Glyph tile) -> Painter&;
+
     /// Draw a horizontal line from \p a to \p b, inclusive, in local coords.
+    /** Only a.y is used for the row, the line is clipped to the Widget. */
     auto hline(Glyph tile, Point a, Point b) -> Painter&;
 
     /// Draw a vertical line from \p a to \p b, inclusive, in local coords.
+    /** Only a.x is used for the column, the line is clipped to the Widget. */
     auto vline(Glyph tile, Point a, Point b) -> Painter&;
 
     /// Fill the entire widget screen with wallpaper.
@@ -56,22 +79,19 @@ class Painter {
 
    private:
     /// Put a single Glyph to the canvas_ container.
-    /** No bounds checking, used internally for all painting. Main entry point
-     *  for modifying the canvas_ object. */
+    /** No bounds checking, merges the Brush of \p tile with brush_. */
     void put_global(Glyph tile, Point p);
 
-    /// Paint a line from \p a to \p b inclusive using global coordinates.
-    /** No bounds checking, used internally for Border object painting. */
-    void hline_global(Glyph tile, Point a, Point b);
-    void hline_global_no_brush(Glyph tile, Point a, Point b);
+    /// Write \p glyphs to a single canvas row starting at global Point \p p.
+    /** No bounds checking, merges the Brush of each Glyph with brush_. */
+    void put_run_global(Span<Glyph const> glyphs, Point p);
 
-    /// Paint a line from \p a to \p b inclusive using global coordinates.
-    /** No bounds checking, used internally for Border object painting. */
-    void vline_global(Glyph tile, Point a, Point b);
+    /// Write \p length copies of \p tile down from global Point \p p.
+    /** No bounds checking, \p tile is written as is. */
+    void vline_global_no_brush(Glyph tile, Point p, int length);
 
-    /// Fill the Widget with \p tile Glyphs starting at the top left \p point.
-    /** No bounds checking. */
-    void fill_global(Glyph tile, Point point, Area area);
+    /// Fill the rectangle at global Point \p point with \p tile Glyphs.
+    /** No bounds checking, \p tile is written as is, a row at a time. */
     void fill_global_no_brush(Glyph tile, Point point, Area area);
 
    private:
@@ -11,6 +11,8 @@ namespace ox::detail {
 
 [[nodiscard]] auto name(Key_press_event const&) -> std::string;
 
+[[nodiscard]] auto name(Key_release_event const&) -> std::string;
+
 [[nodiscard]] auto name(Mouse_press_event const&) -> std::string;
 
 [[nodiscard]] auto name(Mouse_release_event const&) -> std::string;
@@ -41,6 +43,10 @@ namespace ox::detail {
 
 [[nodiscard]] auto name(Timer_event const&) -> std::string;
 
+[[nodiscard]] auto name(Dynamic_color_event const&) -> std::string;
+
+[[nodiscard]] auto name(::esc::Window_resize const&) -> std::string;
+
 [[nodiscard]] auto name(Custom_event const&) -> std::string;
 
 }  // namespace ox::detail
@@ -0,0 +1,162 @@
+#ifndef TERMOX_SYSTEM_PROFILER_HPP
+#define TERMOX_SYSTEM_PROFILER_HPP
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+namespace ox {
+class Widget;
+
+/// Frame timings and per Widget paint costs of the event loop.
+/** Recording is compiled in only if TERMOX_PROFILE is defined, with the CMake
+ *  option TERMOX_ENABLE_PROFILER. Records go into a fixed size lock-free ring
+ *  buffer, snapshot() summarizes the records still held. In other builds the
+ *  recording hooks are empty and snapshot() returns no data. */
+class Profiler {
+   public:
+#ifdef TERMOX_PROFILE
+    static constexpr bool is_enabled = true;
+#else
+    static constexpr bool is_enabled = false;
+#endif
+
+    using Clock_t  = std::chrono::steady_clock;
+    using Duration = std::chrono::nanoseconds;
+
+    /// Number of records held, older records are overwritten.
+    static constexpr auto capacity = std::size_t{1} << 14;
+
+    /// One Event_queue::send_all() call that sent at least one Event.
+    struct Frame {
+        std::uint64_t number;
+        Duration total;    // The entire send_all() call.
+        Duration paint;    // Sum of all paint_event() calls.
+        Duration layout;   // Sum of outermost layout passes.
+        Duration refresh;  // Terminal::refresh(), diff and write.
+        int paint_count;
+        std::size_t diff_size;      // Cells written to the terminal.
+        std::size_t bytes_written;  // Escape sequence bytes.
+    };
+
+    /// paint_event() costs of a single Widget, over every Frame held.
+    struct Widget_paint {
+        std::uint64_t id;  // Widget::unique_id()
+        std::string name;  // Widget::name(), truncated to 31 bytes.
+        int count;
+        Duration total;
+        Duration max;
+    };
+
+    struct Snapshot {
+        std::vector<Frame> frames;          // Oldest first.
+        std::vector<Widget_paint> widgets;  // Largest total first.
+    };
+
+   public:
+    /// Summarize the records currently held, safe to call from any thread.
+    /** Only Frames numbered \p since_frame or later are included, paints
+     *  outside of any Frame count only if \p since_frame is zero. Frames still
+     *  in progress are not included. Records being overwritten while this is
+     *  running are skipped. */
+    [[nodiscard]] static auto snapshot(std::uint64_t since_frame = 0)
+        -> Snapshot;
+
+    /// Drop every record held so far.
+    static void clear();
+};
+
+}  // namespace ox
+
+namespace ox::detail {
+
+// Hooks placed around the measured code, see Profiler. Disabled builds get
+// empty inline definitions that compile away.
+
+#ifdef TERMOX_PROFILE
+
+/// Times Event_queue::send_all() and numbers the frame for nested records.
+/** The Frame is only recorded if record() is called, after Events were sent. */
+class Frame_profile {
+   public:
+    Frame_profile();
+
+    ~Frame_profile();
+
+   public:
+    void record();
+
+   private:
+    std::uint64_t previous_;
+    Profiler::Clock_t::time_point start_;
+};
+
+/// Times one Widget::paint_event() call.
+class Paint_profile {
+   public:
+    explicit Paint_profile(Widget const& w);
+
+    ~Paint_profile();
+
+   private:
+    Widget const& widget_;
+    Profiler::Clock_t::time_point start_;
+};
+
+/// Times one layout pass, passes nested in another are not recorded.
+class Layout_profile {
+   public:
+    Layout_profile();
+
+    ~Layout_profile();
+
+   private:
+    bool is_outermost_;
+    Profiler::Clock_t::time_point start_;
+};
+
+/// Times Terminal::refresh(), record() is called once the diff is written.
+class Refresh_profile {
+   public:
+    Refresh_profile();
+
+   public:
+    void record(std::size_t diff_size, std::size_t bytes_written);
+
+   private:
+    Profiler::Clock_t::time_point start_;
+};
+
+#else
+
+class [[maybe_unused]] Frame_profile {
+   public:
+    Frame_profile() {}
+
+   public:
+    void record() {}
+};
+
+class [[maybe_unused]] Paint_profile {
+   public:
+    explicit Paint_profile(Widget const&) {}
+};
+
+class [[maybe_unused]] Layout_profile {
+   public:
+    Layout_profile() {}
+};
+
+class [[maybe_unused]] Refresh_profile {
+   public:
+    Refresh_profile() {}
+
+   public:
+    void record(std::size_t, std::size_t) {}
+};
+
+#endif  // TERMOX_PROFILE
+
+}  // namespace ox::detail
+#endif  // TERMOX_SYSTEM_PROFILER_HPP
@@ -159,6 +159,9 @@ class System {
     /** Set by Event_queue::send_all. */
     static void set_current_queue(Event_queue& queue);
 
+    /// Return the Event_queue that is used by post_event.
+    [[nodiscard]] static auto current_queue() -> Event_queue&;
+
    private:
     inline static std::atomic<Widget*> head_ = nullptr;
     static detail::User_input_event_loop user_input_loop_;
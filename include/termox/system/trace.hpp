@@ -0,0 +1,96 @@
+#ifndef TERMOX_SYSTEM_TRACE_HPP
+#define TERMOX_SYSTEM_TRACE_HPP
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <iosfwd>
+#include <string>
+
+namespace ox {
+
+/// Timeline of the event loop threads, written as Chrome trace event JSON.
+/** Recording is compiled in only if TERMOX_TRACE is defined, with the CMake
+ *  option TERMOX_ENABLE_TRACE. Spans are recorded for Event_queue drains, the
+ *  wait on the mutex shared by every Event_queue, each Event sent, by type,
+ *  and writes to the Terminal. Each span holds the id of its thread. Records
+ *  go into a fixed size lock-free ring buffer, older spans are overwritten.
+ *
+ *  Open the output of write() in chrome://tracing or https://ui.perfetto.dev.
+ *  In other builds the recording hooks are empty and write() outputs a trace
+ *  with no events. */
+class Trace {
+   public:
+#ifdef TERMOX_TRACE
+    static constexpr bool is_enabled = true;
+#else
+    static constexpr bool is_enabled = false;
+#endif
+
+    using Clock_t = std::chrono::steady_clock;
+
+    /// Number of spans held, older spans are overwritten.
+    static constexpr auto capacity = std::size_t{1} << 16;
+
+   public:
+    /// Name the calling thread in the trace, \p name must outlive the Trace.
+    /** Cheap to call repeatedly with the same name, threads that are never
+     *  named are shown by number only. */
+    static void set_thread_name(char const* name);
+
+    /// Write every span held as a Chrome trace event JSON object to \p os.
+    /** Safe to call from any thread while spans are being recorded. */
+    static void write(std::ostream& os);
+
+    /// Write every span held to the file \p filename, replacing its contents.
+    /** Throws std::runtime_error if the file can't be opened. */
+    static void write(std::string const& filename);
+
+    /// Drop every span held so far.
+    static void clear();
+};
+
+}  // namespace ox
+
+namespace ox::detail {
+
+// Hooks placed around the traced code, see Trace. Disabled builds get empty
+// inline definitions that compile away.
+
+#ifdef TERMOX_TRACE
+
+/// Records a span from construction until end() or destruction.
+/** \p name and \p category must be string literals or otherwise outlive the
+ *  Trace, only the pointers are stored. */
+class Trace_span {
+   public:
+    Trace_span(char const* name, char const* category);
+
+    Trace_span(Trace_span const&) = delete;
+    auto operator=(Trace_span const&) -> Trace_span& = delete;
+
+    ~Trace_span();
+
+   public:
+    /// Record the span now, the destructor then does nothing.
+    void end();
+
+   private:
+    char const* name_;
+    char const* category_;
+    Trace::Clock_t::time_point start_;
+};
+
+#else
+
+class [[maybe_unused]] Trace_span {
+   public:
+    Trace_span(char const*, char const*) {}
+
+   public:
+    void end() {}
+};
+
+#endif  // TERMOX_TRACE
+
+}  // namespace ox::detail
+#endif  // TERMOX_SYSTEM_TRACE_HPP
@@ -5,6 +5,7 @@
 #include <utility>
 #include <vector>
 
+#include <termox/common/span.hpp>
 #include <termox/painter/color.hpp>
 #include <termox/painter/glyph.hpp>
 #include <termox/widget/area.hpp>
@@ -37,6 +38,14 @@ class Canvas {
     /// Return the Glyph at Point \p p.
     [[nodiscard]] auto at(ox::Point p) -> ox::Glyph&;
 
+    /// Return a view of the entire row at \p y, for bulk writes.
+    /** Rows are contiguous, no bounds checking. */
+    [[nodiscard]] auto row(int y) -> ox::Span<ox::Glyph>;
+
+    /// Return a view of the entire row at \p y.
+    /** Rows are contiguous, no bounds checking. */
+    [[nodiscard]] auto row(int y) const -> ox::Span<ox::Glyph const>;
+
    public:
     /// Resize the Canvas to the given Area \p a.
     /** Will throw out any Glyphs from the current Canvas that no longer fit. */
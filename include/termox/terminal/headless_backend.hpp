@@ -0,0 +1,154 @@
+#ifndef TERMOX_TERMINAL_HEADLESS_BACKEND_HPP
+#define TERMOX_TERMINAL_HEADLESS_BACKEND_HPP
+#include <condition_variable>
+#include <cstddef>
+#include <cstdint>
+#include <deque>
+#include <mutex>
+#include <string>
+#include <string_view>
+#include <vector>
+
+#include <esc/event.hpp>
+
+#include <termox/painter/trait.hpp>
+#include <termox/terminal/key_mode.hpp>
+#include <termox/terminal/mouse_mode.hpp>
+#include <termox/terminal/signals.hpp>
+#include <termox/terminal/terminal_backend.hpp>
+#include <termox/widget/area.hpp>
+#include <termox/widget/point.hpp>
+
+namespace ox {
+
+/// A foreground or background color as set by SGR escape sequences.
+struct Emulated_color {
+    enum class Kind : std::uint8_t { Default, Index, RGB };
+
+    Kind kind          = Kind::Default;
+    std::uint8_t index = 0;  // Kind::Index
+    std::uint8_t red   = 0;  // Kind::RGB
+    std::uint8_t green = 0;
+    std::uint8_t blue  = 0;
+};
+
+[[nodiscard]] auto operator==(Emulated_color const& a, Emulated_color const& b)
+    -> bool;
+
+[[nodiscard]] auto operator!=(Emulated_color const& a, Emulated_color const& b)
+    -> bool;
+
+/// One cell of the emulated screen.
+struct Emulated_cell {
+    char32_t symbol = U' ';
+    Traits traits   = Trait::None;
+    Emulated_color foreground;
+    Emulated_color background;
+};
+
+/// In memory terminal for tests and benchmarks.
+/** Output is kept as bytes and interpreted into a grid of Emulated_cells.
+ *  Cursor positioning, SGR traits and colors, and cursor visibility are
+ *  understood, other escape sequences are skipped. Input is a script of
+ *  esc::Events, read() blocks until one is pushed. All member functions may be
+ *  called from any thread. */
+class Headless_backend : public Terminal_backend {
+   public:
+    /// Create a screen of \p size cells, filled with default cells.
+    explicit Headless_backend(Area size = {80, 24});
+
+   public:
+    void initialize(Mouse_mode, Key_mode, Signals) override;
+
+    void uninitialize() override;
+
+    [[nodiscard]] auto area() const -> Area override;
+
+    void write(std::string_view bytes) override;
+
+    void flush() override;
+
+    void show_cursor(bool show) override;
+
+    [[nodiscard]] auto read() -> ::esc::Event override;
+
+    [[nodiscard]] auto color_count() const -> std::uint16_t override;
+
+    [[nodiscard]] auto has_true_color() const -> bool override;
+
+   public:
+    /// Change the screen size and push a matching esc::Window_resize.
+    /** Cells outside of the new size are dropped, new cells are default. */
+    void resize(Area size);
+
+    /// Add \p e to the end of the input script.
+    void push_input(::esc::Event e);
+
+    /// Return the number of Events pushed but not yet read.
+    [[nodiscard]] auto pending_input() const -> std::size_t;
+
+    /// Return the bytes written since the last take_output().
+    [[nodiscard]] auto take_output() -> std::string;
+
+    /// Drop the bytes written since the last take_output(), keeping capacity.
+    /** Lets a long run keep the output buffer from growing without bound. */
+    void clear_output();
+
+    /// Return the number of bytes written since construction.
+    [[nodiscard]] auto bytes_written() const -> std::uint64_t;
+
+    /// Return the number of flush() calls since construction.
+    [[nodiscard]] auto flush_count() const -> std::uint64_t;
+
+    /// Return a copy of the cell at \p p, which must be within area().
+    [[nodiscard]] auto cell(Point p) const -> Emulated_cell;
+
+    /// Return the symbols of row \p y as UTF8, trailing spaces included.
+    [[nodiscard]] auto row_text(int y) const -> std::string;
+
+    /// Return where the next written symbol goes.
+    [[nodiscard]] auto cursor() const -> Point;
+
+    /// Return true if the cursor is shown.
+    [[nodiscard]] auto is_cursor_visible() const -> bool;
+
+    /// Return true between initialize() and uninitialize().
+    [[nodiscard]] auto is_initialized() const -> bool;
+
+   private:
+    mutable std::mutex mtx_;
+    std::condition_variable input_ready_;
+    std::deque<::esc::Event> input_;
+
+    Area area_;
+    std::vector<Emulated_cell> cells_;
+    Point cursor_         = {0, 0};
+    Emulated_cell pen_    = {};
+    bool is_cursor_shown_ = true;
+    bool is_initialized_  = false;
+
+    std::string output_;
+    std::string partial_;  // Incomplete sequence or UTF8 from the last write.
+
+    // Scratch space for interpret(), kept to avoid allocating on each write.
+    std::string joined_;
+    std::vector<int> params_;
+    std::uint64_t bytes_written_ = 0;
+    std::uint64_t flush_count_   = 0;
+
+   private:
+    /// Interpret \p bytes, keeping any incomplete tail in partial_.
+    void interpret(std::string_view bytes);
+
+    /// Apply CSI sequence parameters \p params with final byte \p command.
+    void apply_csi(std::string_view params, char command);
+
+    /// Apply SGR parameters to pen_.
+    void apply_sgr(std::vector<int> const& params);
+
+    /// Write \p symbol at the cursor and advance it, wrapping at the edge.
+    void put(char32_t symbol);
+};
+
+}  // namespace ox
+#endif  // TERMOX_TERMINAL_HEADLESS_BACKEND_HPP
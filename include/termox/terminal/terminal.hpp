@@ -1,6 +1,7 @@
 #ifndef TERMOX_TERMINAL_TERMINAL_HPP
 #define TERMOX_TERMINAL_TERMINAL_HPP
 #include <cstdint>
+#include <memory>
 
 #include <signals_light/signal.hpp>
 
@@ -12,6 +13,7 @@
 #include <termox/terminal/key_mode.hpp>
 #include <termox/terminal/mouse_mode.hpp>
 #include <termox/terminal/signals.hpp>
+#include <termox/terminal/terminal_backend.hpp>
 #include <termox/widget/area.hpp>
 
 namespace ox {
@@ -112,12 +114,22 @@ class Terminal {
     /// Send exit flag and wait for Dynamic_color_engine thread to shutdown.
     static void stop_dynamic_color_engine();
 
+    /// Replace the backend that input and output go through.
+    /** Must be called while uninitialized, throws std::logic_error otherwise.
+     *  The default is a Tty_backend, Headless_backend is for tests. */
+    static void set_backend(std::unique_ptr<Terminal_backend> backend);
+
+    /// Return the backend that input and output go through.
+    [[nodiscard]] static auto backend() -> Terminal_backend&;
+
     /// If set true, will properly uninitialize the screen on SIGINT.
     /** This must be called before Terminal::initialize to be useful. This is
      *  set true by default. */
     static void handle_signint(bool x);
 
    private:
+    inline static std::unique_ptr<Terminal_backend> backend_ =
+        std::make_unique<Tty_backend>();
     inline static Palette palette_;
     inline static Dynamic_color_engine dynamic_color_engine_;
     inline static bool is_initialized_ = false;
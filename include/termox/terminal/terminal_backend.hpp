@@ -0,0 +1,79 @@
+#ifndef TERMOX_TERMINAL_TERMINAL_BACKEND_HPP
+#define TERMOX_TERMINAL_TERMINAL_BACKEND_HPP
+#include <cstdint>
+#include <string_view>
+
+#include <esc/event.hpp>
+
+#include <termox/terminal/key_mode.hpp>
+#include <termox/terminal/mouse_mode.hpp>
+#include <termox/terminal/signals.hpp>
+#include <termox/widget/area.hpp>
+
+namespace ox {
+
+/// Where Terminal writes escape sequences to and reads input Events from.
+/** Terminal owns one backend, Tty_backend unless replaced with
+ *  Terminal::set_backend(). Implementations are called from the event loop
+ *  threads, write() and flush() never concurrently. */
+class Terminal_backend {
+   public:
+    virtual ~Terminal_backend() = default;
+
+   public:
+    /// Put the terminal into the mode Terminal::initialize() describes.
+    virtual void initialize(Mouse_mode mouse_mode,
+                            Key_mode key_mode,
+                            Signals signals) = 0;
+
+    /// Reset the terminal to its state before initialize().
+    virtual void uninitialize() = 0;
+
+    /// Return the size of the screen in cells.
+    [[nodiscard]] virtual auto area() const -> Area = 0;
+
+    /// Stage \p bytes of output, may be buffered until flush().
+    virtual void write(std::string_view bytes) = 0;
+
+    /// Send staged output to the screen.
+    virtual void flush() = 0;
+
+    /// Set whether the cursor is drawn, takes effect at the next flush().
+    virtual void show_cursor(bool show) = 0;
+
+    /// Block until the next input Event is available and return it.
+    [[nodiscard]] virtual auto read() -> ::esc::Event = 0;
+
+    /// Return the number of colors in the terminal's built in palette.
+    [[nodiscard]] virtual auto color_count() const -> std::uint16_t = 0;
+
+    /// Return true if the terminal accepts true color escape sequences.
+    [[nodiscard]] virtual auto has_true_color() const -> bool = 0;
+};
+
+/// The process's controlling terminal, through the Escape library.
+class Tty_backend : public Terminal_backend {
+   public:
+    void initialize(Mouse_mode mouse_mode,
+                    Key_mode key_mode,
+                    Signals signals) override;
+
+    void uninitialize() override;
+
+    [[nodiscard]] auto area() const -> Area override;
+
+    void write(std::string_view bytes) override;
+
+    void flush() override;
+
+    void show_cursor(bool show) override;
+
+    [[nodiscard]] auto read() -> ::esc::Event override;
+
+    [[nodiscard]] auto color_count() const -> std::uint16_t override;
+
+    [[nodiscard]] auto has_true_color() const -> bool override;
+};
+
+}  // namespace ox
+#endif  // TERMOX_TERMINAL_TERMINAL_BACKEND_HPP
@@ -45,13 +45,17 @@
 #include <termox/system/event_loop.hpp>
 #include <termox/system/key.hpp>
 #include <termox/system/mouse.hpp>
+#include <termox/system/profiler.hpp>
 #include <termox/system/shortcuts.hpp>
 #include <termox/system/system.hpp>
+#include <termox/system/trace.hpp>
 
+#include <termox/terminal/headless_backend.hpp>
 #include <termox/terminal/key_mode.hpp>
 #include <termox/terminal/mouse_mode.hpp>
 #include <termox/terminal/signals.hpp>
 #include <termox/terminal/terminal.hpp>
+#include <termox/terminal/terminal_backend.hpp>
 
 #include <termox/widget/layouts/fixed.hpp>
 #include <termox/widget/layouts/float.hpp>
@@ -85,6 +89,7 @@
 #include <termox/widget/widgets/number_edit.hpp>
 #include <termox/widget/widgets/number_view.hpp>
 #include <termox/widget/widgets/password_edit.hpp>
+#include <termox/widget/widgets/profile_overlay.hpp>
 #include <termox/widget/widgets/read_file.hpp>
 #include <termox/widget/widgets/scrollbar.hpp>
 #include <termox/widget/widgets/selectable.hpp>
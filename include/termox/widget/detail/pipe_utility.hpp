@@ -2,6 +2,7 @@
 #define TERMOX_WIDGET_DETAIL_PIPE_UTILITY_HPP
 #include <memory>
 #include <type_traits>
+#include <vector>
 
 #include <termox/widget/widget.hpp>
 
@@ -43,6 +44,18 @@ template <typename T>
 constexpr bool is_widget_or_wptr =
     is_widget_v<T> || is_widget_ptr_v<std::decay_t<T>>;
 
+/// Used to call operator| overload that visits each descendant of root.
+class Descendants {
+   public:
+    explicit Descendants(Widget& w) : root{w} {}
+
+    /// Copy out each descendant, parents before children.
+    operator std::vector<Widget*>() const { return root.get_descendants(); }
+
+   public:
+    Widget& root;
+};
+
 }  // namespace ox::pipe::detail
 
 namespace ox {
@@ -83,6 +83,8 @@ class Layout : public Widget {
         assert(index <= this->child_count());
         auto& inserted = *w;
         children_.emplace(this->iter_at(index), std::move(w));
+        this->invalidate_child_indices(index);
+        inserted.set_cached_child_index(index);
         inserted.set_parent(this);
         inserted.enable(this->is_enabled());
         System::post_event(Child_added_event{*this, inserted});
@@ -97,6 +99,35 @@ class Layout : public Widget {
         return this->insert_child(std::move(w), this->child_count());
     }
 
+    /// Inserts each of \p children, in order, starting at \p index.
+    /** Widget_t must be a Child_t or derived object. A Child_added_event is
+     *  sent for each child, Layouts are updated once for the whole batch. */
+    template <typename Widget_t>
+    void insert_children(std::vector<std::unique_ptr<Widget_t>> children,
+                         std::size_t index)
+    {
+        static_assert(std::is_base_of_v<Child_t, Widget_t>,
+                      "Layout::insert: Widget_t must be a Child_t type");
+        assert(index <= this->child_count());
+        if (children.empty())
+            return;
+        auto inserted = std::vector<Widget*>{};
+        inserted.reserve(children.size());
+        for (auto const& child : children)
+            inserted.push_back(child.get());
+        children_.insert(this->iter_at(index),
+                         std::make_move_iterator(std::begin(children)),
+                         std::make_move_iterator(std::end(children)));
+        this->initialize_inserted(inserted, index);
+    }
+
+    /// Appends each of \p children, in order. Forwards to insert_children().
+    template <typename Widget_t>
+    void append_children(std::vector<std::unique_ptr<Widget_t>> children)
+    {
+        this->insert_children(std::move(children), this->child_count());
+    }
+
     /// Create a Widget and append it to the child container.
     /** Return a reference to this newly created Widget. */
     template <typename Widget_t = Child_t, typename... Args>
@@ -118,14 +149,46 @@ class Layout : public Widget {
     [[nodiscard]] auto remove_child(Child_t const* child)
         -> std::unique_ptr<Widget>
     {
-        auto const at = this->find_iter(child);
-        if (at == std::end(children_))
+        auto const index = this->find_child_position(child);
+        if (index == -1uL)
             return nullptr;
-        auto removed = this->iter_remove(at);
+        auto removed = this->iter_remove(this->iter_at(index));
         this->uninitialize(*removed);
         return removed;
     }
 
+    /// Removes and returns each child where predicate(child) returns true.
+    /** Children are returned in their original order. A Child_removed_event is
+     *  sent for each child, Layouts are updated once for the whole batch. */
+    template <typename UnaryPredicate,
+              typename = enable_if_invocable<UnaryPredicate>>
+    [[nodiscard]] auto remove_children_if(UnaryPredicate&& predicate)
+        -> std::vector<std::unique_ptr<Widget>>
+    {
+        auto removed     = std::vector<std::unique_ptr<Widget>>{};
+        auto first_index = this->child_count();
+        auto kept        = std::size_t{0};
+        for (auto i = std::size_t{0}; i < children_.size(); ++i) {
+            if (predicate(static_cast<Child_t&>(*children_[i]))) {
+                first_index = std::min(first_index, i);
+                removed.push_back(std::move(children_[i]));
+            }
+            else {
+                if (kept != i)
+                    children_[kept] = std::move(children_[i]);
+                ++kept;
+            }
+        }
+        if (removed.empty())
+            return removed;
+        children_.erase(this->iter_at(kept), std::end(children_));
+        this->invalidate_child_indices(first_index);
+        batch_last_ = removed.back().get();
+        for (auto const& w : removed)
+            this->uninitialize(*w);
+        return removed;
+    }
+
     /// Removes and returns the first child where predicate(child) returns true.
     /** If no child is found, returns nullptr. */
     template <typename UnaryPredicate,
@@ -186,17 +249,31 @@ class Layout : public Widget {
         return true;
     }
 
+    /// Removes each child where predicate(child) is true, and deletes them.
+    /** Returns the number of children removed. */
+    template <typename UnaryPredicate,
+              typename = enable_if_invocable<UnaryPredicate>>
+    auto remove_and_delete_children_if(UnaryPredicate&& predicate)
+        -> std::size_t
+    {
+        auto removed = this->remove_children_if(
+            std::forward<UnaryPredicate>(predicate));
+        for (auto& w : removed)
+            System::post_event(Delete_event{std::move(w)});
+        return removed.size();
+    }
+
     /// Removes all children and sends Delete_events to each.
     void delete_all_children()
     {
-        while (this->child_count() != 0)
-            this->remove_and_delete_child_at(0);
+        this->remove_and_delete_children_if([](Child_t const&) { return true; });
     }
 
     /// Swap two child widgets, no index range check.
     void swap_children(std::size_t index_a, std::size_t index_b)
     {
         std::iter_swap(this->iter_at(index_a), this->iter_at(index_b));
+        this->invalidate_child_indices(std::min(index_a, index_b));
         System::post_event(Child_polished_event{*this, *children_[index_b]});
         System::post_event(Child_polished_event{*this, *children_[index_a]});
     }
@@ -244,38 +321,86 @@ class Layout : public Widget {
     }
 
     /// Finds the index of the given child pointer in the child container.
-    /** Returns std::size_t(-1) if \p w is not a child of *this. */
+    /** Returns std::size_t(-1) if \p w is not a child of *this. Constant time
+     *  unless children have been inserted, removed or reordered since the last
+     *  lookup, then indices from the first change onward are recalculated. */
     [[nodiscard]] auto find_child_position(Widget const* w) const -> std::size_t
     {
-        auto const found = std::find_if(
-            std::cbegin(children_), std::cend(children_),
-            [w](std::unique_ptr<Widget> const& x) { return x.get() == w; });
-        if (found == std::cend(children_))
+        if (w == nullptr || w->parent() != this)
             return -1uL;
-        return std::distance(std::cbegin(children_), found);
+        if (w->cached_child_index() >= valid_indices_)
+            this->update_child_indices();
+        auto const index = w->cached_child_index();
+        if (index < children_.size() && children_[index].get() == w)
+            return index;
+        return -1uL;
     }
 
     /// Returns true if \p w is a child of *this.
     [[nodiscard]] auto contains_child(Widget const* w) const -> bool
     {
-        auto const begin = std::cbegin(children_);
-        auto const end   = std::cend(children_);
-        return std::find_if(begin, end, [w](auto const& w_ptr) {
-                   return w_ptr.get() == w;
-               }) != end;
+        return this->find_child_position(w) != -1uL;
     }
 
     /// Returns true if \p descendant is a child or some other child's child etc
-    /** Not as efficient as it could be. */
+    /** Walks up the parent chain of \p descendant. */
     [[nodiscard]] auto contains_descendant(Widget const* descendant) const
         -> bool
     {
-        auto const d = this->get_descendants();
-        return std::find(std::begin(d), std::end(d), descendant) != std::end(d);
+        if (descendant == nullptr)
+            return false;
+        for (auto* p = descendant->parent(); p != nullptr; p = p->parent()) {
+            if (p == this)
+                return true;
+        }
+        return false;
     }
 
     void update() final override {}
 
+   protected:
+    /// Set up \p inserted, already moved into children_ by a derived class.
+    /** \p first_index is the lowest index of any inserted child, children past
+     *  it may have been reordered. Child_added_events are posted in the order
+     *  of \p inserted, as a single batch. */
+    void initialize_inserted(std::vector<Widget*> const& inserted,
+                             std::size_t first_index)
+    {
+        if (inserted.empty())
+            return;
+        this->invalidate_child_indices(first_index);
+        batch_last_ = inserted.back();
+        for (auto* w : inserted) {
+            w->set_cached_child_index(first_index);
+            w->set_parent(this);
+            w->enable(this->is_enabled());
+            System::post_event(Child_added_event{*this, *w});
+        }
+    }
+
+    /// Cached child indices from \p index onward are out of date.
+    /** Must be called by derived classes that reorder children_ directly. A
+     *  child at or past \p index must have a cached index of at least \p index,
+     *  which holds for any reordering of valid indices. */
+    void invalidate_child_indices(std::size_t index = 0)
+    {
+        valid_indices_ = std::min(valid_indices_, index);
+    }
+
+    /// Return true if the layout of \p child can wait for a later child event.
+    /** True for each Child_added_event or Child_removed_event from a bulk
+     *  insert or removal, except the last. The batch ends at its last event. */
+    [[nodiscard]] auto defer_for_batch(Widget const& child) -> bool
+    {
+        if (batch_last_ == nullptr)
+            return false;
+        if (&child == batch_last_) {
+            batch_last_ = nullptr;
+            return false;
+        }
+        return true;
+    }
+
    protected:
     struct Dimensions {
         Widget* widget;
@@ -303,33 +428,20 @@ class Layout : public Widget {
         return std::next(std::cbegin(children_), index);
     }
 
-    /// find_iter implementation.
-    [[nodiscard]] auto is_target(Child_t const* target)
-    {
-        return [target](std::unique_ptr<Widget> const& w) -> bool {
-            return w.get() == target;
-        };
-    }
-
-    /// Find the iterator pointing to \p w.
-    [[nodiscard]] auto find_iter(Child_t const* w) const
-        -> Children_t::const_iterator
-    {
-        return std::find_if(std::cbegin(children_), std::cend(children_),
-                            is_target(w));
-    }
-
-    /// Find the iterator pointing to \p w.
-    [[nodiscard]] auto find_iter(Child_t const* w) -> Children_t::iterator
+    /// Recalculate each out of date cached child index.
+    void update_child_indices() const
     {
-        return std::find_if(std::begin(children_), std::end(children_),
-                            is_target(w));
+        for (auto i = valid_indices_; i < children_.size(); ++i)
+            children_[i]->set_cached_child_index(i);
+        valid_indices_ = children_.size();
     }
 
     /// Moves \p at out of the widget tree and erases the nullptr left behind.
     [[nodiscard]] auto iter_remove(Children_t::iterator at)
         -> std::unique_ptr<Widget>
     {
+        this->invalidate_child_indices(
+            std::distance(std::begin(children_), at));
         auto removed = std::move(*at);
         children_.erase(at);
         return removed;
@@ -348,6 +460,14 @@ class Layout : public Widget {
     {
         return true;
     }
+
+   private:
+    // Cached child indices below this are known to be up to date.
+    mutable std::size_t valid_indices_ = 0;
+
+    // Last child of the most recent bulk insert or removal, see
+    // defer_for_batch().
+    Widget const* batch_last_ = nullptr;
 };
 
 }  // namespace ox::layout
@@ -0,0 +1,54 @@
+#ifndef TERMOX_WIDGET_LAYOUTS_DETAIL_LAYOUT_PASS_HPP
+#define TERMOX_WIDGET_LAYOUTS_DETAIL_LAYOUT_PASS_HPP
+#include <termox/widget/area.hpp>
+#include <termox/widget/point.hpp>
+
+namespace ox {
+class Widget;
+}  // namespace ox
+
+namespace ox::layout::detail {
+
+class Deferrable_layout;
+
+/// Immediately give \p child its final position and size.
+/** Sends a Move_event and/or Resize_event only if the geometry differs from
+ *  the current geometry of \p child. Events are sent, not posted, so a nested
+ *  layout arranges its own children before this returns; an entire subtree is
+ *  laid out top-down in a single traversal.
+ *
+ *  If \p child is a Deferrable_layout that is both moved and resized, it lays
+ *  out its children once, on the Resize_event. If an event filter consumes
+ *  that Resize_event, \p child is returned and the caller must call relayout()
+ *  on it, otherwise returns nullptr. */
+[[nodiscard]] auto apply_geometry(Widget& child, Point position, Area area)
+    -> Deferrable_layout*;
+
+/// A Layout that arranges its children with apply_geometry().
+/** Lets apply_geometry() tell the Layout that a Move_event will be followed by
+ *  a Resize_event, so the Layout can skip arranging its children twice. */
+class Deferrable_layout {
+   public:
+    virtual ~Deferrable_layout() = default;
+
+   public:
+    /// Arrange the children for the current position and size.
+    virtual void relayout() = 0;
+
+   protected:
+    /// Return true if the Move_event being handled will be followed by a
+    /// Resize_event.
+    /** Layouts check this in move_event() and skip relayout() if true. */
+    [[nodiscard]] auto is_relayout_deferred() const -> bool
+    {
+        return relayout_deferred_;
+    }
+
+   private:
+    bool relayout_deferred_ = false;
+
+    friend auto apply_geometry(Widget&, Point, Area) -> Deferrable_layout*;
+};
+
+}  // namespace ox::layout::detail
+#endif  // TERMOX_WIDGET_LAYOUTS_DETAIL_LAYOUT_PASS_HPP
@@ -3,9 +3,11 @@
 #include <cassert>
 
 #include <termox/system/event.hpp>
+#include <termox/system/profiler.hpp>
 #include <termox/widget/layout.hpp>
 #include <termox/widget/size_policy.hpp>
 
+#include "layout_pass.hpp"
 #include "shared_space.hpp"
 #include "unique_space.hpp"
 
@@ -32,7 +34,7 @@ struct Linear_layout_parameters {
 /// Lays out Widgets in 2D, sharing space in a primary dimension.
 /** The secondary dimension does not share space among Widgets. */
 template <typename Child, typename Parameters>
-class Linear_layout : public Layout<Child> {
+class Linear_layout : public Layout<Child>, public Deferrable_layout {
    public:
     using Child_t = Child;
 
@@ -85,6 +87,19 @@ class Linear_layout : public Layout<Child> {
         return result;
     }
 
+    /// Removes and returns each child where predicate(child) returns true.
+    /** Children are returned in their original order. */
+    template <typename UnaryPredicate,
+              typename = enable_if_invocable<UnaryPredicate>>
+    [[nodiscard]] auto remove_children_if(UnaryPredicate&& predicate)
+        -> std::vector<std::unique_ptr<Widget>>
+    {
+        auto result = this->Base_t::remove_children_if(
+            std::forward<UnaryPredicate>(predicate));
+        this->reset_offset_if_out_of_bounds();
+        return result;
+    }
+
     /// Removes the child with given pointer and sends a Delete_event to it.
     /** Returns false if \p child is not found and deleted. */
     auto remove_and_delete_child(Child_t const* child) -> bool
@@ -115,6 +130,19 @@ class Linear_layout : public Layout<Child> {
         return result;
     }
 
+    /// Removes each child where predicate(child) is true, and deletes them.
+    /** Returns the number of children removed. */
+    template <typename UnaryPredicate,
+              typename = enable_if_invocable<UnaryPredicate>>
+    auto remove_and_delete_children_if(UnaryPredicate&& predicate)
+        -> std::size_t
+    {
+        auto const result = this->Base_t::remove_and_delete_children_if(
+            std::forward<UnaryPredicate>(predicate));
+        this->reset_offset_if_out_of_bounds();
+        return result;
+    }
+
     /// Removes all children and sends Delete_events to each.
     void delete_all_children()
     {
@@ -132,6 +160,8 @@ class Linear_layout : public Layout<Child> {
                              return compare(static_cast<Child_t const&>(*a),
                                             static_cast<Child_t const&>(*b));
                          });
+        this->invalidate_child_indices();
+        this->invalidate_lengths();
         this->resize_and_move_children();
     }
 
@@ -183,7 +213,8 @@ class Linear_layout : public Layout<Child> {
 
     auto move_event(Point new_position, Point old_position) -> bool override
     {
-        this->resize_and_move_children();
+        if (!this->is_relayout_deferred())
+            this->resize_and_move_children();
         return Layout<Child>::move_event(new_position, old_position);
     }
 
@@ -195,35 +226,69 @@ class Linear_layout : public Layout<Child> {
 
     auto child_added_event(Widget& child) -> bool override
     {
-        this->resize_and_move_children();
+        this->invalidate_lengths();
+        if (!this->defer_for_batch(child))
+            this->resize_and_move_children();
         return Layout<Child>::child_added_event(child);
     }
 
     auto child_removed_event(Widget& child) -> bool override
     {
-        this->resize_and_move_children();
+        this->invalidate_lengths();
+        if (!this->defer_for_batch(child))
+            this->resize_and_move_children();
         return Layout<Child>::child_removed_event(child);
     }
 
     auto child_polished_event(Widget& child) -> bool override
     {
+        this->invalidate_lengths();
         this->resize_and_move_children();
         return Layout<Child>::child_polished_event(child);
     }
 
+    void relayout() override { this->resize_and_move_children(); }
+
    private:
     using Length_list   = std::vector<int>;
     using Position_list = std::vector<int>;
 
     Shared_space<Parameters> shared_space_;
     Unique_space<Parameters> unique_space_;
+    bool in_layout_pass_   = false;
+    bool relayout_pending_ = false;
 
    private:
+    /// Child Size_policies or the child list changed, recalculate lengths.
+    void invalidate_lengths()
+    {
+        shared_space_.invalidate();
+        unique_space_.invalidate();
+    }
+
+    /// Lay out children, lengths are only recalculated if out of date.
+    /** A plain move reuses the cached lengths and only translates positions.
+     *  If a child's event handler asks for another layout while this one is
+     *  applying geometry, that layout runs after this one has finished. */
     void resize_and_move_children()
     {
         if (!this->is_enabled())
             return;
+        if (in_layout_pass_) {
+            relayout_pending_ = true;
+            return;
+        }
+        auto const profile = ox::detail::Layout_profile{};
+        in_layout_pass_    = true;
+        do {
+            relayout_pending_ = false;
+            this->apply_layout();
+        } while (relayout_pending_);
+        in_layout_pass_ = false;
+    }
 
+    void apply_layout()
+    {
 #ifndef NDEBUG  // Validate Size_policies
         for (auto& child : this->get_children()) {
             assert(ox::is_valid(child.width_policy) &&
@@ -231,20 +296,23 @@ class Linear_layout : public Layout<Child> {
         }
 #endif
 
-        auto const primary_lengths = shared_space_.calculate_lengths(*this);
-        auto const primary_pos =
-            shared_space_.calculate_positions(primary_lengths);
+        auto const& primary_lengths = shared_space_.cached_lengths(*this);
+        auto const& primary_pos     = shared_space_.cached_positions();
 
-        auto const secondary_lengths = unique_space_.calculate_lengths(*this);
-        auto const secondary_pos =
-            unique_space_.calculate_positions(secondary_lengths);
+        auto const& secondary_lengths = unique_space_.cached_lengths(*this);
+        auto const& secondary_pos     = unique_space_.cached_positions();
 
         this->send_enable_disable_events(primary_lengths, secondary_lengths);
-        this->send_resize_events(primary_lengths, secondary_lengths);
-        this->send_move_events(primary_pos, secondary_pos);
+        this->apply_geometries(primary_lengths, secondary_lengths,
+                               primary_pos, secondary_pos);
     }
 
    private:
+    /// Enable children that have space to be displayed, disable the rest.
+    /** is_enabled() changes immediately, so the geometry pass below sees it,
+     *  but Widget::enable() posts the Enable_event and Disable_event. Their
+     *  handlers and Signals run after the layout pass, when the event queue is
+     *  next processed. */
     void send_enable_disable_events(Length_list const& primary,
                                     Length_list const& secondary)
     {
@@ -261,33 +329,32 @@ class Linear_layout : public Layout<Child> {
         }
     }
 
-    void send_resize_events(Length_list const& primary,
-                            Length_list const& secondary)
+    /// Synchronously move and resize each displayed child, top-down.
+    /** Only children with changed geometry receive events. Nested layouts
+     *  arrange their own children before the next child here is visited. */
+    void apply_geometries(Length_list const& primary_lengths,
+                          Length_list const& secondary_lengths,
+                          Position_list const& primary_pos,
+                          Position_list const& secondary_pos)
     {
-        auto const children = this->get_children();
-        auto const offset   = this->get_child_offset();
-        for (auto i = 0uL; i < primary.size(); ++i) {
-            auto& child = children[offset + i];
-            auto const area =
-                typename Parameters::get_area{}(primary[i], secondary[i]);
-            System::post_event(Resize_event{child, area});
-        }
-    }
-
-    void send_move_events(Position_list const& primary,
-                          Position_list const& secondary)
-    {
-        auto const children = this->get_children();
-        auto const offset   = this->get_child_offset();
+        auto const offset = this->get_child_offset();
         auto const primary_offset =
             typename Parameters::Primary::get_offset{}(*this);
         auto const secondary_offset =
             typename Parameters::Secondary::get_offset{}(*this);
-        for (auto i = 0uL; i < primary.size(); ++i) {
-            auto& child      = children[offset + i];
+        for (auto i = 0uL; i < primary_lengths.size(); ++i) {
+            // Event handlers might remove children while this is running.
+            if (offset + i >= this->child_count())
+                return;
+            auto const area  = typename Parameters::get_area{}(
+                primary_lengths[i], secondary_lengths[i]);
             auto const point = typename Parameters::get_point{}(
-                primary[i] + primary_offset, secondary[i] + secondary_offset);
-            System::post_event(Move_event{child, point});
+                primary_pos[i] + primary_offset,
+                secondary_pos[i] + secondary_offset);
+            auto* const deferred =
+                apply_geometry(this->get_children()[offset + i], point, area);
+            if (deferred != nullptr)
+                deferred->relayout();
         }
     }
 
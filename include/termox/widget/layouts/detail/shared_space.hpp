@@ -1,6 +1,8 @@
 #ifndef TERMOX_WIDGET_LAYOUTS_DETAIL_SHARED_SPACE_HPP
 #define TERMOX_WIDGET_LAYOUTS_DETAIL_SHARED_SPACE_HPP
+#include <algorithm>
 #include <cstddef>
+#include <iterator>
 #include <vector>
 
 #include <termox/widget/size_policy.hpp>
@@ -55,85 +57,197 @@ class Shared_space {
         return result;
     }
 
+    /// Return calculate_lengths(parent), recalculated only when out of date.
+    /** The result is kept until invalidate() is called or the parent's
+     *  length, child count or the offset changes. */
+    [[nodiscard]] auto cached_lengths(Widget& parent) -> Length_list const&
+    {
+        auto const key =
+            Cache_key{typename Parameters::Primary::get_length{}(parent),
+                      parent.child_count()};
+        if (is_cached_ && key == cache_key_)
+            return lengths_;
+        lengths_ = this->calculate_lengths(parent);
+        positions_.clear();
+        auto running_total = 0;
+        for (auto length : lengths_) {
+            positions_.push_back(running_total);
+            running_total += length;
+        }
+        cache_key_ = key;
+        is_cached_ = true;
+        return lengths_;
+    }
+
+    /// Return calculate_positions() of the last cached_lengths() result.
+    [[nodiscard]] auto cached_positions() const -> Position_list const&
+    {
+        return positions_;
+    }
+
+    /// Force the next cached_lengths() call to recalculate.
+    void invalidate() { is_cached_ = false; }
+
     /// Return the child Widget offset, the first widget included in the layout.
     [[nodiscard]] auto get_offset() const -> std::size_t { return offset_; }
 
     /// Sets the child Widget offset, does not do bounds checking.
-    void set_offset(std::size_t index) { offset_ = index; }
+    void set_offset(std::size_t index)
+    {
+        offset_ = index;
+        this->invalidate();
+    }
+
+   private:
+    /// A child's stake in the space being given out or taken back.
+    struct Share {
+        Dimension* dimension;
+        int room;                    // Cells until max, or min, is reached.
+        double weight;               // Relative rate room is used up at.
+        int amount       = 0;        // Result, cells to add or remove.
+        Share* next      = nullptr;  // Next Share with room, by weight.
+    };
+
+    /// Inputs, besides child Size_policies, that the cached result is for.
+    struct Cache_key {
+        int length;
+        std::size_t child_count;
+
+        [[nodiscard]] auto operator==(Cache_key const& other) const -> bool
+        {
+            return length == other.length && child_count == other.child_count;
+        }
+    };
 
    private:
     std::size_t offset_ = 0;
 
+    Length_list lengths_;
+    Position_list positions_;
+    Cache_key cache_key_ = {0, 0};
+    bool is_cached_      = false;
+
+    // Scratch space, kept to avoid allocating on each layout.
+    std::vector<Share> shares_;
+    std::vector<Share*> by_weight_;
+
    private:
+    /// Give \p surplus cells to children below max, proportional to stretch.
     template <typename Children_span>
     void disperse(Children_span& children, int surplus)
     {
-        auto given_away = -1;
-        while (given_away != 0) {
-            given_away = 0;
-            for (auto iter = children.begin_max(); iter != children.end();
-                 ++iter) {
-                auto const& policy    = iter.get_policy();
-                auto const max_length = policy.max();
-                auto const stretch_ratio =
-                    policy.stretch() / children.total_stretch();
-                auto to_add = int(stretch_ratio * surplus);
-                if ((iter->length + to_add) > max_length)
-                    to_add = max_length - iter->length;
-                iter->length += to_add;
-                given_away += to_add;
-            }
-            surplus -= given_away;
+        shares_.clear();
+        for (auto iter = children.begin_max(); iter != children.end(); ++iter) {
+            auto const& policy = iter.get_policy();
+            shares_.push_back(
+                {&*iter, policy.max() - iter->length, policy.stretch()});
         }
-        this->disperse_leftovers(children, surplus);
+        this->distribute(surplus, children.total_stretch());
+        for (auto const& share : shares_)
+            share.dimension->length += share.amount;
     }
 
-    /// Stretch ratio can't split small surplus values into values > 1.0
+    /// Take \p deficit cells from children above min, inverse to stretch.
     template <typename Children_span>
-    void disperse_leftovers(Children_span& children, int surplus)
+    void reclaim(Children_span& children, int deficit)
     {
-        while (children.size() != 0 && surplus != 0) {
-            for (auto iter = children.begin_max();
-                 iter != children.end() && surplus != 0; ++iter) {
-                iter->length += 1;
-                --surplus;
-            }
+        shares_.clear();
+        for (auto iter = children.begin_min(); iter != children.end(); ++iter) {
+            auto const& policy = iter.get_policy();
+            shares_.push_back(
+                {&*iter, iter->length - policy.min(), 1. / policy.stretch()});
         }
+        this->distribute(deficit, children.total_inverse_stretch());
+        for (auto const& share : shares_)
+            share.dimension->length -= share.amount;
     }
 
-    template <typename Children_span>
-    void reclaim(Children_span& children, int deficit)
+    /// Split \p total cells between shares_, proportional to Share::weight.
+    /** Each round gives every Share with room int(weight / weight_sum * total)
+     *  cells, capped at its room, until a round gives nothing. Then leftover
+     *  cells go out one at a time in child order. \p first_weight_sum is used
+     *  for the first round, it also counts children that are already at their
+     *  limit, as the Layout_span calculates it.
+     *
+     *  Shares are visited in order of decreasing weight, so a round stops at
+     *  the first Share that would get zero cells, and full Shares are
+     *  unlinked. A round only touches Shares that receive cells. weight_sum
+     *  is summed again in child order, as the Layout_span does, only after
+     *  the first round and after rounds that fill a Share, so the results
+     *  match the Layout_span's to the last bit. */
+    void distribute(int total, double first_weight_sum)
     {
-        auto taken_back = -1;
-        while (taken_back != 0) {
-            taken_back = 0;
-            for (auto iter = children.begin_min(); iter != children.end();
-                 ++iter) {
-                auto const& policy    = iter.get_policy();
-                auto const min_length = static_cast<int>(policy.min());
-                auto const inverse_stretch_ratio =
-                    (1. / policy.stretch()) / children.total_inverse_stretch();
-                auto to_sub = static_cast<int>(inverse_stretch_ratio * deficit);
-                if ((static_cast<int>(iter->length) - to_sub) < min_length)
-                    to_sub = static_cast<int>(iter->length) - min_length;
-                iter->length -= to_sub;
-                taken_back += to_sub;
+        by_weight_.clear();
+        for (auto& share : shares_)
+            by_weight_.push_back(&share);
+        std::stable_sort(std::begin(by_weight_), std::end(by_weight_),
+                         [](Share const* a, Share const* b) {
+                             return a->weight > b->weight;
+                         });
+        for (auto i = 1uL; i < by_weight_.size(); ++i)
+            by_weight_[i - 1]->next = by_weight_[i];
+        Share* head = by_weight_.empty() ? nullptr : by_weight_.front();
+
+        auto weight_sum  = first_weight_sum;
+        auto is_resummed = false;
+        while (head != nullptr) {
+            auto given    = 0;
+            auto any_full = false;
+            auto* link    = &head;
+            while (*link != nullptr) {
+                auto& share       = **link;
+                auto const amount = static_cast<int>(
+                    share.weight / weight_sum * static_cast<double>(total));
+                if (amount == 0)
+                    break;
+                auto const add = std::min(amount, share.room);
+                share.amount += add;
+                share.room -= add;
+                given += add;
+                if (share.room == 0) {
+                    any_full = true;
+                    *link    = share.next;
+                }
+                else
+                    link = &share.next;
+            }
+            if (given == 0 || head == nullptr)
+                break;
+            total -= given;
+            if (any_full || !is_resummed) {
+                weight_sum  = this->remaining_weight();
+                is_resummed = true;
             }
-            deficit -= taken_back;
         }
-        this->reclaim_leftovers(children, deficit);
+
+        // Proportional rounds can't split small totals into whole cells.
+        auto given = -1;
+        while (total != 0 && given != 0) {
+            given = 0;
+            for (auto& share : shares_) {
+                if (total == given)
+                    break;
+                if (share.room != 0) {
+                    ++share.amount;
+                    --share.room;
+                    ++given;
+                }
+            }
+            total -= given;
+        }
     }
 
-    /// Stretch ratio can't split small deficit values into values > 1.0
-    template <typename Children_span>
-    void reclaim_leftovers(Children_span& children, int deficit)
+    /// Return the sum of the weights of Shares with room, in child order.
+    /** The Layout_span drops children at their limit from its sums between
+     *  rounds, and floating point addition depends on order. */
+    [[nodiscard]] auto remaining_weight() const -> double
     {
-        while (children.size() != 0 && deficit != 0) {
-            for (auto iter = children.begin_min();
-                 iter != children.end() && deficit != 0; ++iter, --deficit) {
-                iter->length -= 1;
-            }
+        auto sum = 0.;
+        for (auto const& share : shares_) {
+            if (share.room != 0)
+                sum += share.weight;
         }
+        return sum;
     }
 
     template <typename Children_span>
@@ -43,14 +43,61 @@ class Unique_space {
         return Position_list(lengths.size(), 0);
     }
 
+    /// Return calculate_lengths(parent), recalculated only when out of date.
+    /** The result is kept until invalidate() is called or the parent's
+     *  length, child count or the offset changes. */
+    [[nodiscard]] auto cached_lengths(Widget& parent) -> Length_list const&
+    {
+        auto const key =
+            Cache_key{typename Parameters::Secondary::get_length{}(parent),
+                      parent.child_count()};
+        if (is_cached_ && key == cache_key_)
+            return lengths_;
+        lengths_ = this->calculate_lengths(parent);
+        positions_.assign(lengths_.size(), 0);
+        cache_key_ = key;
+        is_cached_ = true;
+        return lengths_;
+    }
+
+    /// Return calculate_positions() of the last cached_lengths() result.
+    [[nodiscard]] auto cached_positions() const -> Position_list const&
+    {
+        return positions_;
+    }
+
+    /// Force the next cached_lengths() call to recalculate.
+    void invalidate() { is_cached_ = false; }
+
     /// Return the child Widget offset, the first widget included in the layout.
     [[nodiscard]] auto get_offset() const -> std::size_t { return offset_; }
 
     /// Sets the child Widget offset, does not do bounds checking.
-    void set_offset(std::size_t index) { offset_ = index; }
+    void set_offset(std::size_t index)
+    {
+        offset_ = index;
+        this->invalidate();
+    }
+
+   private:
+    /// Inputs, besides child Size_policies, that the cached result is for.
+    struct Cache_key {
+        int length;
+        std::size_t child_count;
+
+        [[nodiscard]] auto operator==(Cache_key const& other) const -> bool
+        {
+            return length == other.length && child_count == other.child_count;
+        }
+    };
 
    private:
     std::size_t offset_ = 0;
+
+    Length_list lengths_;
+    Position_list positions_;
+    Cache_key cache_key_ = {0, 0};
+    bool is_cached_      = false;
 };
 
 }  // namespace ox::layout::detail
@@ -1,11 +1,18 @@
 #ifndef TERMOX_WIDGET_LAYOUTS_SET_HPP
 #define TERMOX_WIDGET_LAYOUTS_SET_HPP
 #include <algorithm>
+#include <cstddef>
 #include <functional>
+#include <iterator>
 #include <memory>
 #include <type_traits>
+#include <utility>
+#include <vector>
 
 #include <termox/common/identity.hpp>
+#include <termox/system/event.hpp>
+#include <termox/system/system.hpp>
+#include <termox/widget/widget.hpp>
 
 namespace ox::layout {
 
@@ -13,6 +20,7 @@ namespace ox::layout {
 /** Projection transforms a Layout::Child_t into a comparable. */
 /** Comparison is fed the output of Projection, used to find insertion pos. */
 /** Comparison{}(Projection{}(element), Projection{}(child)); */
+/** Insertion and lookup are binary searches over the sorted children. */
 template <typename Layout_t,
           typename Projection = Identity,
           typename Comparison = std::less<
@@ -30,16 +38,46 @@ class Set : public Layout_t {
 
    public:
     /// Insert \p child into correct position based on Projection and Comparison
+    /** Inserted after any children with an equivalent key. */
     auto insert_child(std::unique_ptr<Child_t> child) -> Child_t&
     {
-        auto constexpr comp = [&](Child_t const& a, Child_t const& b) {
-            return Comparison{}(Projection{}(a), Projection{}(b));
+        auto const index = this->upper_bound(Projection{}(*child), 0,
+                                             this->child_count());
+        return this->Layout_t::insert_child(std::move(child), index);
+    }
+
+    /// Insert each of \p children into its sorted position.
+    /** The batch is sorted, then merged with the existing children in a single
+     *  pass. Layouts are updated once for the whole batch. */
+    void insert_children(std::vector<std::unique_ptr<Child_t>> children)
+    {
+        if (children.empty())
+            return;
+        auto const less = [](auto const& a, auto const& b) {
+            return Comparison{}(Set::key(*a), Set::key(*b));
         };
-        auto const children = this->get_children();
-        auto iter =
-            std::upper_bound(children.begin(), children.end(), *child, comp);
-        return this->Layout_t::insert_child(std::move(child),
-                                            iter.underlying().underlying());
+        std::stable_sort(std::begin(children), std::end(children), less);
+
+        auto inserted = std::vector<Widget*>{};
+        inserted.reserve(children.size());
+        for (auto const& child : children)
+            inserted.push_back(child.get());
+
+        auto& current     = this->children_;
+        auto const first  = this->upper_bound(Set::key(*children.front()), 0,
+                                              this->child_count());
+        auto merged       = typename Layout_t::Children_t{};
+        merged.reserve(current.size() + children.size());
+        std::move(std::begin(current), std::next(std::begin(current), first),
+                  std::back_inserter(merged));
+        // Existing children come first for equivalent keys.
+        std::merge(std::make_move_iterator(std::next(std::begin(current), first)),
+                   std::make_move_iterator(std::end(current)),
+                   std::make_move_iterator(std::begin(children)),
+                   std::make_move_iterator(std::end(children)),
+                   std::back_inserter(merged), less);
+        current = std::move(merged);
+        this->initialize_inserted(inserted, first);
     }
 
     /// Create a Widget and insert it into the list of children.
@@ -50,21 +88,98 @@ class Set : public Layout_t {
         static_assert(
             std::is_base_of_v<Child_t, Widget_t>,
             "layout::Set::make_child: Widget_t must be a Child_t type");
-        return this->insert_child(
-            std::make_unique<Widget_t>(std::forward<Args>(args)...));
+        auto child  = std::make_unique<Widget_t>(std::forward<Args>(args)...);
+        auto& found = *child;
+        this->insert_child(std::move(child));
+        return found;
     }
 
     /// Find a child widget by its key type(the result of the Projection fn).
-    /** Uses the Projection function on each child until a result equal to \p
-     *  key is found. Retuns nullptr if no child found. */
+    /** Binary search for the first child with a key equivalent to \p key.
+     *  Retuns nullptr if no child found. */
     [[nodiscard]] auto find_child(Key_t const& key) -> Child_t*
     {
-        return this->get_children().find(
-            [&key](auto const& c) { return Projection{}(c) == key; });
+        auto const index = this->lower_bound(key);
+        if (index == this->child_count() ||
+            Comparison{}(key, Set::key(*this->children_[index]))) {
+            return nullptr;
+        }
+        return &static_cast<Child_t&>(*this->children_[index]);
+    }
+
+    /// Find a child widget by its key type(the result of the Projection fn).
+    [[nodiscard]] auto find_child(Key_t const& key) const -> Child_t const*
+    {
+        return const_cast<Set&>(*this).find_child(key);
+    }
+
+    /// Move \p child to its sorted position after its key has changed.
+    /** Children between the old and new positions are shifted by one, a
+     *  Child_polished_event is posted if \p child moved. Returns false if
+     *  \p child is not a child of *this. */
+    auto update_position(Child_t const& child) -> bool
+    {
+        auto const at = this->find_child_position(&child);
+        if (at == -1uL)
+            return false;
+        auto const& key = Set::key(child);
+        auto const size = this->child_count();
+        auto const begin = std::begin(this->children_);
+        auto to          = at;
+        if (at != 0 && Comparison{}(key, Set::key(*this->children_[at - 1]))) {
+            to = this->upper_bound(key, 0, at);
+            std::rotate(std::next(begin, to), std::next(begin, at),
+                        std::next(begin, at + 1));
+        }
+        else if (at + 1 != size &&
+                 Comparison{}(Set::key(*this->children_[at + 1]), key)) {
+            to = this->upper_bound(key, at + 1, size) - 1;
+            std::rotate(std::next(begin, at), std::next(begin, at + 1),
+                        std::next(begin, to + 1));
+        }
+        if (to == at)
+            return true;
+        this->invalidate_child_indices(std::min(at, to));
+        System::post_event(Child_polished_event{*this, *this->children_[to]});
+        return true;
     }
 
    private:
     using Layout_t::append_child;
+    using Layout_t::append_children;
+
+   private:
+    /// Return the key of \p w, which must be a Child_t.
+    [[nodiscard]] static auto key(Widget const& w) -> Key_t
+    {
+        return Projection{}(static_cast<Child_t const&>(w));
+    }
+
+    /// Return the index of the first child in [first, last) after \p key.
+    [[nodiscard]] auto upper_bound(Key_t const& key,
+                                   std::size_t first,
+                                   std::size_t last) const -> std::size_t
+    {
+        auto const begin = std::cbegin(this->children_);
+        auto const found = std::upper_bound(
+            std::next(begin, first), std::next(begin, last), key,
+            [](Key_t const& k, auto const& child) {
+                return Comparison{}(k, Set::key(*child));
+            });
+        return std::distance(begin, found);
+    }
+
+    /// Return the index of the first child not before \p key.
+    [[nodiscard]] auto lower_bound(Key_t const& key) const -> std::size_t
+    {
+        auto const begin = std::cbegin(this->children_);
+        auto const found = std::lower_bound(
+            begin, std::cend(this->children_), key,
+            [](auto const& child, Key_t const& k) {
+                return Comparison{}(Set::key(*child), k);
+            });
+        return std::distance(begin, found);
+    }
 };
 
 /// Helper function to create an instance.
@@ -76,9 +191,9 @@ template <typename Layout_t,
                                        typename Layout_t::Child_t>>>>,
           typename... Args>
 [[nodiscard]] auto set(Args&&... args)
-    -> std::unique_ptr<Set<Projection, Comparison>>
+    -> std::unique_ptr<Set<Layout_t, Projection, Comparison>>
 {
-    return std::make_unique<Set<Projection, Comparison>>(
+    return std::make_unique<Set<Layout_t, Projection, Comparison>>(
         std::forward<Args>(args)...);
 }
 
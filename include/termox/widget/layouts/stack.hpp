@@ -16,6 +16,7 @@
 #include <termox/widget/area.hpp>
 #include <termox/widget/detail/link_lifetimes.hpp>
 #include <termox/widget/layout.hpp>
+#include <termox/widget/layouts/detail/layout_pass.hpp>
 #include <termox/widget/point.hpp>
 #include <termox/widget/widget.hpp>
 
@@ -26,7 +27,8 @@ namespace ox::layout {
  *  one at a time within the Stack. The active page determines which child
  *  Widget is currently displayed. */
 template <typename Child_t = Widget>
-class Stack : public Layout<Child_t> {
+class Stack : public Layout<Child_t>,
+              public layout::detail::Deferrable_layout {
    public:
     /// Emitted when the active page is changed, sends the new index along.
     sl::Signal<void(std::size_t)> page_changed;
@@ -50,8 +52,7 @@ class Stack : public Layout<Child_t> {
 
         active_page_->enable(this->is_enabled());
         // TODO move if enabled and force move if disabled?
-        this->move_active_page();
-        this->resize_active_page();
+        this->place_active_page();
         if (sets_focus_ && this->is_enabled())
             System::set_focus(*active_page_);
         this->page_changed(index);
@@ -199,13 +200,14 @@ class Stack : public Layout<Child_t> {
 
     auto move_event(Point new_position, Point old_position) -> bool override
     {
-        this->move_active_page();
+        if (!this->is_relayout_deferred())
+            this->place_active_page();
         return Layout<Child_t>::move_event(new_position, old_position);
     }
 
     auto resize_event(Area new_size, Area old_size) -> bool override
     {
-        this->resize_active_page();
+        this->place_active_page();
         return Layout<Child_t>::resize_event(new_size, old_size);
     }
 
@@ -216,21 +218,22 @@ class Stack : public Layout<Child_t> {
         return this->Layout<Child_t>::focus_in_event();
     }
 
+    void relayout() override { this->place_active_page(); }
+
    private:
     Child_t* active_page_ = nullptr;
     bool sets_focus_      = true;
 
    private:
-    void move_active_page()
+    /// Synchronously give the active page the geometry of *this.
+    void place_active_page()
     {
-        if (active_page_ != nullptr)
-            System::post_event(Move_event{*active_page_, this->top_left()});
-    }
-
-    void resize_active_page()
-    {
-        if (active_page_ != nullptr)
-            System::post_event(Resize_event{*active_page_, this->area()});
+        if (active_page_ != nullptr) {
+            auto* const deferred = layout::detail::apply_geometry(
+                *active_page_, this->top_left(), this->area());
+            if (deferred != nullptr)
+                deferred->relayout();
+        }
     }
 };
 
@@ -36,10 +36,11 @@ namespace ox::pipe {
     };
 }
 
-/// Widget -> std::vector<Widget*>
+/// Widget -> Descendants
+/** Pipes applied to the result visit each descendant without allocating. */
 [[nodiscard]] inline auto descendants()
 {
-    return [](auto&& w) { return get(w).get_descendants(); };
+    return [](auto&& w) { return detail::Descendants{get(w)}; };
 }
 
 // Generic Tools ---------------------------------------------------------------
@@ -1075,6 +1076,16 @@ auto operator|(Range<Iter_1, Iter_2> children,
 // clang-format on
 }
 
+/// Pipe operator for use with pipe::descendants(), parents before children.
+/** \p op must not add or remove Widgets, see Widget::for_each_descendant(). */
+template <typename F>
+auto operator|(pipe::detail::Descendants descendants, F&& op)
+    -> pipe::detail::Descendants
+{
+    descendants.root.for_each_descendant([&op](Widget& d) { d | op; });
+    return descendants;
+}
+
 /// Pipe operator for use with Widget::get_descendants.
 template <typename F>
 auto operator|(std::vector<Widget*> const& descendants, F&& op)
@@ -13,6 +13,7 @@
 #include <signals_light/signal.hpp>
 
 #include <termox/common/fps.hpp>
+#include <termox/common/lazy_signal.hpp>
 #include <termox/common/transform_view.hpp>
 #include <termox/painter/brush.hpp>
 #include <termox/painter/color.hpp>
@@ -42,8 +43,10 @@ class Widget {
     };
 
    private:
+    /* Signals are allocated on first connect, most are never connected to and
+     * each unconnected Signal costs a single pointer. */
     template <typename Signature>
-    using Signal = sl::Signal<Signature>;
+    using Signal = Lazy_signal<Signature>;
 
    public:
     // Event Signals - Alternatives to overriding virtual event handlers.
@@ -131,6 +134,12 @@ class Widget {
     Widget& operator=(Widget const&) = delete;
     Widget& operator=(Widget&&) = delete;
 
+    /// Allocates from the Widget_arena in build() on this thread, if any.
+    [[nodiscard]] static auto operator new(std::size_t size) -> void*;
+
+    /// Frees memory from Widget::operator new, arena or global.
+    static void operator delete(void* p) noexcept;
+
    public:
     /// Set the identifying name of the Widget.
     void set_name(std::string name);
@@ -139,7 +148,7 @@ class Widget {
     [[nodiscard]] auto name() const -> std::string const&;
 
     /// Return the ID number unique to this Widget.
-    [[nodiscard]] auto unique_id() const -> std::uint16_t;
+    [[nodiscard]] auto unique_id() const -> std::uint64_t;
 
     /// Used to fill in empty space that is not filled in by paint_event().
     void set_wallpaper(Glyph g);
@@ -231,6 +240,40 @@ class Widget {
     /// Return container of all descendants of self_.
     [[nodiscard]] auto get_descendants() const -> std::vector<Widget*>;
 
+    /// Call \p visit with each descendant, each parent before its children.
+    /** If \p visit returns bool, returning false stops the traversal early.
+     *  Returns false if the traversal was stopped. Allocates nothing, \p visit
+     *  must not add or remove Widgets from the tree, directly or by running
+     *  event handlers or Signal slots that might. Use get_descendants() when
+     *  \p visit can't guarantee that. */
+    template <typename F>
+    auto for_each_descendant(F&& visit) -> bool
+    {
+        return Widget::visit_pre_order(*this, visit);
+    }
+
+    /// Call \p visit with each descendant, each parent before its children.
+    template <typename F>
+    auto for_each_descendant(F&& visit) const -> bool
+    {
+        return Widget::visit_pre_order(*this, visit);
+    }
+
+    /// Call \p visit with each descendant, each parent after its children.
+    /** Early exit and allocation are the same as for_each_descendant(). */
+    template <typename F>
+    auto for_each_descendant_post_order(F&& visit) -> bool
+    {
+        return Widget::visit_post_order(*this, visit);
+    }
+
+    /// Call \p visit with each descendant, each parent after its children.
+    template <typename F>
+    auto for_each_descendant_post_order(F&& visit) const -> bool
+    {
+        return Widget::visit_post_order(*this, visit);
+    }
+
     /// Set if the brush is applied to the wallpaper Glyph.
     void paint_wallpaper_with_brush(bool paints = true);
 
@@ -384,7 +427,7 @@ class Widget {
     std::string name_;
     Widget* parent_ = nullptr;
     Glyph wallpaper_;
-    std::set<Widget*> event_filters_;
+    std::unique_ptr<std::set<Widget*>> event_filters_;  // Allocated on use.
 
     // Top left point of *this, relative to the top left of the screen.
     Point top_left_position_ = {0, 0};
@@ -392,7 +435,53 @@ class Widget {
     // The entire area of the widget.
     Area area_ = {0, 0};
 
-    std::uint16_t const unique_id_;
+    std::uint64_t const unique_id_;
+
+    // Index of *this in parent's children, maintained lazily by Layout.
+    std::size_t cached_child_index_ = 0;
+
+   private:
+    /// Call \p visit with \p w, returns false if \p visit asked to stop.
+    template <typename F, typename Widget_t>
+    static auto call_visitor(F& visit, Widget_t& w) -> bool
+    {
+        if constexpr (std::is_same_v<std::invoke_result_t<F&, Widget_t&>,
+                                     bool>) {
+            return visit(w);
+        }
+        else {
+            visit(w);
+            return true;
+        }
+    }
+
+    /// Recursive pre-order traversal, \p Self is Widget or Widget const.
+    template <typename Self, typename F>
+    static auto visit_pre_order(Self& self, F& visit) -> bool
+    {
+        for (auto const& child_ptr : self.children_) {
+            auto& child = static_cast<Self&>(*child_ptr);
+            if (!Widget::call_visitor(visit, child) ||
+                !Widget::visit_pre_order(child, visit)) {
+                return false;
+            }
+        }
+        return true;
+    }
+
+    /// Recursive post-order traversal, \p Self is Widget or Widget const.
+    template <typename Self, typename F>
+    static auto visit_post_order(Self& self, F& visit) -> bool
+    {
+        for (auto const& child_ptr : self.children_) {
+            auto& child = static_cast<Self&>(*child_ptr);
+            if (!Widget::visit_post_order(child, visit) ||
+                !Widget::call_visitor(visit, child)) {
+                return false;
+            }
+        }
+        return true;
+    }
 
    public:
     /// Should only be used by Move_event send() function.
@@ -403,6 +492,12 @@ class Widget {
 
     /// Should only be used by Layout.
     void set_parent(Widget* parent);
+
+    /// Should only be used by Layout, caches the index of *this in parent.
+    void set_cached_child_index(std::size_t index);
+
+    /// Should only be used by Layout, might be out of date.
+    [[nodiscard]] auto cached_child_index() const -> std::size_t;
 };
 
 /// Helper function to create a Widget instance.
@@ -0,0 +1,91 @@
+#ifndef TERMOX_WIDGET_WIDGET_ARENA_HPP
+#define TERMOX_WIDGET_WIDGET_ARENA_HPP
+#include <cstddef>
+#include <type_traits>
+#include <utility>
+
+namespace ox {
+
+/// Monotonic memory for building and tearing down large Widget trees.
+/** Widgets are allocated from the arena only while a build() call on it is
+ *  running, and only on the thread that called it. Widgets constructed
+ *  anywhere else come from the global operator new. Ownership is unchanged,
+ *  Widgets are still held by std::unique_ptr<Widget> with the default
+ *  deleter.
+ *
+ *  Deleting an arena Widget runs its destructor, but its memory is only reused
+ *  once every Widget allocated from the arena has been deleted. A tree that
+ *  stays up while its Widgets are replaced grows the arena by every
+ *  replacement, build such a tree without an arena, or build each short lived
+ *  subtree in its own arena. The arena may be destroyed before its Widgets,
+ *  the memory is then freed along with the last of them. An arena is not
+ *  thread safe, its Widgets must be deleted on the thread that built them. */
+class Widget_arena {
+   private:
+    struct Storage;
+
+    /// Makes an arena the source of Widget allocations on the current thread.
+    /** The previously active arena, if any, is restored on destruction. */
+    class Scope {
+       public:
+        explicit Scope(Widget_arena& arena);
+
+        ~Scope();
+
+        Scope(Scope const&) = delete;
+        Scope(Scope&&)      = delete;
+        auto operator=(Scope const&) -> Scope& = delete;
+        auto operator=(Scope&&) -> Scope& = delete;
+
+       private:
+        Storage* previous_;
+    };
+
+   public:
+    /// Memory is reserved in blocks of at least \p block_size bytes.
+    explicit Widget_arena(std::size_t block_size = 256 * 1'024);
+
+    ~Widget_arena();
+
+    Widget_arena(Widget_arena const&) = delete;
+    Widget_arena(Widget_arena&&)      = delete;
+    auto operator=(Widget_arena const&) -> Widget_arena& = delete;
+    auto operator=(Widget_arena&&) -> Widget_arena& = delete;
+
+   public:
+    /// Call \p build and return its result, allocating its Widgets from *this.
+    /** Every Widget constructed on this thread until \p build returns is
+     *  allocated from *this, including the children a Layout constructor
+     *  makes. Calls may be nested, the innermost arena is used. */
+    template <typename F>
+    auto build(F&& build) -> std::invoke_result_t<F>
+    {
+        auto const scope = Scope{*this};
+        return std::forward<F>(build)();
+    }
+
+    /// Return the number of Widgets allocated from *this and not yet deleted.
+    [[nodiscard]] auto live_count() const -> std::size_t;
+
+    /// Return the total size of the memory blocks held by *this.
+    [[nodiscard]] auto reserved_bytes() const -> std::size_t;
+
+   public:
+    /// Allocate \p size bytes from the arena active on this thread.
+    /** Falls back to the global operator new if no arena is active. Used by
+     *  Widget::operator new. */
+    [[nodiscard]] static auto allocate(std::size_t size) -> void*;
+
+    /// Free memory returned from allocate(), null is a no-op.
+    /** Memory from an arena is found by address, not by a header, so Widgets
+     *  from the global operator new cost nothing extra. */
+    static void deallocate(void* p) noexcept;
+
+   private:
+    Storage* storage_;
+
+    static thread_local Storage* current_;
+};
+
+}  // namespace ox
+#endif  // TERMOX_WIDGET_WIDGET_ARENA_HPP
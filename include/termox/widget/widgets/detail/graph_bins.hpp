@@ -0,0 +1,148 @@
+#ifndef TERMOX_WIDGET_WIDGETS_DETAIL_GRAPH_BINS_HPP
+#define TERMOX_WIDGET_WIDGETS_DETAIL_GRAPH_BINS_HPP
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <optional>
+#include <utility>
+#include <vector>
+
+#include <termox/painter/color.hpp>
+#include <termox/widget/area.hpp>
+#include <termox/widget/boundary.hpp>
+#include <termox/widget/point.hpp>
+
+namespace ox::detail {
+
+/// Return the Braille dot mask cooresponding to the fractional parts of inputs.
+[[nodiscard]] inline auto to_cell_mask(double h_offset, double v_offset)
+    -> std::uint8_t
+{
+    auto const h_cell = h_offset - std::floor(h_offset);
+    auto const v_cell = v_offset - std::floor(v_offset);
+    if (h_cell < 0.5) {
+        if (v_cell < 0.25)
+            return 0b00000001;
+        else if (v_cell < 0.5)
+            return 0b00000010;
+        else if (v_cell < 0.75)
+            return 0b00000100;
+        else
+            return 0b01000000;
+    }
+    else {
+        if (v_cell < 0.25)
+            return 0b00001000;
+        else if (v_cell < 0.5)
+            return 0b00010000;
+        else if (v_cell < 0.75)
+            return 0b00100000;
+        else
+            return 0b10000000;
+    }
+}
+
+/// Additive unicode braille combining.
+[[nodiscard]] inline auto braille_combine(char32_t braille, std::uint8_t mask)
+    -> char32_t
+{
+    return braille | mask;
+}
+
+/// Top and bottom half-block Colors of a single Color_graph cell.
+struct Half_block_cell {
+    std::optional<Color> top    = std::nullopt;
+    std::optional<Color> bottom = std::nullopt;
+};
+
+/// Return true if neither half of \p a or \p b differs.
+[[nodiscard]] inline auto operator==(Half_block_cell const& a,
+                                     Half_block_cell const& b) -> bool
+{
+    return a.top == b.top && a.bottom == b.bottom;
+}
+
+/// Cache of Graph Coordinates mapped onto the terminal cells of a Graph.
+/** Holds one Cell_t per cell of the Graph's Area. Coordinates are folded into
+ *  their cell once, later updates only map Coordinates appended since the last
+ *  update, so painting is proportional to the Area, not the Coordinate count.
+ *  The grid is rebuilt from scratch when the Area or Boundary changes, or after
+ *  a call to invalidate(). */
+template <typename Number_t, typename Cell_t>
+class Graph_bins {
+   public:
+    /// Discard all bins, the next update() will rebuild from the beginning.
+    void invalidate() { is_valid_ = false; }
+
+    /// Bring the bins up to date with \p coordinates.
+    /** \p get_xy returns the Coordinate of an element, it must have x and y
+     *  members. fold(Cell_t&, h_offset, v_offset, element) is called in order
+     *  for each element within \p b, offsets are in cells from the top left. */
+    template <typename Container, typename Get_xy, typename Fold>
+    void update(Area area,
+                Boundary<Number_t> const& b,
+                Container const& coordinates,
+                Get_xy&& get_xy,
+                Fold&& fold)
+    {
+        if (!is_valid_ || area != area_ || !is_same(b, boundary_) ||
+            binned_ > coordinates.size()) {
+            area_     = area;
+            boundary_ = b;
+            binned_   = 0;
+            is_valid_ = true;
+            cells_.assign((std::size_t)area.width * area.height, Cell_t{});
+        }
+        auto const h_ratio = (double)area.width / (Number_t)(b.east - b.west);
+        auto const v_ratio =
+            (double)area.height / (Number_t)(b.north - b.south);
+        for (; binned_ < coordinates.size(); ++binned_) {
+            auto const& element = coordinates[binned_];
+            auto const c        = get_xy(element);
+            auto const h_offset = h_ratio * (Number_t)(c.x - b.west);
+            auto const v_offset =
+                area.height - v_ratio * (Number_t)(c.y - b.south);
+            if (h_offset < 0 || h_offset >= area.width)
+                continue;
+            if (v_offset < 0 || v_offset >= area.height)
+                continue;
+            auto const index =
+                (std::size_t)v_offset * area.width + (std::size_t)h_offset;
+            fold(cells_[index], h_offset, v_offset, element);
+        }
+    }
+
+    /// Call \p visit(Point, Cell_t const&) for each cell with a Coordinate.
+    /** Cells equal to a default constructed Cell_t are skipped. Rows are
+     *  visited top to bottom, left to right. */
+    template <typename Visitor>
+    void for_each(Visitor&& visit) const
+    {
+        auto const empty = Cell_t{};
+        auto index       = std::size_t{0};
+        for (auto y = 0; y < area_.height; ++y) {
+            for (auto x = 0; x < area_.width; ++x, ++index) {
+                if (!(cells_[index] == empty))
+                    visit(Point{x, y}, cells_[index]);
+            }
+        }
+    }
+
+   private:
+    bool is_valid_               = false;
+    Area area_                   = {0, 0};
+    Boundary<Number_t> boundary_ = {};
+    std::size_t binned_          = 0;
+    std::vector<Cell_t> cells_;
+
+   private:
+    [[nodiscard]] static auto is_same(Boundary<Number_t> const& a,
+                                      Boundary<Number_t> const& b) -> bool
+    {
+        return a.west == b.west && a.east == b.east && a.north == b.north &&
+               a.south == b.south;
+    }
+};
+
+}  // namespace ox::detail
+#endif  // TERMOX_WIDGET_WIDGETS_DETAIL_GRAPH_BINS_HPP
@@ -3,26 +3,34 @@
 #include <algorithm>
 #include <cassert>
 #include <cmath>
+#include <cstddef>
 #include <cstdint>
 #include <iterator>
 #include <memory>
+#include <mutex>
 #include <type_traits>
 #include <utility>
 #include <vector>
 
+#include <termox/common/fps.hpp>
+#include <termox/common/lockable.hpp>
+#include <termox/common/span.hpp>
 #include <termox/painter/color.hpp>
 #include <termox/painter/glyph.hpp>
 #include <termox/painter/painter.hpp>
 #include <termox/widget/boundary.hpp>
 #include <termox/widget/point.hpp>
 #include <termox/widget/widget.hpp>
+#include <termox/widget/widgets/detail/graph_bins.hpp>
 
 namespace ox {
 
 /// Bounded box that can display added Coordinates within the Boundary.
 /** X axis is horizontal and increasing from left to right.
  *  Y axis is vertical and increasing from bottom to top.
- *  Uses Braille characters, allowing up to 8 points per terminal cell. */
+ *  Uses Braille characters, allowing up to 8 points per terminal cell. Points
+ *  are binned into a per cell dot mask that is only rebuilt on a change of
+ *  Boundary, size or reset(), added points only update their own cell. */
 template <typename Number_t = double>
 class Graph : public Widget {
    public:
@@ -71,6 +79,7 @@ class Graph : public Widget {
     void reset(std::vector<Coordinate> x)
     {
         coordinates_ = std::move(x);
+        bins_.invalidate();
         this->update();
     }
 
@@ -84,6 +93,7 @@ class Graph : public Widget {
             "Must add with a iterators pointing to Coordinates.");
         coordinates_.clear();
         std::copy(first, last, std::back_inserter(coordinates_));
+        bins_.invalidate();
         this->update();
     }
 
@@ -94,10 +104,23 @@ class Graph : public Widget {
         this->update();
     }
 
+    /// Append copies of Coordinates given by iterators, repaints once.
+    template <typename Iter1_t, typename Iter2_t>
+    void add(Iter1_t first, Iter2_t last)
+    {
+        static_assert(
+            std::is_same_v<typename std::iterator_traits<Iter1_t>::value_type,
+                           Coordinate>,
+            "Must add with a iterators pointing to Coordinates.");
+        std::copy(first, last, std::back_inserter(coordinates_));
+        this->update();
+    }
+
     /// Remove all points from the Graph and repaint.
     void clear()
     {
         coordinates_.clear();
+        bins_.invalidate();
         this->update();
     }
 
@@ -110,75 +133,24 @@ class Graph : public Widget {
    protected:
     auto paint_event(Painter& p) -> bool override
     {
-        auto const area = this->area();
-        auto const h_ratio =
-            (double)area.width / distance(boundary_.west, boundary_.east);
-        auto const v_ratio =
-            (double)area.height / distance(boundary_.south, boundary_.north);
-
-        for (auto const c : coordinates_) {
-            auto const h_offset = h_ratio * distance(boundary_.west, c.x);
-            auto const v_offset =
-                area.height - v_ratio * distance(boundary_.south, c.y);
-            if (h_offset >= area.width)  // h_offset already can't be negative.
-                continue;
-            if (v_offset >= area.height || v_offset < 0)
-                continue;
-            auto const point = Point{(int)h_offset, (int)v_offset};
-            auto const mask  = this->to_cell_mask(h_offset, v_offset);
-            auto current     = p.at(point);
-            current.symbol   = combine(current.symbol, mask);
+        bins_.update(this->area(), boundary_, coordinates_,
+                     [](Coordinate c) { return c; },
+                     [](std::uint8_t& mask, double h_offset, double v_offset,
+                        Coordinate) {
+                         mask |= detail::to_cell_mask(h_offset, v_offset);
+                     });
+        bins_.for_each([&p](Point point, std::uint8_t mask) {
+            auto current   = p.at(point);
+            current.symbol = detail::braille_combine(current.symbol, mask);
             p.put(current, point);
-        }
+        });
         return Widget::paint_event(p);
     }
 
    private:
     Boundary<Number_t> boundary_;
     std::vector<Coordinate> coordinates_;
-
-   private:
-    /// Finds the distance between two values. It's just subtraction.
-    [[nodiscard]] static auto distance(Number_t smaller, Number_t larger)
-        -> Number_t
-    {
-        return larger - smaller;
-    }
-
-    /// Return the cell mask cooresponding to the fractional parts of inputs.
-    [[nodiscard]] static auto to_cell_mask(double h_offset, double v_offset)
-        -> std::uint8_t
-    {
-        auto const h_cell = h_offset - std::floor(h_offset);
-        auto const v_cell = v_offset - std::floor(v_offset);
-        if (h_cell < 0.5) {
-            if (v_cell < 0.25)
-                return 0b00000001;
-            else if (v_cell < 0.5)
-                return 0b00000010;
-            else if (v_cell < 0.75)
-                return 0b00000100;
-            else
-                return 0b01000000;
-        }
-        else {
-            if (v_cell < 0.25)
-                return 0b00001000;
-            else if (v_cell < 0.5)
-                return 0b00010000;
-            else if (v_cell < 0.75)
-                return 0b00100000;
-            else
-                return 0b10000000;
-        }
-    }
-
-    /// Additive unicode braille combining.
-    [[nodiscard]] static auto combine(char32_t braille, std::uint8_t mask)
-        -> char32_t
-    {
-        return braille | mask;
-    }
+    detail::Graph_bins<Number_t, std::uint8_t> bins_;
 };
 
 /// Helper function to create a Graph instance.
@@ -199,10 +171,229 @@ template <typename Number_t = double>
     return std::make_unique<Graph<Number_t>>(std::move(p));
 }
 
+/// Braille graph of the last N samples of a time series.
+/** Holds a fixed capacity ring buffer, once full each new sample replaces the
+ *  oldest. The Boundary scrolls along the x axis with the samples, the oldest
+ *  sample is drawn in the left most dot column and the newest in the right
+ *  most, the y axis range is fixed. Samples must be appended with
+ *  non-decreasing x values. append() may be called from any thread, samples
+ *  are moved into the window and repainted at most once per frame after
+ *  start() is called. */
+template <typename Number_t = double>
+class Streaming_graph : public Widget, private Lockable<std::mutex> {
+   public:
+    /// x is horizontal, y is vertical.
+    struct Coordinate {
+        Number_t x;
+        Number_t y;
+    };
+
+    struct Parameters {
+        std::size_t capacity = 1'024;
+        Number_t south       = 0;
+        Number_t north       = 1;
+    };
+
+   public:
+    /// Create a Streaming_graph holding the last \p capacity samples.
+    /** \p south and \p north are the fixed y axis bounds. */
+    explicit Streaming_graph(std::size_t capacity = 1'024,
+                             Number_t south       = 0,
+                             Number_t north       = 1)
+        : capacity_{capacity}, boundary_{0, 1, north, south}
+    {
+        assert(capacity > 0 && south < north);
+        ring_.reserve(capacity_);
+        auto constexpr empty_braille = U'⠀';
+        this->set_wallpaper(empty_braille);
+    }
+
+    /// Create a Streaming_graph with given Parameters.
+    explicit Streaming_graph(Parameters p)
+        : Streaming_graph{p.capacity, p.south, p.north}
+    {}
+
+    ~Streaming_graph() { this->stop(); }
+
+   public:
+    /// Queue a batch of samples to be added on the next frame.
+    /** Thread safe, does not touch the Widget. If more than capacity() samples
+     *  are queued between frames, only the newest capacity() are kept. */
+    void append(Span<Coordinate const> batch)
+    {
+        auto const lock = this->Lockable::lock();
+        pending_.insert(std::end(pending_), std::begin(batch), std::end(batch));
+        if (pending_.size() >= 2 * capacity_) {
+            auto const excess = pending_.size() - capacity_;
+            pending_.erase(std::begin(pending_),
+                           std::next(std::begin(pending_), excess));
+        }
+    }
+
+    /// Move queued samples into the window and repaint if there were any.
+    /** Called on each Timer_event after start(), can be called directly if the
+     *  Widget is not animated. Must be called from the event loop. */
+    void flush()
+    {
+        {
+            auto const lock = this->Lockable::lock();
+            std::swap(pending_, incoming_);
+        }
+        if (incoming_.empty())
+            return;
+        auto const skip = incoming_.size() > capacity_
+                              ? incoming_.size() - capacity_
+                              : std::size_t{0};
+        for (auto i = skip; i < incoming_.size(); ++i)
+            this->push(incoming_[i]);
+        incoming_.clear();
+        boundary_.west = this->at(0).x;
+        boundary_.east = this->at(this->size() - 1).x;
+        this->update();
+    }
+
+    /// Start moving queued samples into the window at \p fps.
+    void start(FPS fps = FPS{30}) { this->enable_animation(fps); }
+
+    /// Stop moving queued samples into the window.
+    void stop() { this->disable_animation(); }
+
+    /// Remove all samples, including those queued, and repaint.
+    void clear()
+    {
+        {
+            auto const lock = this->Lockable::lock();
+            pending_.clear();
+        }
+        ring_.clear();
+        head_          = 0;
+        boundary_.west = 0;
+        boundary_.east = 1;
+        this->update();
+    }
+
+    /// Set the fixed y axis bounds and repaint.
+    void set_range(Number_t south, Number_t north)
+    {
+        assert(south < north);
+        boundary_.south = south;
+        boundary_.north = north;
+        this->update();
+    }
+
+    /// Return the current Boundary, west and east follow the window.
+    [[nodiscard]] auto boundary() const -> Boundary<Number_t>
+    {
+        return boundary_;
+    }
+
+    /// Return the maximum number of samples displayed.
+    [[nodiscard]] auto capacity() const -> std::size_t { return capacity_; }
+
+    /// Return the number of samples currently in the window.
+    [[nodiscard]] auto size() const -> std::size_t { return ring_.size(); }
+
+    /// Return the sample at \p i within the window, zero is the oldest.
+    /** \p i must be less than size(). */
+    [[nodiscard]] auto at(std::size_t i) const -> Coordinate
+    {
+        return ring_[(head_ + i) % ring_.size()];
+    }
+
+   protected:
+    auto paint_event(Painter& p) -> bool override
+    {
+        auto const area = this->area();
+        if (ring_.empty() || area.width == 0 || area.height == 0)
+            return Widget::paint_event(p);
+        masks_.assign((std::size_t)area.width * area.height, 0);
+
+        // Dot columns are half a cell wide, the newest sample is centered in
+        // the right half of the last cell.
+        auto const x_span  = boundary_.east - boundary_.west;
+        auto const h_ratio = x_span == 0 ? 0. : (area.width - 0.5) / x_span;
+        auto const v_ratio =
+            (double)area.height / (boundary_.north - boundary_.south);
+        for (auto const c : ring_) {
+            auto const h_offset = h_ratio * (c.x - boundary_.west);
+            auto const v_offset =
+                area.height - v_ratio * (c.y - boundary_.south);
+            if (h_offset < 0 || h_offset >= area.width)
+                continue;
+            if (v_offset < 0 || v_offset >= area.height)
+                continue;
+            auto const index =
+                (std::size_t)v_offset * area.width + (std::size_t)h_offset;
+            masks_[index] |= detail::to_cell_mask(h_offset, v_offset);
+        }
+
+        auto index = std::size_t{0};
+        for (auto y = 0; y < area.height; ++y) {
+            for (auto x = 0; x < area.width; ++x, ++index) {
+                if (masks_[index] == 0)
+                    continue;
+                auto current   = p.at({x, y});
+                current.symbol =
+                    detail::braille_combine(current.symbol, masks_[index]);
+                p.put(current, {x, y});
+            }
+        }
+        return Widget::paint_event(p);
+    }
+
+    auto timer_event() -> bool override
+    {
+        this->flush();
+        return Widget::timer_event();
+    }
+
+   private:
+    std::size_t capacity_;
+    Boundary<Number_t> boundary_;
+    std::vector<Coordinate> ring_;
+    std::size_t head_ = 0;  // Index of the oldest sample once ring_ is full.
+
+    std::vector<Coordinate> pending_;   // Guarded by the Lockable mutex.
+    std::vector<Coordinate> incoming_;  // Swapped with pending_ on flush().
+    std::vector<std::uint8_t> masks_;   // Per cell Braille dots, reused.
+
+   private:
+    /// Add \p c as the newest sample, replacing the oldest if full.
+    void push(Coordinate c)
+    {
+        if (ring_.size() < capacity_) {
+            ring_.push_back(c);
+            return;
+        }
+        ring_[head_] = c;
+        head_        = (head_ + 1) % capacity_;
+    }
+};
+
+/// Helper function to create a Streaming_graph instance.
+template <typename Number_t = double>
+[[nodiscard]] auto streaming_graph(std::size_t capacity = 1'024,
+                                   Number_t south       = 0,
+                                   Number_t north       = 1)
+    -> std::unique_ptr<Streaming_graph<Number_t>>
+{
+    return std::make_unique<Streaming_graph<Number_t>>(capacity, south, north);
+}
+
+/// Helper function to create a Streaming_graph instance.
+template <typename Number_t = double>
+[[nodiscard]] auto streaming_graph(
+    typename Streaming_graph<Number_t>::Parameters p)
+    -> std::unique_ptr<Streaming_graph<Number_t>>
+{
+    return std::make_unique<Streaming_graph<Number_t>>(std::move(p));
+}
+
 /// Bounded box that can display added Color Coordinates within the Boundary.
 /** X axis is horizontal and increasing from left to right.
  *  Y axis is vertical and increasing from bottom to top.
- *  Uses half-block characters, allowing two points per terminal cell. */
+ *  Uses half-block characters, allowing two points per terminal cell. Points
+ *  are binned into per cell Colors, see Graph. */
 template <typename Number_t = double>
 class Color_graph : public Widget {
    public:
@@ -251,6 +442,7 @@ class Color_graph : public Widget {
     void reset(std::vector<std::pair<Coordinate, Color>> x)
     {
         coordinates_ = std::move(x);
+        bins_.invalidate();
         this->update();
     }
 
@@ -265,6 +457,7 @@ class Color_graph : public Widget {
             "Must add with a iterators pointing to Coordinates, Color pair.");
         coordinates_.clear();
         std::copy(first, last, std::back_inserter(coordinates_));
+        bins_.invalidate();
         this->update();
     }
 
@@ -275,10 +468,23 @@ class Color_graph : public Widget {
         this->update();
     }
 
+    /// Append copies of <Coordinate, Color>s given by iterators, repaints once.
+    template <typename Iter1_t, typename Iter2_t>
+    void add(Iter1_t first, Iter2_t last)
+    {
+        static_assert(
+            std::is_same_v<typename std::iterator_traits<Iter1_t>::value_type,
+                           std::pair<Coordinate, Color>>,
+            "Must add with a iterators pointing to Coordinates, Color pair.");
+        std::copy(first, last, std::back_inserter(coordinates_));
+        this->update();
+    }
+
     /// Remove all points from the Graph and repaint.
     void clear()
     {
         coordinates_.clear();
+        bins_.invalidate();
         this->update();
     }
 
@@ -292,40 +498,32 @@ class Color_graph : public Widget {
    protected:
     auto paint_event(Painter& p) -> bool override
     {
-        auto const area = this->area();
-        auto const h_ratio =
-            (double)area.width / distance(boundary_.west, boundary_.east);
-        auto const v_ratio =
-            (double)area.height / distance(boundary_.south, boundary_.north);
-
-        for (auto const& [coord, color] : coordinates_) {
-            auto const h_offset = h_ratio * distance(boundary_.west, coord.x);
-            auto const v_offset =
-                area.height - v_ratio * distance(boundary_.south, coord.y);
-            if (h_offset >= area.width)  // h_offset already can't be negative.
-                continue;
-            if (v_offset >= area.height || v_offset < 0)
-                continue;
-            auto const point  = Point{(int)h_offset, (int)v_offset};
-            auto const is_top = is_top_region(v_offset);
-            auto const glyph  = combine(p.at(point), is_top, color);
+        bins_.update(this->area(), boundary_, coordinates_,
+                     [](auto const& pair) { return pair.first; },
+                     [](detail::Half_block_cell& cell, double, double v_offset,
+                        auto const& pair) {
+                         if (is_top_region(v_offset))
+                             cell.top = pair.second;
+                         else
+                             cell.bottom = pair.second;
+                     });
+        bins_.for_each([&p](Point point, detail::Half_block_cell const& cell) {
+            auto glyph = p.at(point);
+            if (cell.top.has_value())
+                glyph = combine(glyph, true, *cell.top);
+            if (cell.bottom.has_value())
+                glyph = combine(glyph, false, *cell.bottom);
             p.put(glyph, point);
-        }
+        });
         return Widget::paint_event(p);
     }
 
    private:
     Boundary<Number_t> boundary_;
     std::vector<std::pair<Coordinate, Color>> coordinates_;
+    detail::Graph_bins<Number_t, detail::Half_block_cell> bins_;
 
    private:
-    /// Finds the distance between two values. It's just subtraction.
-    [[nodiscard]] static auto distance(Number_t smaller, Number_t larger)
-        -> Number_t
-    {
-        return larger - smaller;
-    }
-
     /// Return true if the given offset cooresponds to the top region.
     /** False if is bottom half. */
     [[nodiscard]] static auto is_top_region(double v_offset) -> bool
@@ -368,7 +566,8 @@ template <typename Number_t = double>
 /// Bounded box that can display added Color Coordinates within a static Bound.
 /** X axis is horizontal and increasing from left to right.
  *  Y axis is vertical and increasing from bottom to top.
- *  Uses half-block characters, allowing two points per terminal cell. */
+ *  Uses half-block characters, allowing two points per terminal cell. Points
+ *  are binned into per cell Colors, see Graph. */
 template <typename Number_t,
           Number_t west,
           Number_t east,
@@ -412,6 +611,7 @@ class Color_graph_static_bounds : public Widget {
     void reset(std::vector<std::pair<Coordinate, Color>> x)
     {
         coordinates_ = std::move(x);
+        bins_.invalidate();
         this->update();
     }
 
@@ -426,6 +626,7 @@ class Color_graph_static_bounds : public Widget {
             "Must add with a iterators pointing to Coordinates, Color pair.");
         coordinates_.clear();
         std::copy(first, last, std::back_inserter(coordinates_));
+        bins_.invalidate();
         this->update();
     }
 
@@ -436,10 +637,23 @@ class Color_graph_static_bounds : public Widget {
         this->update();
     }
 
+    /// Append copies of <Coordinate, Color>s given by iterators, repaints once.
+    template <typename Iter1_t, typename Iter2_t>
+    void add(Iter1_t first, Iter2_t last)
+    {
+        static_assert(
+            std::is_same_v<typename std::iterator_traits<Iter1_t>::value_type,
+                           std::pair<Coordinate, Color>>,
+            "Must add with a iterators pointing to Coordinates, Color pair.");
+        std::copy(first, last, std::back_inserter(coordinates_));
+        this->update();
+    }
+
     /// Remove all points from the Graph and repaint.
     void clear()
     {
         coordinates_.clear();
+        bins_.invalidate();
         this->update();
     }
 
@@ -453,27 +667,23 @@ class Color_graph_static_bounds : public Widget {
    protected:
     auto paint_event(Painter& p) -> bool override
     {
-        constexpr double h_distance = distance(boundary_.west, boundary_.east);
-        constexpr double v_distance =
-            distance(boundary_.south, boundary_.north);
-
-        auto const area    = this->area();
-        auto const h_ratio = (double)area.width / h_distance;
-        auto const v_ratio = (double)area.height / v_distance;
-
-        for (auto const& [coord, color] : coordinates_) {
-            auto const h_offset = h_ratio * distance(boundary_.west, coord.x);
-            auto const v_offset =
-                area.height - (v_ratio * distance(boundary_.south, coord.y));
-            if (h_offset >= area.width)  // h_offset already can't be negative.
-                continue;
-            if (v_offset >= area.height || v_offset < 0)
-                continue;
-            auto const point  = Point{(int)h_offset, (int)v_offset};
-            auto const is_top = is_top_region(v_offset);
-            auto const glyph  = combine(p.at(point), is_top, color);
+        bins_.update(this->area(), boundary_, coordinates_,
+                     [](auto const& pair) { return pair.first; },
+                     [](detail::Half_block_cell& cell, double, double v_offset,
+                        auto const& pair) {
+                         if (is_top_region(v_offset))
+                             cell.top = pair.second;
+                         else
+                             cell.bottom = pair.second;
+                     });
+        bins_.for_each([&p](Point point, detail::Half_block_cell const& cell) {
+            auto glyph = p.at(point);
+            if (cell.top.has_value())
+                glyph = combine(glyph, true, *cell.top);
+            if (cell.bottom.has_value())
+                glyph = combine(glyph, false, *cell.bottom);
             p.put(glyph, point);
-        }
+        });
         return Widget::paint_event(p);
     }
 
@@ -482,15 +692,9 @@ class Color_graph_static_bounds : public Widget {
         Boundary<Number_t>{west, east, north, south};
 
     std::vector<std::pair<Coordinate, Color>> coordinates_;
+    detail::Graph_bins<Number_t, detail::Half_block_cell> bins_;
 
    private:
-    /// Finds the distance between two values. It's just subtraction.
-    [[nodiscard]] static constexpr auto distance(Number_t smaller,
-                                                 Number_t larger) -> Number_t
-    {
-        return larger - smaller;
-    }
-
     /// Return true if the given offset cooresponds to the top region.
     /** False if is bottom half. */
     [[nodiscard]] static auto is_top_region(double v_offset) -> bool
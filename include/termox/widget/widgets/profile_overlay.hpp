@@ -0,0 +1,67 @@
+#ifndef TERMOX_WIDGET_WIDGETS_PROFILE_OVERLAY_HPP
+#define TERMOX_WIDGET_WIDGETS_PROFILE_OVERLAY_HPP
+#include <chrono>
+#include <cstdint>
+#include <memory>
+
+#include <termox/system/profiler.hpp>
+#include <termox/widget/widget.hpp>
+
+namespace ox {
+class Painter;
+
+/// Live view of frame costs and the Widgets that are most expensive to paint.
+/** Takes a Profiler::snapshot() every period, covering the frames since the
+ *  previous one. The first lines show frame, paint, layout and refresh times
+ *  and bytes written per frame, followed by the top Widgets by total paint
+ *  time. Shows a notice if the library was built without TERMOX_PROFILE. */
+class Profile_overlay : public Widget {
+   public:
+    using Duration_t = std::chrono::milliseconds;
+
+    struct Parameters {
+        int top_count     = 8;
+        Duration_t period = Duration_t{500};
+    };
+
+   public:
+    explicit Profile_overlay(int top_count     = 8,
+                             Duration_t period = Duration_t{500});
+
+    explicit Profile_overlay(Parameters p);
+
+   public:
+    /// Set the number of Widgets listed.
+    void set_top_count(int n);
+
+    /// Return the number of Widgets listed.
+    [[nodiscard]] auto top_count() const -> int;
+
+   protected:
+    auto paint_event(Painter& p) -> bool override;
+
+    auto timer_event() -> bool override;
+
+    auto enable_event() -> bool override;
+
+    auto disable_event() -> bool override;
+
+   private:
+    int top_count_;
+    Duration_t period_;
+    std::uint64_t next_frame_ = 0;
+    Profiler::Snapshot stats_;
+};
+
+/// Helper function to create a Profile_overlay instance.
+[[nodiscard]] auto profile_overlay(
+    int top_count                      = 8,
+    Profile_overlay::Duration_t period = Profile_overlay::Duration_t{500})
+    -> std::unique_ptr<Profile_overlay>;
+
+/// Helper function to create a Profile_overlay instance.
+[[nodiscard]] auto profile_overlay(Profile_overlay::Parameters p)
+    -> std::unique_ptr<Profile_overlay>;
+
+}  // namespace ox
+#endif  // TERMOX_WIDGET_WIDGETS_PROFILE_OVERLAY_HPP
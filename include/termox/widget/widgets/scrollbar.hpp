@@ -196,8 +196,9 @@ void link(Scrollbar<Layout_t>& scrollbar,
     if (hijack_scroll) {
         layout.child_added.connect([&](auto& child) {
             child.install_event_filter(scrollbar);
-            for (Widget* descendant : child.get_descendants())
-                descendant->install_event_filter(scrollbar);
+            child.for_each_descendant([&](Widget& descendant) {
+                descendant.install_event_filter(scrollbar);
+            });
         });
         scrollbar.mouse_wheel_scrolled_filter.connect(
             [&](auto&, auto const& mouse) {
@@ -4,7 +4,8 @@
 #include <stdexcept>
 #include <string>
 #include <string_view>
-#include <vector>
+
+#include <termox/common/utf8.hpp>
 
 #ifdef __APPLE__
 #    include <cwchar>
@@ -16,11 +17,20 @@ namespace ox {
 
 auto mb_to_u32(std::string_view sv) -> std::u32string
 {
+    if (is_utf8_locale()) {
+        // A null byte ends the conversion, as with the locale dependent path.
+        sv          = sv.substr(0, sv.find('\0'));
+        auto result = std::u32string(sv.size(), U'\0');
+        result.resize(utf8_decode(sv, result.data()));
+        return result;
+    }
+
     auto mb_state  = std::mbstate_t{};
     auto n         = sv.size();
     char const* in = sv.data();
-    auto buffer    = std::vector<char32_t>(sv.size() + 1, U'\0');
-    char32_t* out  = buffer.data();
+    // Decode directly into the result, never more symbols than bytes.
+    auto result   = std::u32string(sv.size(), U'\0');
+    char32_t* out = result.data();
 
     while (n != 0) {
 #ifdef __APPLE__
@@ -36,13 +46,14 @@ auto mb_to_u32(std::string_view sv) -> std::u32string
             case std::size_t(-2):
             case std::size_t(-3):
                 throw std::runtime_error{"mb_to_u32(): Bad Byte Sequence"};
-            case 0:  // Null Byte Read
-                (++out, ++in, --n);
+            case 0:  // Null Byte Read, the result ends here.
+                n = 0;
                 break;
             default: (++out, in += bytes_read, n -= bytes_read); break;
         }
     }
-    return buffer.data() == nullptr ? U"" : std::u32string{buffer.data()};
+    result.resize(out - result.data());
+    return result;
 }
 
 }  // namespace ox
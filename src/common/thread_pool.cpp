@@ -0,0 +1,109 @@
+#include <termox/common/thread_pool.hpp>
+
+#include <algorithm>
+#include <cstddef>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <utility>
+
+namespace {
+
+/// The pool and worker index of the calling thread, if it is a worker.
+thread_local void const* current_pool   = nullptr;
+thread_local std::size_t current_worker = 0;
+
+}  // namespace
+
+namespace ox {
+
+Thread_pool::Thread_pool(std::size_t thread_count)
+{
+    thread_count = std::max(thread_count, std::size_t{1});
+    for (auto i = std::size_t{0}; i < thread_count; ++i)
+        workers_.push_back(std::make_unique<Worker>());
+    for (auto i = std::size_t{0}; i < thread_count; ++i)
+        threads_.emplace_back([this, i] { this->work(i); });
+}
+
+Thread_pool::~Thread_pool()
+{
+    {
+        auto const lock = std::lock_guard{sleep_mtx_};
+        stop_           = true;
+    }
+    wake_.notify_all();
+    for (auto& t : threads_)
+        t.join();
+}
+
+auto Thread_pool::thread_count() const -> std::size_t
+{
+    return threads_.size();
+}
+
+void Thread_pool::push(Task task)
+{
+    auto const index = current_pool == this
+                           ? current_worker
+                           : next_worker_++ % workers_.size();
+    {
+        auto& worker    = *workers_[index];
+        auto const lock = std::lock_guard{worker.mtx};
+        worker.tasks.push_back(std::move(task));
+    }
+    {
+        auto const lock = std::lock_guard{sleep_mtx_};
+        ++pending_;
+    }
+    wake_.notify_one();
+}
+
+auto Thread_pool::take(std::size_t index) -> Task
+{
+    {
+        auto& own       = *workers_[index];
+        auto const lock = std::lock_guard{own.mtx};
+        if (!own.tasks.empty()) {
+            auto task = std::move(own.tasks.back());
+            own.tasks.pop_back();
+            --pending_;
+            return task;
+        }
+    }
+    for (auto i = std::size_t{1}; i < workers_.size(); ++i) {
+        auto& victim    = *workers_[(index + i) % workers_.size()];
+        auto const lock = std::lock_guard{victim.mtx};
+        if (!victim.tasks.empty()) {
+            auto task = std::move(victim.tasks.front());
+            victim.tasks.pop_front();
+            --pending_;
+            return task;
+        }
+    }
+    return {};
+}
+
+void Thread_pool::work(std::size_t index)
+{
+    current_pool   = this;
+    current_worker = index;
+    while (true) {
+        if (auto task = this->take(index)) {
+            task();
+            continue;
+        }
+        auto lock = std::unique_lock{sleep_mtx_};
+        wake_.wait(lock, [this] { return stop_ || pending_ != 0; });
+        if (stop_ && pending_ == 0)
+            return;
+    }
+}
+
+auto shared_thread_pool() -> Thread_pool&
+{
+    static auto pool = Thread_pool{};
+    return pool;
+}
+
+}  // namespace ox
@@ -13,16 +13,30 @@
 
 #include <esc/detail/u32_to_mb.hpp>
 
+#include <termox/common/utf8.hpp>
+
 namespace ox {
 
 auto u32_to_mb(char32_t c) -> std::string
 {
+    if (is_utf8_locale()) {
+        char buffer[4];
+        return std::string(buffer, utf8_encode(c, buffer));
+    }
     auto [count, chars] = ::esc::detail::u32_to_mb(c);
     return std::string(chars.data(), count);
 }
 
 auto u32_to_mb(std::u32string_view sv) -> std::string
 {
+    if (is_utf8_locale()) {
+        // A null symbol ends the conversion, as with the locale dependent path.
+        sv          = sv.substr(0, sv.find(U'\0'));
+        auto result = std::string(sv.size() * 4, '\0');
+        result.resize(utf8_encode(sv, result.data()));
+        return result;
+    }
+
     auto buffer   = std::vector<char>(sv.size() * 4 + 1, '\0');
     auto mb_state = std::mbstate_t{};
     char* out     = buffer.data();
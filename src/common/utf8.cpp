@@ -0,0 +1,189 @@
+#include <termox/common/utf8.hpp>
+
+#include <cctype>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <stdexcept>
+#include <string_view>
+
+#include <langinfo.h>
+
+namespace {
+
+/// High bit of each byte in a 64 bit word, any set means a non-ASCII byte.
+auto constexpr high_bits = std::uint64_t{0x8080808080808080};
+
+/// Return true if every byte in [first, first + 8) is ASCII.
+[[nodiscard]] auto is_ascii_word(char const* first) -> bool
+{
+    auto word = std::uint64_t{0};
+    std::memcpy(&word, first, sizeof(word));
+    return (word & high_bits) == 0;
+}
+
+/// Return true if every char32_t in [first, first + 4) is ASCII.
+[[nodiscard]] auto is_ascii_quad(char32_t const* first) -> bool
+{
+    return (first[0] | first[1] | first[2] | first[3]) < 0x80;
+}
+
+[[noreturn]] void throw_decode_error()
+{
+    throw std::runtime_error{"utf8_decode(): Bad Byte Sequence"};
+}
+
+[[noreturn]] void throw_encode_error()
+{
+    throw std::runtime_error{"utf8_encode(): Invalid Code Point"};
+}
+
+[[nodiscard]] auto is_continuation(unsigned char byte) -> bool
+{
+    return (byte & 0xC0) == 0x80;
+}
+
+[[nodiscard]] auto is_valid_code_point(char32_t symbol) -> bool
+{
+    return symbol <= 0x10FFFF && (symbol < 0xD800 || symbol > 0xDFFF);
+}
+
+}  // namespace
+
+namespace ox {
+
+auto is_utf8_locale() -> bool
+{
+    auto const* const codeset = ::nl_langinfo(CODESET);
+    if (codeset == nullptr)
+        return false;
+    // Accepts "UTF-8", "utf-8", "UTF8" and "utf8".
+    auto const cs = std::string_view{codeset};
+    if (cs.size() != 5 && cs.size() != 4)
+        return false;
+    auto const upper = [](char c) {
+        return static_cast<char>(std::toupper(static_cast<unsigned char>(c)));
+    };
+    return upper(cs[0]) == 'U' && upper(cs[1]) == 'T' && upper(cs[2]) == 'F' &&
+           (cs.size() == 4 ? cs[3] == '8' : (cs[3] == '-' && cs[4] == '8'));
+}
+
+auto utf8_decode(std::string_view bytes, char32_t* out) -> std::size_t
+{
+    auto const* const begin = out;
+    auto const* in          = bytes.data();
+    auto const* const end   = in + bytes.size();
+
+    while (in != end) {
+        // ASCII fast path, a word at a time.
+        while (end - in >= 8 && ::is_ascii_word(in)) {
+            for (auto i = 0; i < 8; ++i)
+                out[i] = static_cast<unsigned char>(in[i]);
+            in += 8;
+            out += 8;
+        }
+        if (in == end)
+            break;
+
+        auto const lead = static_cast<unsigned char>(*in);
+        if (lead < 0x80) {
+            *out++ = lead;
+            ++in;
+            continue;
+        }
+
+        auto length  = 0;
+        auto minimum = char32_t{0};
+        auto symbol  = char32_t{0};
+        if ((lead & 0xE0) == 0xC0) {
+            length  = 2;
+            minimum = 0x80;
+            symbol  = lead & 0x1F;
+        }
+        else if ((lead & 0xF0) == 0xE0) {
+            length  = 3;
+            minimum = 0x800;
+            symbol  = lead & 0x0F;
+        }
+        else if ((lead & 0xF8) == 0xF0) {
+            length  = 4;
+            minimum = 0x10000;
+            symbol  = lead & 0x07;
+        }
+        else
+            ::throw_decode_error();
+
+        if (end - in < length)
+            ::throw_decode_error();
+        for (auto i = 1; i < length; ++i) {
+            auto const byte = static_cast<unsigned char>(in[i]);
+            if (!::is_continuation(byte))
+                ::throw_decode_error();
+            symbol = (symbol << 6) | (byte & 0x3F);
+        }
+        if (symbol < minimum || symbol > 0x10FFFF ||
+            (symbol >= 0xD800 && symbol <= 0xDFFF)) {
+            ::throw_decode_error();
+        }
+        *out++ = symbol;
+        in += length;
+    }
+    return out - begin;
+}
+
+auto utf8_encode(char32_t symbol, char* out) -> std::size_t
+{
+    if (symbol < 0x80) {
+        out[0] = static_cast<char>(symbol);
+        return 1;
+    }
+    if (symbol < 0x800) {
+        out[0] = static_cast<char>(0xC0 | (symbol >> 6));
+        out[1] = static_cast<char>(0x80 | (symbol & 0x3F));
+        return 2;
+    }
+    if (symbol < 0x10000) {
+        if (symbol >= 0xD800 && symbol <= 0xDFFF)
+            ::throw_encode_error();
+        out[0] = static_cast<char>(0xE0 | (symbol >> 12));
+        out[1] = static_cast<char>(0x80 | ((symbol >> 6) & 0x3F));
+        out[2] = static_cast<char>(0x80 | (symbol & 0x3F));
+        return 3;
+    }
+    if (symbol <= 0x10FFFF) {
+        out[0] = static_cast<char>(0xF0 | (symbol >> 18));
+        out[1] = static_cast<char>(0x80 | ((symbol >> 12) & 0x3F));
+        out[2] = static_cast<char>(0x80 | ((symbol >> 6) & 0x3F));
+        out[3] = static_cast<char>(0x80 | (symbol & 0x3F));
+        return 4;
+    }
+    ::throw_encode_error();
+}
+
+auto utf8_encode_lossy(char32_t symbol, char* out) noexcept -> std::size_t
+{
+    return utf8_encode(::is_valid_code_point(symbol) ? symbol : U'\uFFFD', out);
+}
+
+auto utf8_encode(std::u32string_view symbols, char* out) -> std::size_t
+{
+    auto const* const begin = out;
+    auto const* in          = symbols.data();
+    auto const* const end   = in + symbols.size();
+
+    while (in != end) {
+        // ASCII fast path, four symbols at a time.
+        while (end - in >= 4 && ::is_ascii_quad(in)) {
+            for (auto i = 0; i < 4; ++i)
+                out[i] = static_cast<char>(in[i]);
+            in += 4;
+            out += 4;
+        }
+        if (in == end)
+            break;
+        out += utf8_encode(*in++, out);
+    }
+    return out - begin;
+}
+
+}  // namespace ox
@@ -0,0 +1,428 @@
+#include <termox/painter/compact_glyph_string.hpp>
+
+#include <algorithm>
+#include <cstddef>
+#include <stdexcept>
+#include <string>
+#include <string_view>
+#include <utility>
+#include <vector>
+
+#include <termox/common/u32_to_mb.hpp>
+#include <termox/painter/brush.hpp>
+#include <termox/painter/color.hpp>
+#include <termox/painter/glyph.hpp>
+#include <termox/painter/glyph_string.hpp>
+#include <termox/painter/trait.hpp>
+
+namespace {
+
+using Run = ox::Compact_glyph_string::Run;
+
+/// Append a run ending at \p end with Brush \p b, merging with the last run.
+/** No-op if the run would be empty. */
+void push_run(std::vector<Run>& runs, int end, ox::Brush b)
+{
+    auto const begin = runs.empty() ? 0 : runs.back().end;
+    if (end <= begin)
+        return;
+    if (!runs.empty() && runs.back().brush == b)
+        runs.back().end = end;
+    else
+        runs.push_back({end, b});
+}
+
+/// Append the portion of \p runs within [begin, end) to \p out, shifted.
+/** Each copied run end is offset by \p shift. */
+void copy_runs(std::vector<Run> const& runs,
+               int begin,
+               int end,
+               int shift,
+               std::vector<Run>& out)
+{
+    auto run_begin = 0;
+    for (auto const& run : runs) {
+        auto const clipped_begin = std::max(run_begin, begin);
+        auto const clipped_end   = std::min(run.end, end);
+        if (clipped_begin < clipped_end)
+            push_run(out, clipped_end + shift, run.brush);
+        run_begin = run.end;
+        if (run_begin >= end)
+            break;
+    }
+}
+
+}  // namespace
+
+namespace ox {
+
+Compact_glyph_string::Compact_glyph_string(std::u32string symbols, Brush b)
+    : symbols_{std::move(symbols)}
+{
+    push_run(runs_, symbols_.size(), b);
+}
+
+Compact_glyph_string::Compact_glyph_string(Glyph_string const& gs)
+{
+    this->append(gs);
+}
+
+auto Compact_glyph_string::append(Glyph g) -> Compact_glyph_string&
+{
+    symbols_.push_back(g.symbol);
+    push_run(runs_, symbols_.size(), g.brush);
+    return *this;
+}
+
+auto Compact_glyph_string::append(std::u32string_view symbols, Brush b)
+    -> Compact_glyph_string&
+{
+    symbols_.append(symbols);
+    push_run(runs_, symbols_.size(), b);
+    return *this;
+}
+
+auto Compact_glyph_string::append(Compact_glyph_string const& x)
+    -> Compact_glyph_string&
+{
+    auto const shift = this->size();
+    symbols_.append(x.symbols_);
+    for (auto const& run : x.runs_)
+        push_run(runs_, run.end + shift, run.brush);
+    return *this;
+}
+
+auto Compact_glyph_string::append(Glyph_string const& gs)
+    -> Compact_glyph_string&
+{
+    symbols_.reserve(symbols_.size() + gs.size());
+    for (Glyph g : gs)
+        this->append(g);
+    return *this;
+}
+
+void Compact_glyph_string::insert(int index,
+                                  std::u32string_view symbols,
+                                  Brush b)
+{
+    if (index < 0 || index > this->size())
+        throw std::out_of_range{"Compact_glyph_string::insert(): Bad index."};
+    auto const count = static_cast<int>(symbols.size());
+    auto next_runs   = std::vector<Run>{};
+    next_runs.reserve(runs_.size() + 2);
+    copy_runs(runs_, 0, index, 0, next_runs);
+    push_run(next_runs, index + count, b);
+    copy_runs(runs_, index, this->size(), count, next_runs);
+    symbols_.insert(index, symbols);
+    runs_ = std::move(next_runs);
+}
+
+void Compact_glyph_string::erase(int index, int count)
+{
+    if (index < 0 || index > this->size())
+        throw std::out_of_range{"Compact_glyph_string::erase(): Bad index."};
+    if (count == npos || index + count > this->size())
+        count = this->size() - index;
+    auto next_runs = std::vector<Run>{};
+    next_runs.reserve(runs_.size());
+    copy_runs(runs_, 0, index, 0, next_runs);
+    copy_runs(runs_, index + count, this->size(), -count, next_runs);
+    symbols_.erase(index, count);
+    runs_ = std::move(next_runs);
+}
+
+void Compact_glyph_string::clear()
+{
+    symbols_.clear();
+    runs_.clear();
+}
+
+void Compact_glyph_string::reserve(int symbol_count)
+{
+    symbols_.reserve(symbol_count);
+}
+
+auto Compact_glyph_string::size() const -> int { return symbols_.size(); }
+
+auto Compact_glyph_string::length() const -> int { return this->size(); }
+
+auto Compact_glyph_string::empty() const -> bool { return symbols_.empty(); }
+
+auto Compact_glyph_string::operator[](int index) const -> Glyph
+{
+    return {symbols_[index], this->brush_at(index)};
+}
+
+auto Compact_glyph_string::at(int index) const -> Glyph
+{
+    if (index < 0 || index >= this->size())
+        throw std::out_of_range{"Compact_glyph_string::at(): Bad index."};
+    return (*this)[index];
+}
+
+auto Compact_glyph_string::front() const -> Glyph
+{
+    return {symbols_.front(), runs_.front().brush};
+}
+
+auto Compact_glyph_string::back() const -> Glyph
+{
+    return {symbols_.back(), runs_.back().brush};
+}
+
+auto Compact_glyph_string::brush_at(int index) const -> Brush
+{
+    return runs_[this->run_index_at(index)].brush;
+}
+
+auto Compact_glyph_string::begin() const -> Iterator { return {*this, 0}; }
+
+auto Compact_glyph_string::end() const -> Iterator
+{
+    return {*this, this->size()};
+}
+
+auto Compact_glyph_string::cbegin() const -> Iterator { return this->begin(); }
+
+auto Compact_glyph_string::cend() const -> Iterator { return this->end(); }
+
+auto Compact_glyph_string::symbols() const -> std::u32string const&
+{
+    return symbols_;
+}
+
+auto Compact_glyph_string::runs() const -> std::vector<Run> const&
+{
+    return runs_;
+}
+
+auto Compact_glyph_string::u32str() const -> std::u32string
+{
+    return symbols_;
+}
+
+auto Compact_glyph_string::str() const -> std::string
+{
+    return u32_to_mb(symbols_);
+}
+
+auto Compact_glyph_string::to_glyph_string() const -> Glyph_string
+{
+    auto result = Glyph_string{};
+    result.reserve(this->size());
+    auto begin = 0;
+    for (auto const& run : runs_) {
+        for (auto i = begin; i < run.end; ++i)
+            result.push_back({symbols_[i], run.brush});
+        begin = run.end;
+    }
+    return result;
+}
+
+void Compact_glyph_string::set_brush(int index, int count, Brush b)
+{
+    if (index < 0 || index > this->size())
+        throw std::out_of_range{"Compact_glyph_string::set_brush(): Bad index."};
+    if (count == npos || index + count > this->size())
+        count = this->size() - index;
+    auto next_runs = std::vector<Run>{};
+    next_runs.reserve(runs_.size() + 2);
+    copy_runs(runs_, 0, index, 0, next_runs);
+    push_run(next_runs, index + count, b);
+    copy_runs(runs_, index + count, this->size(), 0, next_runs);
+    runs_ = std::move(next_runs);
+}
+
+void Compact_glyph_string::add_traits(Traits traits)
+{
+    this->modify_brushes([traits](Brush& b) { b.traits.insert(traits); });
+}
+
+void Compact_glyph_string::remove_traits(Traits traits)
+{
+    this->modify_brushes([traits](Brush& b) { b.traits.remove(traits); });
+}
+
+void Compact_glyph_string::clear_traits()
+{
+    this->modify_brushes([](Brush& b) { b.traits = Trait::None; });
+}
+
+void Compact_glyph_string::add_color(Background_color bg)
+{
+    this->modify_brushes([bg](Brush& b) { b.background = Color{bg.value}; });
+}
+
+void Compact_glyph_string::add_color(Foreground_color fg)
+{
+    this->modify_brushes([fg](Brush& b) { b.foreground = Color{fg.value}; });
+}
+
+void Compact_glyph_string::remove_background()
+{
+    this->modify_brushes([](Brush& b) { b.background = Color::Background; });
+}
+
+void Compact_glyph_string::remove_foreground()
+{
+    this->modify_brushes([](Brush& b) { b.foreground = Color::Foreground; });
+}
+
+template <typename Modify_fn>
+void Compact_glyph_string::modify_brushes(Modify_fn&& modify)
+{
+    auto next_runs = std::vector<Run>{};
+    next_runs.reserve(runs_.size());
+    for (auto run : runs_) {
+        modify(run.brush);
+        push_run(next_runs, run.end, run.brush);
+    }
+    runs_ = std::move(next_runs);
+}
+
+auto Compact_glyph_string::run_index_at(int index) const -> std::size_t
+{
+    auto const iter =
+        std::upper_bound(std::cbegin(runs_), std::cend(runs_), index,
+                         [](int i, Run const& run) { return i < run.end; });
+    return std::distance(std::cbegin(runs_), iter);
+}
+
+// Iterator --------------------------------------------------------------------
+
+Compact_glyph_string::Iterator::Iterator(Compact_glyph_string const& str,
+                                         int index)
+    : str_{&str},
+      index_{index},
+      run_{index < str.size() ? str.run_index_at(index) : str.runs_.size()}
+{}
+
+auto Compact_glyph_string::Iterator::operator*() const -> Glyph
+{
+    return {str_->symbols_[index_], str_->runs_[run_].brush};
+}
+
+auto Compact_glyph_string::Iterator::operator[](difference_type n) const
+    -> Glyph
+{
+    return (*str_)[index_ + n];
+}
+
+auto Compact_glyph_string::Iterator::operator++() -> Iterator&
+{
+    ++index_;
+    if (run_ < str_->runs_.size() && index_ >= str_->runs_[run_].end)
+        ++run_;
+    return *this;
+}
+
+auto Compact_glyph_string::Iterator::operator++(int) -> Iterator
+{
+    auto copy = *this;
+    ++(*this);
+    return copy;
+}
+
+auto Compact_glyph_string::Iterator::operator--() -> Iterator&
+{
+    --index_;
+    if (run_ != 0 && index_ < str_->runs_[run_ - 1].end)
+        --run_;
+    return *this;
+}
+
+auto Compact_glyph_string::Iterator::operator--(int) -> Iterator
+{
+    auto copy = *this;
+    --(*this);
+    return copy;
+}
+
+auto Compact_glyph_string::Iterator::operator+=(difference_type n)
+    -> Iterator&
+{
+    *this = Iterator{*str_, static_cast<int>(index_ + n)};
+    return *this;
+}
+
+auto Compact_glyph_string::Iterator::operator-=(difference_type n)
+    -> Iterator&
+{
+    return *this += -n;
+}
+
+auto Compact_glyph_string::Iterator::operator+(difference_type n) const
+    -> Iterator
+{
+    return Iterator{*str_, static_cast<int>(index_ + n)};
+}
+
+auto Compact_glyph_string::Iterator::operator-(difference_type n) const
+    -> Iterator
+{
+    return *this + -n;
+}
+
+auto Compact_glyph_string::Iterator::operator-(Iterator const& other) const
+    -> difference_type
+{
+    return index_ - other.index_;
+}
+
+auto Compact_glyph_string::Iterator::operator==(Iterator const& other) const
+    -> bool
+{
+    return index_ == other.index_;
+}
+
+auto Compact_glyph_string::Iterator::operator!=(Iterator const& other) const
+    -> bool
+{
+    return index_ != other.index_;
+}
+
+auto Compact_glyph_string::Iterator::operator<(Iterator const& other) const
+    -> bool
+{
+    return index_ < other.index_;
+}
+
+auto Compact_glyph_string::Iterator::operator>(Iterator const& other) const
+    -> bool
+{
+    return index_ > other.index_;
+}
+
+auto Compact_glyph_string::Iterator::operator<=(Iterator const& other) const
+    -> bool
+{
+    return index_ <= other.index_;
+}
+
+auto Compact_glyph_string::Iterator::operator>=(Iterator const& other) const
+    -> bool
+{
+    return index_ >= other.index_;
+}
+
+// Comparison ------------------------------------------------------------------
+
+auto operator==(Compact_glyph_string const& x, Compact_glyph_string const& y)
+    -> bool
+{
+    // Runs are always merged, so equal strings have identical runs.
+    if (x.symbols() != y.symbols() || x.runs().size() != y.runs().size())
+        return false;
+    return std::equal(std::cbegin(x.runs()), std::cend(x.runs()),
+                      std::cbegin(y.runs()), [](auto const& a, auto const& b) {
+                          return a.end == b.end && a.brush == b.brush;
+                      });
+}
+
+auto operator!=(Compact_glyph_string const& x, Compact_glyph_string const& y)
+    -> bool
+{
+    return !(x == y);
+}
+
+}  // namespace ox
@@ -1,7 +1,12 @@
 #include <termox/painter/glyph_matrix.hpp>
 
+#include <algorithm>
+#include <cstddef>
+#include <stdexcept>
+#include <utility>
 #include <vector>
 
+#include <termox/common/span.hpp>
 #include <termox/painter/glyph.hpp>
 #include <termox/widget/area.hpp>
 #include <termox/widget/point.hpp>
@@ -9,40 +14,103 @@
 namespace ox {
 
 Glyph_matrix::Glyph_matrix(Area area)
-    : matrix_(area.height, std::vector<Glyph>(area.width, Glyph{U'\0'}))
+    : buffer_(area.width * area.height, Glyph{U'\0'}), area_{area}
 {}
 
 void Glyph_matrix::resize(Area area)
 {
-    matrix_.resize(area.height);
-    matrix_.shrink_to_fit();
-    for (auto& row : matrix_) {
-        row.resize(area.width, U'\0');
-        row.shrink_to_fit();
+    if (area == area_)
+        return;
+    if (area.width == area_.width) {
+        // Row layout is unchanged, rows are only added or removed at the end.
+        buffer_.resize(area.width * area.height, Glyph{U'\0'});
+        area_ = area;
+        return;
     }
+    auto next = std::vector<Glyph>(area.width * area.height, Glyph{U'\0'});
+    auto const copy_width  = std::min(area.width, area_.width);
+    auto const copy_height = std::min(area.height, area_.height);
+    for (auto y = 0; y < copy_height; ++y) {
+        auto const* const first = buffer_.data() + (y * area_.width);
+        std::copy(first, first + copy_width, next.data() + (y * area.width));
+    }
+    buffer_ = std::move(next);
+    area_   = area;
 }
 
-void Glyph_matrix::clear() { matrix_.clear(); }
-
-auto Glyph_matrix::width() const -> int
+void Glyph_matrix::clear()
 {
-    return matrix_.empty() ? 0 : matrix_.at(0).size();
+    buffer_.clear();
+    area_ = Area{0, 0};
 }
 
-auto Glyph_matrix::height() const -> int { return matrix_.size(); }
+auto Glyph_matrix::width() const -> int { return area_.width; }
+
+auto Glyph_matrix::height() const -> int { return area_.height; }
 
-auto Glyph_matrix::operator()(Point p) -> Glyph& { return matrix_[p.y][p.x]; }
+auto Glyph_matrix::area() const -> Area { return area_; }
+
+auto Glyph_matrix::stride() const -> int { return area_.width; }
+
+auto Glyph_matrix::operator()(Point p) -> Glyph&
+{
+    return buffer_[p.x + (p.y * area_.width)];
+}
 
 auto Glyph_matrix::operator()(Point p) const -> Glyph
 {
-    return matrix_[p.y][p.x];
+    return buffer_[p.x + (p.y * area_.width)];
 }
 
-auto Glyph_matrix::at(Point p) -> Glyph& { return matrix_.at(p.y).at(p.x); }
+auto Glyph_matrix::at(Point p) -> Glyph&
+{
+    if (p.x < 0 || p.y < 0 || p.x >= area_.width || p.y >= area_.height)
+        throw std::out_of_range{"Glyph_matrix::at(): Point out of range."};
+    return (*this)(p);
+}
 
 auto Glyph_matrix::at(Point p) const -> Glyph
 {
-    return matrix_.at(p.y).at(p.x);
+    if (p.x < 0 || p.y < 0 || p.x >= area_.width || p.y >= area_.height)
+        throw std::out_of_range{"Glyph_matrix::at(): Point out of range."};
+    return (*this)(p);
+}
+
+auto Glyph_matrix::row(int y) -> Span<Glyph>
+{
+    return {buffer_.data() + (y * area_.width),
+            static_cast<std::size_t>(area_.width)};
+}
+
+auto Glyph_matrix::row(int y) const -> Span<Glyph const>
+{
+    return {buffer_.data() + (y * area_.width),
+            static_cast<std::size_t>(area_.width)};
+}
+
+auto Glyph_matrix::data() -> Glyph* { return buffer_.data(); }
+
+auto Glyph_matrix::data() const -> Glyph const* { return buffer_.data(); }
+
+void Glyph_matrix::fill(Glyph g)
+{
+    std::fill(std::begin(buffer_), std::end(buffer_), g);
+}
+
+void Glyph_matrix::blit(Glyph_matrix const& source, Point at)
+{
+    auto const x_begin = std::max(at.x, 0);
+    auto const x_end   = std::min(at.x + source.width(), area_.width);
+    auto const y_begin = std::max(at.y, 0);
+    auto const y_end   = std::min(at.y + source.height(), area_.height);
+    if (x_begin >= x_end)
+        return;
+    for (auto y = y_begin; y < y_end; ++y) {
+        auto const* const first =
+            source.row(y - at.y).data() + (x_begin - at.x);
+        std::copy(first, first + (x_end - x_begin),
+                  this->row(y).data() + x_begin);
+    }
 }
 
 }  // namespace ox
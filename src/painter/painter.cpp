@@ -1,5 +1,16 @@
 #include <termox/painter/painter.hpp>
 
+#include <algorithm>
+#include <cstddef>
+#include <iterator>
+#include <utility>
+
+#include <termox/common/span.hpp>
+
+#include <termox/painter/brush.hpp>
+#include <termox/painter/compact_glyph_string.hpp>
+#include <termox/painter/glyph.hpp>
+#include <termox/painter/glyph_matrix.hpp>
 #include <termox/painter/glyph_string.hpp>
 #include <termox/system/event_loop.hpp>
 #include <termox/system/system.hpp>
@@ -7,6 +18,17 @@
 #include <termox/widget/point.hpp>
 #include <termox/widget/widget.hpp>
 
+namespace {
+
+/// Return the [begin, end) interval of [\p begin, \p end) within [0, \p limit).
+/** The returned interval is empty, begin >= end, if there is no overlap. */
+[[nodiscard]] auto clip(int begin, int end, int limit) -> std::pair<int, int>
+{
+    return {std::max(begin, 0), std::min(end, limit)};
+}
+
+}  // namespace
+
 namespace ox {
 
 Painter::Painter(Widget& widg, detail::Canvas& canvas)
@@ -28,8 +50,71 @@ auto Painter::put(Glyph tile, Point p) -> Painter&
 
 auto Painter::put(Glyph_string const& text, Point p) -> Painter&
 {
-    for (Glyph g : text)
-        this->put(g, {p.x++, p.y});
+    return this->put(
+        Span<Glyph const>{text.data(), static_cast<std::size_t>(text.size())},
+        p);
+}
+
+auto Painter::put(Compact_glyph_string const& text, Point p) -> Painter&
+{
+    auto const area = widget_.area();
+    if (p.y < 0 || p.y >= area.height)
+        return *this;
+    auto const [x_begin, x_end] = ::clip(p.x, p.x + text.size(), area.width);
+    if (x_begin >= x_end)
+        return *this;
+
+    // Indices into text.
+    auto const first = x_begin - p.x;
+    auto const last  = x_end - p.x;
+
+    auto const& symbols = text.symbols();
+    auto* out = canvas_.row(widget_.top_left().y + p.y).data() +
+                widget_.top_left().x + x_begin;
+    auto run_begin = 0;
+    for (auto const& run : text.runs()) {
+        auto const begin = std::max(run_begin, first);
+        auto const end   = std::min(run.end, last);
+        run_begin        = run.end;
+        if (begin >= end)
+            continue;
+        auto const brush = merge(run.brush, brush_);
+        for (auto i = begin; i < end; ++i)
+            *out++ = Glyph{symbols[i], brush};
+        if (run_begin >= last)
+            break;
+    }
+    return *this;
+}
+
+auto Painter::put(Span<Glyph const> glyphs, Point p) -> Painter&
+{
+    auto const area = widget_.area();
+    if (p.y < 0 || p.y >= area.height)
+        return *this;
+    auto const length           = static_cast<int>(glyphs.size());
+    auto const [x_begin, x_end] = ::clip(p.x, p.x + length, area.width);
+    if (x_begin >= x_end)
+        return *this;
+    this->put_run_global(glyphs.subspan(x_begin - p.x, x_end - x_begin),
+                         widget_.top_left() + Point{x_begin, p.y});
+    return *this;
+}
+
+auto Painter::put(Glyph_matrix const& matrix, Point p) -> Painter&
+{
+    auto const area             = widget_.area();
+    auto const [x_begin, x_end] = ::clip(p.x, p.x + matrix.width(), area.width);
+    auto const [y_begin, y_end] =
+        ::clip(p.y, p.y + matrix.height(), area.height);
+    if (x_begin >= x_end)
+        return *this;
+    auto const offset = widget_.top_left();
+    for (auto y = y_begin; y < y_end; ++y) {
+        this->put_run_global(
+            matrix.row(y - p.y).subspan(x_begin - p.x, x_end - x_begin),
+            offset + Point{x_begin, y});
+    }
     return *this;
 }
 
@@ -47,26 +132,40 @@ auto Painter::at(Point p) -> Glyph&
 
 auto Painter::fill(Glyph tile, Point point, Area area) -> Painter&
 {
-    if (area.width == 0)
+    auto const bounds           = widget_.area();
+    auto const [x_begin, x_end] =
+        ::clip(point.x, point.x + area.width, bounds.width);
+    auto const [y_begin, y_end] =
+        ::clip(point.y, point.y + area.height, bounds.height);
+    if (x_begin >= x_end || y_begin >= y_end)
         return *this;
-    auto const y_limit = point.y + area.height;
-    auto const x_limit = point.x + area.width - 1;  // Used in inclusive context
-    for (; point.y < y_limit; ++point.y)
-        this->hline(tile, point, {x_limit, point.y});
+    tile.brush = merge(tile.brush, brush_);
+    this->fill_global_no_brush(tile, widget_.top_left() + Point{x_begin, y_begin},
+                               {x_end - x_begin, y_end - y_begin});
     return *this;
 }
 
+auto Painter::fill(Glyph tile) -> Painter&
+{
+    return this->fill(tile, {0, 0}, widget_.area());
+}
+
 auto Painter::hline(Glyph tile, Point a, Point b) -> Painter&
 {
-    for (; a.x <= b.x; ++a.x)
-        this->put(tile, a);
-    return *this;
+    return this->fill(tile, a, {b.x - a.x + 1, 1});
 }
 
 auto Painter::vline(Glyph tile, Point a, Point b) -> Painter&
 {
-    for (; a.y <= b.y; ++a.y)
-        this->put(tile, a);
+    auto const area = widget_.area();
+    if (a.x < 0 || a.x >= area.width)
+        return *this;
+    auto const [y_begin, y_end] = ::clip(a.y, b.y + 1, area.height);
+    if (y_begin >= y_end)
+        return *this;
+    tile.brush = merge(tile.brush, brush_);
+    this->vline_global_no_brush(tile, widget_.top_left() + Point{a.x, y_begin},
+                                y_end - y_begin);
     return *this;
 }
 
@@ -85,42 +184,34 @@ void Painter::put_global(Glyph tile, Point p)
     canvas_.at(p) = tile;
 }
 
-void Painter::hline_global(Glyph tile, Point a, Point b)
+void Painter::put_run_global(Span<Glyph const> glyphs, Point p)
 {
-    for (; a.x <= b.x; ++a.x)
-        this->put_global(tile, a);
-}
-
-void Painter::hline_global_no_brush(Glyph tile, Point a, Point b)
-{
-    for (; a.x <= b.x; ++a.x)
-        canvas_.at(a) = tile;
-}
-
-void Painter::vline_global(Glyph tile, Point a, Point b)
-{
-    for (; a.y <= b.y; ++a.y)
-        this->put_global(tile, a);
+    auto* const out = canvas_.row(p.y).data() + p.x;
+    // Merging with a default Brush is the identity, so the run can be copied.
+    if (brush_ == Brush{}) {
+        std::copy(std::begin(glyphs), std::end(glyphs), out);
+        return;
+    }
+    std::transform(std::begin(glyphs), std::end(glyphs), out,
+                   [this](Glyph g) {
+                       g.brush = merge(g.brush, brush_);
+                       return g;
+                   });
 }
 
-void Painter::fill_global(Glyph tile, Point point, Area area)
+void Painter::vline_global_no_brush(Glyph tile, Point p, int length)
 {
-    if (area.width == 0)
-        return;
-    auto const y_limit = point.y + area.height;
-    auto const x_limit = point.x + area.width - 1;  // Used in inclusive context
-    for (; point.y < y_limit; ++point.y)
-        this->hline_global(tile, point, {x_limit, point.y});
+    auto const stride = canvas_.area().width;
+    auto* out         = canvas_.row(p.y).data() + p.x;
+    for (; length != 0; --length, out += stride)
+        *out = tile;
 }
 
 void Painter::fill_global_no_brush(Glyph tile, Point point, Area area)
 {
-    if (area.width == 0)
-        return;
     auto const y_limit = point.y + area.height;
-    auto const x_limit = point.x + area.width - 1;  // Used in inclusive context
     for (; point.y < y_limit; ++point.y)
-        this->hline_global_no_brush(tile, point, {x_limit, point.y});
+        std::fill_n(canvas_.row(point.y).data() + point.x, area.width, tile);
 }
 
 }  // namespace ox
@@ -11,6 +11,7 @@
 #include <termox/system/event_loop.hpp>
 #include <termox/system/event_queue.hpp>
 #include <termox/system/system.hpp>
+#include <termox/system/trace.hpp>
 #include <termox/widget/widget.hpp>
 
 namespace {
@@ -55,6 +56,7 @@ auto Animation_engine::is_running() const -> bool { return loop_.is_running(); }
 
 void Animation_engine::loop_function(Event_queue& queue)
 {
+    Trace::set_thread_name("Animation_engine");
     // The first call to wait() returns immediately.
     timer_.wait();
     timer_.begin();
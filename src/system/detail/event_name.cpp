@@ -10,6 +10,11 @@ auto name(Paint_event const&) -> std::string { return "Paint_event"; }
 
 auto name(Key_press_event const&) -> std::string { return "Key_press_event"; }
 
+auto name(Key_release_event const&) -> std::string
+{
+    return "Key_release_event";
+}
+
 auto name(Mouse_press_event const&) -> std::string
 {
     return "Mouse_press_event";
@@ -58,6 +63,16 @@ auto name(Resize_event const&) -> std::string { return "Resize_event"; }
 
 auto name(Timer_event const&) -> std::string { return "Timer_event"; }
 
+auto name(Dynamic_color_event const&) -> std::string
+{
+    return "Dynamic_color_event";
+}
+
+auto name(::esc::Window_resize const&) -> std::string
+{
+    return "Window_resize";
+}
+
 auto name(Custom_event const&) -> std::string { return "Custom_event"; }
 
 }  // namespace ox::detail
@@ -12,6 +12,7 @@
 #include <termox/system/event.hpp>
 #include <termox/system/key.hpp>
 #include <termox/system/mouse.hpp>
+#include <termox/system/profiler.hpp>
 #include <termox/system/system.hpp>
 #include <termox/terminal/detail/screen_buffers.hpp>
 #include <termox/terminal/terminal.hpp>
@@ -38,6 +39,7 @@ void send(ox::Paint_event e)
 {
     if (!is_paintable(e.receiver))
         return;
+    auto const profile = Paint_profile{e.receiver};
     auto p = Painter{e.receiver, ox::Terminal::screen_buffers.next};
     e.receiver.get().paint_event(p);
     e.receiver.get().painted.emit(p);
@@ -107,6 +109,7 @@ void send(ox::Delete_event e)
     if (e.removed == nullptr)
         return;
     do_delete(*e.removed);
+    // delete_event() is user code and may change the tree, use a snapshot.
     for (Widget* w : e.removed->get_descendants())
         do_delete(*w);
     e.removed.reset();
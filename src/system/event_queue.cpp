@@ -7,7 +7,9 @@
 #include <variant>
 
 #include <termox/system/event.hpp>
+#include <termox/system/profiler.hpp>
 #include <termox/system/system.hpp>
+#include <termox/system/trace.hpp>
 #include <termox/terminal/terminal.hpp>
 #include <termox/widget/widget.hpp>
 
@@ -31,6 +33,7 @@ void Paint_queue::append(Paint_event e) { events_.append(e); }
 
 auto Paint_queue::send_all() -> bool
 {
+    auto const span = Trace_span{"Paint_queue::send_all", "queue"};
     events_.compress();
     /// Processing Paint_events should not post more Paint_events.
     bool sent = false;
@@ -46,6 +49,7 @@ void Delete_queue::append(Delete_event e) { deletes_.push_back(std::move(e)); }
 
 void Delete_queue::send_all()
 {
+    auto const span = Trace_span{"Delete_queue::send_all", "queue"};
     /// Processing Delete_events should not post more Delete_events.
     for (auto& d : deletes_)
         System::send_event(std::move(d));
@@ -58,6 +62,7 @@ void Basic_queue::append(Event e) { basics_.push_back(std::move(e)); }
 
 auto Basic_queue::send_all() -> bool
 {
+    auto const span = Trace_span{"Basic_queue::send_all", "queue"};
     // Allows for send(e) appending to the queue and invalidating iterators.
     bool sent = false;
     for (auto index = 0uL; index < basics_.size(); ++index)
@@ -91,14 +96,23 @@ void Event_queue::send_all()
     // tree construction.
     if (System::head() == nullptr)
         return;
+    auto const span = detail::Trace_span{"Event_queue::send_all", "queue"};
+
+    // Shared by every Event_queue, contended by each Event_loop thread.
     static auto mtx = std::mutex{};
+    auto wait       = detail::Trace_span{"Event_queue mutex wait", "lock"};
     auto const lock = std::lock_guard{mtx};
+    wait.end();
+
+    auto profile = detail::Frame_profile{};
     System::set_current_queue(*this);
     bool sent = basics_.send_all();
     sent      = paints_.send_all() || sent;
     deletes_.send_all();
-    if (sent)
+    if (sent) {
         Terminal::flush_screen();
+        profile.record();
+    }
 }
 
 void Event_queue::add_to_a_queue(Paint_event e)
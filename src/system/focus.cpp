@@ -1,9 +1,6 @@
 #include <termox/system/detail/focus.hpp>
 
-#include <algorithm>
-#include <iterator>
 #include <memory>
-#include <vector>
 
 #include <termox/system/event.hpp>
 #include <termox/system/system.hpp>
@@ -28,42 +25,70 @@ auto const is_tab_focusable = [](Widget const* widg) {
     return widg->is_enabled() && is_tab_focus_policy(widg->focus_policy);
 };
 
-// Return a Widget tree from System::head() if focus_widget is nullptr.
-auto gen_focus_front_widg_tree() -> std::vector<ox::Widget*>
+/// Call \p visit on System::head() and then each of its descendants.
+/** Pre-order, stops early if \p visit returns false. */
+template <typename F>
+void visit_widget_tree(F&& visit)
 {
-    auto widg_tree = System::head()->get_descendants();
-    widg_tree.insert(std::begin(widg_tree), System::head());
-    auto* const focus_widg = Focus::focus_widget();
-    if (focus_widg != nullptr) {
-        auto const begin = std::begin(widg_tree);
-        auto const end   = std::end(widg_tree);
-        auto const iter  = std::find(begin, end, focus_widg);
-        if (iter != end)
-            std::rotate(begin, iter, end);
-    }
-    return widg_tree;
+    auto* const head = System::head();
+    if (visit(*head))
+        head->for_each_descendant(visit);
 }
 
+// The tab order is the pre-order Widget tree rotated so that the focus Widget
+// is at the front, if it is in the tree. Otherwise System::head() is at the
+// front. The front Widget is skipped when looking for the next focus Widget.
+
 auto next_tab_focus() -> ox::Widget*
 {
-    if (System::head() == nullptr)
+    auto* const head = System::head();
+    if (head == nullptr)
         return nullptr;
-    auto const widg_tree  = gen_focus_front_widg_tree();
-    auto const begin      = std::next(std::begin(widg_tree));
-    auto const end        = std::end(widg_tree);
-    auto const next_focus = std::find_if(begin, end, is_tab_focusable);
-    return (next_focus != end) ? *next_focus : Focus::focus_widget();
+    auto* const focus_widg = Focus::focus_widget();
+    auto found_focus       = false;
+    auto* first            = static_cast<Widget*>(nullptr);  // Before focus.
+    auto* next             = static_cast<Widget*>(nullptr);  // After focus.
+    visit_widget_tree([&](Widget& w) {
+        if (&w == focus_widg)
+            found_focus = true;
+        else if (&w != head && is_tab_focusable(&w)) {
+            if (found_focus) {
+                next = &w;
+                return false;
+            }
+            if (first == nullptr)
+                first = &w;
+        }
+        return true;
+    });
+    if (next != nullptr)
+        return next;
+    // Wrapped around, head is only a candidate if it is not at the front.
+    if (found_focus && head != focus_widg && is_tab_focusable(head))
+        return head;
+    return (first != nullptr) ? first : focus_widg;
 }
 
 auto previous_tab_focus() -> ox::Widget*
 {
     if (System::head() == nullptr)
         return nullptr;
-    auto const widg_tree      = gen_focus_front_widg_tree();
-    auto const rbegin         = std::rbegin(widg_tree);
-    auto const rend           = std::rend(widg_tree);
-    auto const previous_focus = std::find_if(rbegin, rend, is_tab_focusable);
-    return (previous_focus != rend) ? *previous_focus : Focus::focus_widget();
+    auto* const focus_widg = Focus::focus_widget();
+    auto found_focus       = false;
+    auto* last_before      = static_cast<Widget*>(nullptr);
+    auto* last_after       = static_cast<Widget*>(nullptr);
+    visit_widget_tree([&](Widget& w) {
+        if (&w == focus_widg) {
+            found_focus = true;
+            return last_before == nullptr;
+        }
+        if (is_tab_focusable(&w))
+            (found_focus ? last_after : last_before) = &w;
+        return true;
+    });
+    if (last_before != nullptr)
+        return last_before;
+    return (last_after != nullptr) ? last_after : focus_widg;
 }
 
 }  // namespace
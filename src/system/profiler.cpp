@@ -0,0 +1,198 @@
+#include <termox/system/profiler.hpp>
+
+#ifdef TERMOX_PROFILE
+#include <algorithm>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <iterator>
+#include <string>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+#include <termox/common/record_ring.hpp>
+#include <termox/widget/widget.hpp>
+#endif
+
+namespace ox {
+
+#ifdef TERMOX_PROFILE
+
+namespace {
+
+enum class Kind : std::uint8_t { Frame, Paint, Layout, Refresh };
+
+auto constexpr name_size = std::size_t{32};
+
+/// A record as stored, the name takes the last four words.
+/** Frame:   duration
+ *  Paint:   duration, widget id, name
+ *  Layout:  duration
+ *  Refresh: duration, diff size, bytes written */
+struct Record {
+    Kind kind;
+    std::uint64_t frame;
+    std::uint64_t duration;
+    std::uint64_t a = 0;
+    std::uint64_t b = 0;
+    char name[name_size] = {};
+};
+
+using Ring  = Record_ring<4 + name_size / 8, Profiler::capacity>;
+using Words = Ring::Record;
+
+Ring ring;
+std::atomic<std::uint64_t> next_frame = 1;
+
+thread_local std::uint64_t current_frame = 0;  // Zero outside of any Frame.
+thread_local int layout_depth            = 0;
+
+[[nodiscard]] auto pack(Record const& r) -> Words
+{
+    auto w = Words{};
+    w[0]   = static_cast<std::uint64_t>(r.kind) | (r.frame << 8);
+    w[1]   = r.duration;
+    w[2]   = r.a;
+    w[3]   = r.b;
+    std::memcpy(&w[4], r.name, name_size);
+    return w;
+}
+
+[[nodiscard]] auto unpack(Words const& w) -> Record
+{
+    auto r     = Record{};
+    r.kind     = static_cast<Kind>(w[0] & 0xFF);
+    r.frame    = w[0] >> 8;
+    r.duration = w[1];
+    r.a        = w[2];
+    r.b        = w[3];
+    std::memcpy(r.name, &w[4], name_size);
+    r.name[name_size - 1] = '\0';
+    return r;
+}
+
+void write(Record const& r) { ring.push(pack(r)); }
+
+[[nodiscard]] auto since(Profiler::Clock_t::time_point start) -> std::uint64_t
+{
+    return std::chrono::duration_cast<Profiler::Duration>(
+               Profiler::Clock_t::now() - start)
+        .count();
+}
+
+}  // namespace
+
+auto Profiler::snapshot(std::uint64_t since_frame) -> Snapshot
+{
+    auto const end   = ring.end();
+    auto const begin = ring.begin();
+
+    auto result  = Snapshot{};
+    auto pending = std::unordered_map<std::uint64_t, Frame>{};
+    auto widgets = std::unordered_map<std::uint64_t, Widget_paint>{};
+    auto words   = Words{};
+    for (auto i = begin; i < end; ++i) {
+        if (!ring.read(i, words))
+            continue;
+        auto const r = unpack(words);
+        if (r.frame < since_frame)
+            continue;
+        auto const duration = Duration{r.duration};
+        auto& frame         = pending[r.frame];
+        switch (r.kind) {
+            case Kind::Frame:
+                frame.number = r.frame;
+                frame.total  = duration;
+                result.frames.push_back(frame);
+                pending.erase(r.frame);
+                break;
+            case Kind::Paint: {
+                frame.paint += duration;
+                ++frame.paint_count;
+                auto& w = widgets[r.a];
+                if (w.count == 0) {
+                    w.id   = r.a;
+                    w.name = r.name;
+                }
+                ++w.count;
+                w.total += duration;
+                w.max = std::max(w.max, duration);
+                break;
+            }
+            case Kind::Layout: frame.layout += duration; break;
+            case Kind::Refresh:
+                frame.refresh += duration;
+                frame.diff_size += r.a;
+                frame.bytes_written += r.b;
+                break;
+        }
+    }
+
+    result.widgets.reserve(widgets.size());
+    for (auto& [id, w] : widgets)
+        result.widgets.push_back(std::move(w));
+    std::sort(std::begin(result.widgets), std::end(result.widgets),
+              [](auto const& a, auto const& b) { return a.total > b.total; });
+    return result;
+}
+
+void Profiler::clear() { ring.clear(); }
+
+namespace detail {
+
+Frame_profile::Frame_profile()
+    : previous_{std::exchange(current_frame, next_frame++)},
+      start_{Profiler::Clock_t::now()}
+{}
+
+Frame_profile::~Frame_profile() { current_frame = previous_; }
+
+void Frame_profile::record()
+{
+    write({Kind::Frame, current_frame, since(start_)});
+}
+
+Paint_profile::Paint_profile(Widget const& w)
+    : widget_{w}, start_{Profiler::Clock_t::now()}
+{}
+
+Paint_profile::~Paint_profile()
+{
+    auto r = Record{Kind::Paint, current_frame, since(start_),
+                    widget_.unique_id()};
+    widget_.name().copy(r.name, name_size - 1);
+    write(r);
+}
+
+Layout_profile::Layout_profile()
+    : is_outermost_{layout_depth++ == 0}, start_{Profiler::Clock_t::now()}
+{}
+
+Layout_profile::~Layout_profile()
+{
+    --layout_depth;
+    if (is_outermost_)
+        write({Kind::Layout, current_frame, since(start_)});
+}
+
+Refresh_profile::Refresh_profile() : start_{Profiler::Clock_t::now()} {}
+
+void Refresh_profile::record(std::size_t diff_size, std::size_t bytes_written)
+{
+    write({Kind::Refresh, current_frame, since(start_), diff_size,
+           bytes_written});
+}
+
+}  // namespace detail
+
+#else
+
+auto Profiler::snapshot(std::uint64_t) -> Snapshot { return {}; }
+
+void Profiler::clear() {}
+
+#endif  // TERMOX_PROFILE
+
+}  // namespace ox
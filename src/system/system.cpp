@@ -8,6 +8,7 @@
 #include <signals_light/signal.hpp>
 
 #include <termox/system/animation_engine.hpp>
+#include <termox/system/detail/event_name.hpp>
 #include <termox/system/detail/filter_send.hpp>
 #include <termox/system/detail/focus.hpp>
 #include <termox/system/detail/is_sendable.hpp>
@@ -18,6 +19,7 @@
 #include <termox/system/event_loop.hpp>
 #include <termox/system/event_queue.hpp>
 #include <termox/system/system.hpp>
+#include <termox/system/trace.hpp>
 #include <termox/terminal/key_mode.hpp>
 #include <termox/terminal/mouse_mode.hpp>
 #include <termox/terminal/signals.hpp>
@@ -25,6 +27,22 @@
 #include <termox/widget/area.hpp>
 #include <termox/widget/widget.hpp>
 
+namespace {
+
+/// Return the name of \p e's type as a span name for ox::Trace.
+template <typename Event_t>
+[[nodiscard]] auto trace_name(Event_t const& e) -> char const*
+{
+    if constexpr (ox::Trace::is_enabled) {
+        static auto const name = ox::detail::name(e);
+        return name.c_str();
+    }
+    else
+        return "";
+}
+
+}  // namespace
+
 namespace ox {
 
 System::System(Mouse_mode mouse_mode, Key_mode key_mode, Signals signals)
@@ -78,6 +96,8 @@ auto System::run() -> int
 
 auto System::send_event(Event e) -> bool
 {
+    auto const span = detail::Trace_span{
+        std::visit([](auto const& e) { return trace_name(e); }, e), "event"};
     auto handled =
         std::visit([](auto const& e) { return detail::send_shortcut(e); }, e);
     if (!std::visit([](auto const& e) { return detail::is_sendable(e); }, e))
@@ -93,6 +113,7 @@ auto System::send_event(Event e) -> bool
 
 auto System::send_event(Paint_event e) -> bool
 {
+    auto const span = detail::Trace_span{"Paint_event", "event"};
     if (!detail::is_sendable(e))
         return false;
     auto const handled = detail::filter_send(e);
@@ -103,6 +124,7 @@ auto System::send_event(Paint_event e) -> bool
 
 auto System::send_event(Delete_event e) -> bool
 {
+    auto const span = detail::Trace_span{"Delete_event", "event"};
     auto const handled = detail::filter_send(e);
     if (!handled)
         detail::send(std::move(e));
@@ -150,6 +172,8 @@ void System::set_cursor(Cursor cursor, Point offset)
 
 void System::set_current_queue(Event_queue& queue) { current_queue_ = queue; }
 
+auto System::current_queue() -> Event_queue& { return current_queue_; }
+
 sl::Slot<void()> System::quit = [] { System::exit(); };
 
 detail::User_input_event_loop System::user_input_loop_;
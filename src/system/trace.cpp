@@ -0,0 +1,161 @@
+#include <termox/system/trace.hpp>
+
+#include <fstream>
+#include <ostream>
+#include <stdexcept>
+#include <string>
+
+#ifdef TERMOX_TRACE
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <cstdio>
+#include <mutex>
+#include <utility>
+#include <vector>
+
+#include <termox/common/record_ring.hpp>
+#endif
+
+namespace ox {
+
+#ifdef TERMOX_TRACE
+
+namespace {
+
+/// name, category, thread id, start and duration, times in nanoseconds.
+using Ring = Record_ring<5, Trace::capacity>;
+
+Ring ring;
+auto const epoch = Trace::Clock_t::now();
+
+std::atomic<std::uint64_t> next_thread_id = 1;
+thread_local auto const thread_id =
+    next_thread_id.fetch_add(1, std::memory_order_relaxed);
+thread_local char const* thread_name = nullptr;
+
+auto thread_names_mtx = std::mutex{};
+auto thread_names     = std::vector<std::pair<std::uint64_t, char const*>>{};
+
+/// Return \p s as a quoted JSON string.
+[[nodiscard]] auto quoted(char const* s) -> std::string
+{
+    auto result = std::string{"\""};
+    for (; *s != '\0'; ++s) {
+        switch (*s) {
+            case '"': result.append("\\\""); break;
+            case '\\': result.append("\\\\"); break;
+            default:
+                if ((unsigned char)*s >= 0x20)
+                    result.push_back(*s);
+        }
+    }
+    return result.append("\"");
+}
+
+[[nodiscard]] auto nanoseconds(Trace::Clock_t::duration d) -> std::uint64_t
+{
+    return std::chrono::duration_cast<std::chrono::nanoseconds>(d).count();
+}
+
+/// Return \p ns as a decimal number of microseconds, the trace's time unit.
+[[nodiscard]] auto microseconds(std::uint64_t ns) -> std::string
+{
+    char buffer[32];
+    std::snprintf(buffer, sizeof(buffer), "%llu.%03llu",
+                  (unsigned long long)(ns / 1'000),
+                  (unsigned long long)(ns % 1'000));
+    return buffer;
+}
+
+/// Write the thread names and every span held, each preceded by a comma.
+void write_events(std::ostream& os)
+{
+    {
+        auto const lock = std::lock_guard{thread_names_mtx};
+        for (auto const& [id, name] : thread_names) {
+            os << ",\n"
+               << R"({"name":"thread_name","ph":"M","pid":1,"tid":)" << id
+               << R"(,"args":{"name":)" << quoted(name) << "}}";
+        }
+    }
+    auto const end = ring.end();
+    auto words     = Ring::Record{};
+    for (auto i = ring.begin(); i < end; ++i) {
+        if (!ring.read(i, words))
+            continue;
+        os << ",\n"
+           << R"({"name":)" << quoted(reinterpret_cast<char const*>(words[0]))
+           << R"(,"cat":)" << quoted(reinterpret_cast<char const*>(words[1]))
+           << R"(,"ph":"X","pid":1,"tid":)" << words[2]
+           << R"(,"ts":)" << microseconds(words[3])
+           << R"(,"dur":)" << microseconds(words[4]) << "}";
+    }
+}
+
+}  // namespace
+
+void Trace::set_thread_name(char const* name)
+{
+    if (thread_name == name)
+        return;
+    thread_name     = name;
+    auto const lock = std::lock_guard{thread_names_mtx};
+    thread_names.push_back({thread_id, name});
+}
+
+void Trace::clear() { ring.clear(); }
+
+namespace detail {
+
+Trace_span::Trace_span(char const* name, char const* category)
+    : name_{name}, category_{category}, start_{Trace::Clock_t::now()}
+{}
+
+Trace_span::~Trace_span() { this->end(); }
+
+void Trace_span::end()
+{
+    if (name_ == nullptr)
+        return;
+    auto const now = Trace::Clock_t::now();
+    ring.push({reinterpret_cast<std::uint64_t>(name_),
+               reinterpret_cast<std::uint64_t>(category_), thread_id,
+               nanoseconds(start_ - epoch), nanoseconds(now - start_)});
+    name_ = nullptr;
+}
+
+}  // namespace detail
+
+#else
+
+namespace {
+
+void write_events(std::ostream&) {}
+
+}  // namespace
+
+void Trace::set_thread_name(char const*) {}
+
+void Trace::clear() {}
+
+#endif  // TERMOX_TRACE
+
+void Trace::write(std::ostream& os)
+{
+    os << "{\"displayTimeUnit\":\"ns\",\"traceEvents\":[\n"
+       << R"({"name":"process_name","ph":"M","pid":1,"tid":0,)"
+       << R"("args":{"name":"TermOx"}})";
+    write_events(os);
+    os << "\n]}\n";
+}
+
+void Trace::write(std::string const& filename)
+{
+    auto file = std::ofstream{filename};
+    if (!file.is_open())
+        throw std::runtime_error{"Trace::write(): Can't open " + filename};
+    Trace::write(file);
+}
+
+}  // namespace ox
@@ -2,6 +2,7 @@
 
 #include <termox/system/event.hpp>
 #include <termox/system/event_queue.hpp>
+#include <termox/system/trace.hpp>
 #include <termox/terminal/terminal.hpp>
 #include <termox/widget/widget.hpp>
 
@@ -9,6 +10,7 @@ namespace ox::detail {
 
 auto User_input_event_loop::run() -> int
 {
+    Trace::set_thread_name("User_input_event_loop");
     return loop_.run(
         [](Event_queue& q) { q.append(ox::Terminal::read_input()); });
 }
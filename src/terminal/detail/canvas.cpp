@@ -2,11 +2,13 @@
 
 #include <algorithm>
 #include <cassert>
+#include <cstddef>
 #include <iterator>
 #include <memory>
 #include <ostream>
 #include <vector>
 
+#include <termox/common/span.hpp>
 #include <termox/painter/brush.hpp>
 #include <termox/painter/color.hpp>
 #include <termox/painter/glyph.hpp>
@@ -52,6 +54,20 @@ auto Canvas::at(ox::Point p) -> ox::Glyph&
     return buffer_[index];
 }
 
+auto Canvas::row(int y) -> ox::Span<ox::Glyph>
+{
+    assert(y < area_.height);
+    return {buffer_.data() + (y * area_.width),
+            static_cast<std::size_t>(area_.width)};
+}
+
+auto Canvas::row(int y) const -> ox::Span<ox::Glyph const>
+{
+    assert(y < area_.height);
+    return {buffer_.data() + (y * area_.width),
+            static_cast<std::size_t>(area_.width)};
+}
+
 void Canvas::resize(ox::Area a)
 {
     if (resize_buffer_ == nullptr)
@@ -9,6 +9,7 @@
 #include <termox/common/lockable.hpp>
 #include <termox/painter/color.hpp>
 #include <termox/system/event.hpp>
+#include <termox/system/trace.hpp>
 
 namespace ox {
 
@@ -88,6 +89,7 @@ auto Dynamic_color_engine::get_dynamic_color_event() -> Dynamic_color_event
 
 void Dynamic_color_engine::loop_function(Event_queue& queue)
 {
+    Trace::set_thread_name("Dynamic_color_engine");
     // The first call to this returns immediately.
     timer_.wait();
     timer_.begin();
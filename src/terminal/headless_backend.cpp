@@ -0,0 +1,423 @@
+#include <termox/terminal/headless_backend.hpp>
+
+#include <algorithm>
+#include <cassert>
+#include <cstddef>
+#include <cstdint>
+#include <mutex>
+#include <string>
+#include <string_view>
+#include <utility>
+#include <vector>
+
+#include <esc/event.hpp>
+
+#include <termox/common/utf8.hpp>
+#include <termox/painter/trait.hpp>
+#include <termox/widget/area.hpp>
+#include <termox/widget/point.hpp>
+
+namespace {
+
+auto constexpr escape = '\x1B';
+
+auto constexpr replacement = U'�';
+
+/// Return the byte length of the UTF8 sequence led by \p lead, zero if invalid.
+[[nodiscard]] auto utf8_length(unsigned char lead) -> std::size_t
+{
+    if (lead < 0x80)
+        return 1;
+    if ((lead >> 5) == 0b110)
+        return 2;
+    if ((lead >> 4) == 0b1110)
+        return 3;
+    if ((lead >> 3) == 0b11110)
+        return 4;
+    return 0;
+}
+
+/// Write the numeric parameters of a CSI sequence to \p out, empty ones are 0.
+void parse_params(std::string_view params, std::vector<int>& out)
+{
+    out.assign(1, 0);
+    for (auto const c : params) {
+        if (c == ';' || c == ':')
+            out.push_back(0);
+        else if (c >= '0' && c <= '9')
+            out.back() = out.back() * 10 + (c - '0');
+    }
+}
+
+/// Return \p params[i], or zero if out of range.
+[[nodiscard]] auto param(std::vector<int> const& params, std::size_t i) -> int
+{
+    return i < params.size() ? params[i] : 0;
+}
+
+/// Return an indexed color, \p index is truncated to the 256 color palette.
+[[nodiscard]] auto indexed(int index) -> ox::Emulated_color
+{
+    auto result  = ox::Emulated_color{};
+    result.kind  = ox::Emulated_color::Kind::Index;
+    result.index = static_cast<std::uint8_t>(index);
+    return result;
+}
+
+/// Return a true color, each channel is truncated to eight bits.
+[[nodiscard]] auto rgb(int red, int green, int blue) -> ox::Emulated_color
+{
+    auto result  = ox::Emulated_color{};
+    result.kind  = ox::Emulated_color::Kind::RGB;
+    result.red   = static_cast<std::uint8_t>(red);
+    result.green = static_cast<std::uint8_t>(green);
+    result.blue  = static_cast<std::uint8_t>(blue);
+    return result;
+}
+
+/// Read an extended color from \p params at \p i, the parameter after 38/48.
+/** Advances \p i past the color's parameters. */
+[[nodiscard]] auto extended_color(std::vector<int> const& params,
+                                  std::size_t& i) -> ox::Emulated_color
+{
+    switch (param(params, i + 1)) {
+        case 5: i += 2; return indexed(param(params, i));
+        case 2:
+            i += 4;
+            return rgb(param(params, i - 2), param(params, i - 1),
+                       param(params, i));
+        default: ++i; return {};
+    }
+}
+
+}  // namespace
+
+namespace ox {
+
+auto operator==(Emulated_color const& a, Emulated_color const& b) -> bool
+{
+    return a.kind == b.kind && a.index == b.index && a.red == b.red &&
+           a.green == b.green && a.blue == b.blue;
+}
+
+auto operator!=(Emulated_color const& a, Emulated_color const& b) -> bool
+{
+    return !(a == b);
+}
+
+Headless_backend::Headless_backend(Area size)
+    : area_{size}, cells_((std::size_t)size.width * size.height)
+{}
+
+void Headless_backend::initialize(Mouse_mode, Key_mode, Signals)
+{
+    auto const lock = std::lock_guard{mtx_};
+    is_initialized_ = true;
+}
+
+void Headless_backend::uninitialize()
+{
+    auto const lock = std::lock_guard{mtx_};
+    is_initialized_ = false;
+}
+
+auto Headless_backend::area() const -> Area
+{
+    auto const lock = std::lock_guard{mtx_};
+    return area_;
+}
+
+void Headless_backend::write(std::string_view bytes)
+{
+    auto const lock = std::lock_guard{mtx_};
+    output_.append(bytes);
+    bytes_written_ += bytes.size();
+    this->interpret(bytes);
+}
+
+void Headless_backend::flush()
+{
+    auto const lock = std::lock_guard{mtx_};
+    ++flush_count_;
+}
+
+void Headless_backend::show_cursor(bool show)
+{
+    auto const lock  = std::lock_guard{mtx_};
+    is_cursor_shown_ = show;
+}
+
+auto Headless_backend::read() -> ::esc::Event
+{
+    auto lock = std::unique_lock{mtx_};
+    input_ready_.wait(lock, [this] { return !input_.empty(); });
+    auto result = std::move(input_.front());
+    input_.pop_front();
+    return result;
+}
+
+auto Headless_backend::color_count() const -> std::uint16_t { return 256; }
+
+auto Headless_backend::has_true_color() const -> bool { return true; }
+
+void Headless_backend::resize(Area size)
+{
+    {
+        auto const lock = std::lock_guard{mtx_};
+
+        auto cells = std::vector<Emulated_cell>((std::size_t)size.width *
+                                                size.height);
+        auto const width  = std::min(size.width, area_.width);
+        auto const height = std::min(size.height, area_.height);
+        for (auto y = 0; y < height; ++y) {
+            auto const from = std::begin(cells_) + (std::size_t)y * area_.width;
+            std::copy(from, from + width,
+                      std::begin(cells) + (std::size_t)y * size.width);
+        }
+        cells_    = std::move(cells);
+        area_     = size;
+        cursor_.x = std::min(cursor_.x, std::max(size.width - 1, 0));
+        cursor_.y = std::min(cursor_.y, std::max(size.height - 1, 0));
+        input_.push_back(::esc::Window_resize{size});
+    }
+    input_ready_.notify_one();
+}
+
+void Headless_backend::push_input(::esc::Event e)
+{
+    {
+        auto const lock = std::lock_guard{mtx_};
+        input_.push_back(std::move(e));
+    }
+    input_ready_.notify_one();
+}
+
+auto Headless_backend::pending_input() const -> std::size_t
+{
+    auto const lock = std::lock_guard{mtx_};
+    return input_.size();
+}
+
+auto Headless_backend::take_output() -> std::string
+{
+    auto const lock = std::lock_guard{mtx_};
+    return std::exchange(output_, std::string{});
+}
+
+void Headless_backend::clear_output()
+{
+    auto const lock = std::lock_guard{mtx_};
+    output_.clear();
+}
+
+auto Headless_backend::bytes_written() const -> std::uint64_t
+{
+    auto const lock = std::lock_guard{mtx_};
+    return bytes_written_;
+}
+
+auto Headless_backend::flush_count() const -> std::uint64_t
+{
+    auto const lock = std::lock_guard{mtx_};
+    return flush_count_;
+}
+
+auto Headless_backend::cell(Point p) const -> Emulated_cell
+{
+    auto const lock = std::lock_guard{mtx_};
+    assert(p.x >= 0 && p.x < area_.width && p.y >= 0 && p.y < area_.height);
+    return cells_[(std::size_t)p.y * area_.width + p.x];
+}
+
+auto Headless_backend::row_text(int y) const -> std::string
+{
+    auto const lock = std::lock_guard{mtx_};
+    assert(y >= 0 && y < area_.height);
+    auto result = std::string{};
+    char buffer[4];
+    for (auto x = 0; x < area_.width; ++x) {
+        auto const symbol = cells_[(std::size_t)y * area_.width + x].symbol;
+        result.append(buffer, utf8_encode_lossy(symbol, buffer));
+    }
+    return result;
+}
+
+auto Headless_backend::cursor() const -> Point
+{
+    auto const lock = std::lock_guard{mtx_};
+    return cursor_;
+}
+
+auto Headless_backend::is_cursor_visible() const -> bool
+{
+    auto const lock = std::lock_guard{mtx_};
+    return is_cursor_shown_;
+}
+
+auto Headless_backend::is_initialized() const -> bool
+{
+    auto const lock = std::lock_guard{mtx_};
+    return is_initialized_;
+}
+
+void Headless_backend::interpret(std::string_view bytes)
+{
+    // Only copy when the last write ended partway through a sequence.
+    auto text = bytes;
+    if (!partial_.empty()) {
+        joined_.assign(partial_);
+        joined_.append(bytes);
+        partial_.clear();
+        text = joined_;
+    }
+    auto const size = text.size();
+    auto i          = std::size_t{0};
+
+    auto const keep_rest = [&] { partial_.assign(text.substr(i)); };
+    while (i < size) {
+        auto const byte = static_cast<unsigned char>(text[i]);
+        if (byte == escape) {
+            if (i + 1 == size)
+                return keep_rest();
+            if (text[i + 1] == '[') {
+                // CSI, ends with a byte in [0x40, 0x7E].
+                auto end = i + 2;
+                while (end < size && (text[end] < 0x40 || text[end] > 0x7E))
+                    ++end;
+                if (end == size)
+                    return keep_rest();
+                this->apply_csi(text.substr(i + 2, end - i - 2), text[end]);
+                i = end + 1;
+            }
+            else if (text[i + 1] == ']') {
+                // OSC, ends with BEL or ESC '\'.
+                auto end = i + 2;
+                while (end < size && text[end] != '\a' &&
+                       !(text[end] == escape && end + 1 < size &&
+                         text[end + 1] == '\\')) {
+                    ++end;
+                }
+                if (end == size)
+                    return keep_rest();
+                i = end + (text[end] == '\a' ? 1 : 2);
+            }
+            else
+                i += 2;  // Two byte sequences, such as ESC 7.
+            continue;
+        }
+        if (byte < 0x20 || byte == 0x7F) {
+            if (byte == '\r')
+                cursor_.x = 0;
+            else if (byte == '\n' && cursor_.y + 1 < area_.height)
+                ++cursor_.y;
+            ++i;
+            continue;
+        }
+        auto const length = utf8_length(byte);
+        if (length == 0) {
+            this->put(replacement);
+            ++i;
+            continue;
+        }
+        if (i + length > size)
+            return keep_rest();
+        auto symbol = length == 1 ? char32_t{byte}
+                                  : char32_t{byte & (0x7Fu >> length)};
+        for (auto k = std::size_t{1}; k < length; ++k)
+            symbol = (symbol << 6) | (text[i + k] & 0x3F);
+        this->put(symbol);
+        i += length;
+    }
+}
+
+void Headless_backend::apply_csi(std::string_view params, char command)
+{
+    if (!params.empty() && params.front() == '?') {
+        if (params == "?25" && (command == 'h' || command == 'l'))
+            is_cursor_shown_ = command == 'h';
+        return;
+    }
+    switch (command) {
+        case 'H':
+        case 'f': {
+            parse_params(params, params_);
+            auto const row    = std::max(param(params_, 0), 1) - 1;
+            auto const column = std::max(param(params_, 1), 1) - 1;
+
+            cursor_.x = std::min(column, std::max(area_.width - 1, 0));
+            cursor_.y = std::min(row, std::max(area_.height - 1, 0));
+            break;
+        }
+        case 'm':
+            parse_params(params, params_);
+            this->apply_sgr(params_);
+            break;
+        default: break;
+    }
+}
+
+void Headless_backend::apply_sgr(std::vector<int> const& params)
+{
+    auto& traits = pen_.traits;
+    for (auto i = std::size_t{0}; i < params.size(); ++i) {
+        auto const p = params[i];
+        switch (p) {
+            case 0: pen_ = Emulated_cell{}; break;
+            case 1: traits.insert(Trait::Bold); break;
+            case 2: traits.insert(Trait::Dim); break;
+            case 3: traits.insert(Trait::Italic); break;
+            case 4: traits.insert(Trait::Underline); break;
+            case 5: traits.insert(Trait::Blink); break;
+            case 7: traits.insert(Trait::Inverse); break;
+            case 8: traits.insert(Trait::Invisible); break;
+            case 9: traits.insert(Trait::Crossed_out); break;
+            case 21: traits.insert(Trait::Double_underline); break;
+            case 22:
+                traits.remove(Trait::Bold);
+                traits.remove(Trait::Dim);
+                break;
+            case 23: traits.remove(Trait::Italic); break;
+            case 24:
+                traits.remove(Trait::Underline);
+                traits.remove(Trait::Double_underline);
+                break;
+            case 25: traits.remove(Trait::Blink); break;
+            case 27: traits.remove(Trait::Inverse); break;
+            case 28: traits.remove(Trait::Invisible); break;
+            case 29: traits.remove(Trait::Crossed_out); break;
+            case 38: pen_.foreground = extended_color(params, i); break;
+            case 39: pen_.foreground = {}; break;
+            case 48: pen_.background = extended_color(params, i); break;
+            case 49: pen_.background = {}; break;
+            default:
+                if (p >= 30 && p <= 37)
+                    pen_.foreground = indexed(p - 30);
+                else if (p >= 90 && p <= 97)
+                    pen_.foreground = indexed(p - 90 + 8);
+                else if (p >= 40 && p <= 47)
+                    pen_.background = indexed(p - 40);
+                else if (p >= 100 && p <= 107)
+                    pen_.background = indexed(p - 100 + 8);
+                break;
+        }
+    }
+}
+
+void Headless_backend::put(char32_t symbol)
+{
+    if (area_.width <= 0 || area_.height <= 0)
+        return;
+    if ((symbol >= 0xD800 && symbol <= 0xDFFF) || symbol > 0x10FFFF)
+        symbol = replacement;
+    if (cursor_.x >= area_.width) {
+        cursor_.x = 0;
+        if (cursor_.y + 1 < area_.height)
+            ++cursor_.y;
+    }
+    auto& cell  = cells_[(std::size_t)cursor_.y * area_.width + cursor_.x];
+    cell        = pen_;
+    cell.symbol = symbol;
+    ++cursor_.x;
+}
+
+}  // namespace ox
@@ -5,7 +5,9 @@
 #include <cstdlib>
 #include <iterator>
 #include <map>
+#include <memory>
 #include <optional>
+#include <stdexcept>
 #include <string>
 #include <utility>
 #include <variant>
@@ -13,13 +15,17 @@
 #include <esc/esc.hpp>
 
 #include <termox/common/u32_to_mb.hpp>
+#include <termox/common/utf8.hpp>
 #include <termox/painter/color.hpp>
 #include <termox/painter/detail/is_paintable.hpp>
 #include <termox/painter/palette/dawn_bringer16.hpp>
 #include <termox/system/detail/find_widget_at.hpp>
 #include <termox/system/event.hpp>
+#include <termox/system/profiler.hpp>
 #include <termox/system/system.hpp>
+#include <termox/system/trace.hpp>
 #include <termox/terminal/detail/canvas.hpp>
+#include <termox/terminal/terminal_backend.hpp>
 #include <termox/widget/widget.hpp>
 
 extern "C" void uninit_and_exit(int /* sig*/)
@@ -58,11 +64,24 @@ auto bg_store = Color_store{};
         return esc::escape(background(esc::Default_color{}));
 }
 
+/// Return \p symbol in the current locale, or '?' if it has no encoding there.
+[[nodiscard]] auto to_locale_symbol(char32_t symbol) -> std::string
+{
+    try {
+        return ox::u32_to_mb(symbol);
+    }
+    catch (std::runtime_error const&) {
+        return "?";
+    }
+}
+
 /// Convert a Canvas::Diff into a terminal escape sequence.
+/** Symbols that can't be encoded are replaced, rendering never throws. */
 [[nodiscard]] auto to_escape_sequence(ox::detail::Canvas::Diff const& diff)
     -> std::string
 {
-    auto sequence = std::string{};
+    auto const utf8 = ox::is_utf8_locale();
+    auto sequence   = std::string{};
     for (auto [point, glyph] : diff) {
         using esc::escape;
         sequence.append(escape(esc::Cursor_position{point}));
@@ -70,7 +89,13 @@ auto bg_store = Color_store{};
             sequence.append(escape(glyph.brush.traits));
         sequence.append(get_fg_sequence(glyph.brush.foreground));
         sequence.append(get_bg_sequence(glyph.brush.background));
-        sequence.append(ox::u32_to_mb(glyph.symbol));
+        if (utf8) {
+            char buffer[4];
+            sequence.append(buffer,
+                            ox::utf8_encode_lossy(glyph.symbol, buffer));
+        }
+        else
+            sequence.append(to_locale_symbol(glyph.symbol));
     }
     return sequence;
 }
@@ -186,7 +211,7 @@ void Terminal::initialize(Mouse_mode mouse_mode,
 {
     if (is_initialized_)
         return;
-    ::esc::initialize_interactive_terminal(mouse_mode, key_mode, signals);
+    backend_->initialize(mouse_mode, key_mode, signals);
     if (handle_sigint_)
         std::signal(SIGINT, &uninit_and_exit);
     Terminal::set_palette(dawn_bringer16::palette);
@@ -198,23 +223,33 @@ void Terminal::uninitialize()
 {
     if (!is_initialized_)
         return;
-    ::esc::uninitialize_terminal();
+    backend_->uninitialize();
     is_initialized_ = false;
 }
 
-auto Terminal::area() -> Area { return ::esc::terminal_area(); }
+auto Terminal::area() -> Area { return backend_->area(); }
 
 void Terminal::refresh()
 {
+    auto const span = detail::Trace_span{"Terminal::refresh", "terminal"};
+    auto profile    = detail::Refresh_profile{};
+
+    detail::Canvas::Diff const* diff = nullptr;
     if (full_repaint_) {
         screen_buffers.merge();
-        esc::write(to_escape_sequence(screen_buffers.current_screen_as_diff()));
+        diff          = &screen_buffers.current_screen_as_diff();
         full_repaint_ = false;
     }
     else
-        esc::write(to_escape_sequence(screen_buffers.merge_and_diff()));
-    esc::flush();
+        diff = &screen_buffers.merge_and_diff();
+    auto const sequence = to_escape_sequence(*diff);
+    {
+        auto const write = detail::Trace_span{"Terminal write", "terminal"};
+        backend_->write(sequence);
+        backend_->flush();
+    }
     screen_buffers.next.reset();
+    profile.record(diff->size(), sequence.size());
 }
 
 void Terminal::update_color_stores(Color c, True_color tc)
@@ -225,8 +260,9 @@ void Terminal::update_color_stores(Color c, True_color tc)
 
 void Terminal::repaint_color(Color c)
 {
-    esc::write(to_escape_sequence(screen_buffers.generate_color_diff(c)));
-    esc::flush();
+    auto const span = detail::Trace_span{"Terminal::repaint_color", "terminal"};
+    backend_->write(to_escape_sequence(screen_buffers.generate_color_diff(c)));
+    backend_->flush();
 }
 
 void Terminal::set_palette(Palette colors)
@@ -266,27 +302,27 @@ auto Terminal::current_palette() -> Palette const& { return palette_; }
 
 void Terminal::show_cursor(bool show)
 {
-    ::esc::set(show ? ::esc::Cursor::Show : ::esc::Cursor::Hide);
-    ::esc::flush();
+    backend_->show_cursor(show);
+    backend_->flush();
 }
 
 void Terminal::move_cursor(Point point)
 {
-    ::esc::write(::esc::escape(::esc::Cursor_position{point}));
-    ::esc::flush();
+    backend_->write(::esc::escape(::esc::Cursor_position{point}));
+    backend_->flush();
 }
 
 auto Terminal::color_count() -> std::uint16_t
 {
-    return ::esc::color_palette_size();
+    return backend_->color_count();
 }
 
-auto Terminal::has_true_color() -> bool { return ::esc::has_true_color(); }
+auto Terminal::has_true_color() -> bool { return backend_->has_true_color(); }
 
 auto Terminal::read_input() -> Event
 {
     return std::visit([](auto const& event) { return transform(event); },
-                      ::esc::read());
+                      backend_->read());
 }
 
 void Terminal::flag_full_repaint() { full_repaint_ = true; }
@@ -305,6 +341,15 @@ void Terminal::flush_screen()
 
 void Terminal::stop_dynamic_color_engine() { dynamic_color_engine_.stop(); }
 
+void Terminal::set_backend(std::unique_ptr<Terminal_backend> backend)
+{
+    if (is_initialized_)
+        throw std::logic_error{"Terminal::set_backend: already initialized"};
+    backend_ = std::move(backend);
+}
+
+auto Terminal::backend() -> Terminal_backend& { return *backend_; }
+
 void Terminal::handle_signint(bool const x) { handle_sigint_ = x; }
 
 }  // namespace ox
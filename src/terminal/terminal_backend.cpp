@@ -0,0 +1,42 @@
+#include <termox/terminal/terminal_backend.hpp>
+
+#include <cstdint>
+#include <string_view>
+
+#include <esc/esc.hpp>
+
+namespace ox {
+
+void Tty_backend::initialize(Mouse_mode mouse_mode,
+                             Key_mode key_mode,
+                             Signals signals)
+{
+    ::esc::initialize_interactive_terminal(mouse_mode, key_mode, signals);
+}
+
+void Tty_backend::uninitialize() { ::esc::uninitialize_terminal(); }
+
+auto Tty_backend::area() const -> Area { return ::esc::terminal_area(); }
+
+void Tty_backend::write(std::string_view bytes) { ::esc::write(bytes); }
+
+void Tty_backend::flush() { ::esc::flush(); }
+
+void Tty_backend::show_cursor(bool show)
+{
+    ::esc::set(show ? ::esc::Cursor::Show : ::esc::Cursor::Hide);
+}
+
+auto Tty_backend::read() -> ::esc::Event { return ::esc::read(); }
+
+auto Tty_backend::color_count() const -> std::uint16_t
+{
+    return ::esc::color_palette_size();
+}
+
+auto Tty_backend::has_true_color() const -> bool
+{
+    return ::esc::has_true_color();
+}
+
+}  // namespace ox
@@ -0,0 +1,34 @@
+#include <termox/widget/layouts/detail/layout_pass.hpp>
+
+#include <termox/system/event.hpp>
+#include <termox/system/system.hpp>
+#include <termox/widget/area.hpp>
+#include <termox/widget/point.hpp>
+#include <termox/widget/widget.hpp>
+
+namespace ox::layout::detail {
+
+auto apply_geometry(Widget& child, Point position, Area area)
+    -> Deferrable_layout*
+{
+    auto const moves   = child.top_left() != position;
+    auto const resizes = child.area() != area;
+    auto* const layout =
+        moves && resizes && child.is_layout_type()
+            ? dynamic_cast<Deferrable_layout*>(&child)
+            : nullptr;
+    if (moves) {
+        if (layout != nullptr)
+            layout->relayout_deferred_ = true;
+        System::send_event(Move_event{child, position});
+        if (layout != nullptr)
+            layout->relayout_deferred_ = false;
+    }
+    if (resizes)
+        System::send_event(Resize_event{child, area});
+    // An event filter consumed the Resize_event, the layout skipped arranging
+    // its children at its new position.
+    return layout != nullptr && child.area() != area ? layout : nullptr;
+}
+
+}  // namespace ox::layout::detail
@@ -1,9 +1,12 @@
 #include <chrono>
 #include <termox/widget/widget.hpp>
 
+#include <atomic>
 #include <chrono>
+#include <cstddef>
 #include <cstdint>
-#include <mutex>
+#include <memory>
+#include <set>
 #include <string>
 #include <utility>
 
@@ -14,15 +17,14 @@
 #include <termox/system/event.hpp>
 #include <termox/system/system.hpp>
 #include <termox/terminal/terminal.hpp>
+#include <termox/widget/widget_arena.hpp>
 
 namespace {
 
-auto get_unique_id() -> std::uint16_t
+auto get_unique_id() -> std::uint64_t
 {
-    static auto mtx     = std::mutex{};
-    static auto current = std::uint16_t{0};
-    auto const lock     = std::scoped_lock{mtx};
-    return ++current;
+    static auto current = std::atomic<std::uint64_t>{0};
+    return current.fetch_add(1, std::memory_order_relaxed) + 1;
 }
 
 void post_child_polished(ox::Widget& w)
@@ -72,11 +74,18 @@ Widget::Widget(Parameters p)
              std::move(p.cursor)}
 {}
 
+auto Widget::operator new(std::size_t size) -> void*
+{
+    return Widget_arena::allocate(size);
+}
+
+void Widget::operator delete(void* p) noexcept { Widget_arena::deallocate(p); }
+
 void Widget::set_name(std::string name) { name_ = std::move(name); }
 
 auto Widget::name() const -> std::string const& { return name_; }
 
-auto Widget::unique_id() const -> std::uint16_t { return unique_id_; }
+auto Widget::unique_id() const -> std::uint64_t { return unique_id_; }
 
 void Widget::set_wallpaper(Glyph g)
 {
@@ -115,7 +124,9 @@ void Widget::install_event_filter(Widget& filter)
 {
     if (&filter == this)
         return;
-    auto const result = event_filters_.insert(&filter);
+    if (event_filters_ == nullptr)
+        event_filters_ = std::make_unique<std::set<Widget*>>();
+    auto const result = event_filters_->insert(&filter);
     if (result.second) {  // if insert happened
         // Remove filter from list on destruction of filter
         auto remove_on_destroy = sl::Slot<void()>{
@@ -128,12 +139,14 @@ void Widget::install_event_filter(Widget& filter)
 
 void Widget::remove_event_filter(Widget& filter)
 {
-    event_filters_.erase(&filter);
+    if (event_filters_ != nullptr)
+        event_filters_->erase(&filter);
 }
 
 auto Widget::get_event_filters() const -> std::set<Widget*> const&
 {
-    return event_filters_;
+    static auto const no_filters = std::set<Widget*>{};
+    return event_filters_ == nullptr ? no_filters : *event_filters_;
 }
 
 void Widget::enable_animation(std::chrono::milliseconds interval)
@@ -165,12 +178,9 @@ auto Widget::is_animated() const -> bool { return is_animated_; }
 auto Widget::get_descendants() const -> std::vector<Widget*>
 {
     auto descendants = std::vector<Widget*>{};
-    for (auto const& w_ptr : children_) {
-        descendants.push_back(w_ptr.get());
-        auto branch = w_ptr->get_descendants();
-        descendants.insert(std::end(descendants), std::begin(branch),
-                           std::end(branch));
-    }
+    this->for_each_descendant([&descendants](Widget const& w) {
+        descendants.push_back(const_cast<Widget*>(&w));
+    });
     return descendants;
 }
 
@@ -312,6 +322,16 @@ void Widget::set_area(Area a) { area_ = a; }
 
 void Widget::set_parent(Widget* parent) { parent_ = parent; }
 
+void Widget::set_cached_child_index(std::size_t index)
+{
+    cached_child_index_ = index;
+}
+
+auto Widget::cached_child_index() const -> std::size_t
+{
+    return cached_child_index_;
+}
+
 auto widget(std::string name,
             Focus_policy focus_policy,
             Size_policy width_policy,
@@ -0,0 +1,173 @@
+#include <termox/widget/widget_arena.hpp>
+
+#include <algorithm>
+#include <cstddef>
+#include <iterator>
+#include <memory>
+#include <new>
+#include <vector>
+
+namespace {
+
+// Arena allocations are rounded to keep each Widget max aligned.
+constexpr auto alignment = alignof(std::max_align_t);
+
+/// Round \p size up to a multiple of alignment.
+[[nodiscard]] constexpr auto round_up(std::size_t size) -> std::size_t
+{
+    return (size + alignment - 1) / alignment * alignment;
+}
+
+}  // namespace
+
+namespace ox {
+
+struct Widget_arena::Storage {
+    struct Block {
+        std::unique_ptr<std::byte[]> data;
+        std::size_t size;
+    };
+
+    /// The address range of a Block, for finding the Storage of a pointer.
+    struct Block_range {
+        std::byte const* begin;
+        std::byte const* end;
+        Storage* storage;
+    };
+
+    std::size_t block_size;
+    std::vector<Block> blocks;
+    std::size_t block_index = 0;
+    std::size_t offset      = 0;
+
+    // One for each live Widget, plus one for the owning Widget_arena.
+    std::size_t references = 1;
+    bool has_owner         = true;
+
+    /// Blocks of every Storage on this thread, sorted by address.
+    static thread_local std::vector<Block_range> ranges;
+
+    explicit Storage(std::size_t block_size_) : block_size{block_size_} {}
+
+    ~Storage()
+    {
+        ranges.erase(std::remove_if(std::begin(ranges), std::end(ranges),
+                                    [this](Block_range const& r) {
+                                        return r.storage == this;
+                                    }),
+                     std::end(ranges));
+    }
+
+    /// Bump allocate \p size bytes, reserving a new Block if needed.
+    [[nodiscard]] auto allocate(std::size_t size) -> std::byte*
+    {
+        ++references;
+        for (; block_index < blocks.size(); ++block_index, offset = 0) {
+            auto& block = blocks[block_index];
+            if (offset + size <= block.size) {
+                auto* const memory = block.data.get() + offset;
+                offset += size;
+                return memory;
+            }
+        }
+        auto const length = std::max(block_size, size);
+        blocks.push_back({std::unique_ptr<std::byte[]>{new std::byte[length]},
+                          length});
+        block_index        = blocks.size() - 1;
+        offset             = size;
+        auto* const memory = blocks.back().data.get();
+        auto const range   = Block_range{memory, memory + length, this};
+        ranges.insert(std::upper_bound(std::begin(ranges), std::end(ranges),
+                                       range,
+                                       [](auto const& a, auto const& b) {
+                                           return a.begin < b.begin;
+                                       }),
+                      range);
+        return memory;
+    }
+
+    /// Drop one reference, free *this if it was the last.
+    /** Blocks are reused from the start once no Widgets are left. */
+    void release()
+    {
+        auto const remaining = --references;
+        if (remaining == 0)
+            delete this;
+        else if (remaining == 1 && has_owner) {
+            block_index = 0;
+            offset      = 0;
+        }
+    }
+
+    /// Return the Storage on this thread that \p p was allocated from.
+    /** Returns nullptr if \p p is not from any arena. */
+    [[nodiscard]] static auto find(void const* p) -> Storage*
+    {
+        if (ranges.empty())
+            return nullptr;
+        auto const* const address = static_cast<std::byte const*>(p);
+        auto const after          = std::upper_bound(
+            std::begin(ranges), std::end(ranges), address,
+            [](std::byte const* a, Block_range const& r) {
+                return a < r.begin;
+            });
+        if (after == std::begin(ranges))
+            return nullptr;
+        auto const& range = *std::prev(after);
+        return address < range.end ? range.storage : nullptr;
+    }
+};
+
+thread_local std::vector<Widget_arena::Storage::Block_range>
+    Widget_arena::Storage::ranges;
+
+thread_local Widget_arena::Storage* Widget_arena::current_ = nullptr;
+
+Widget_arena::Scope::Scope(Widget_arena& arena) : previous_{current_}
+{
+    current_ = arena.storage_;
+}
+
+Widget_arena::Scope::~Scope() { current_ = previous_; }
+
+Widget_arena::Widget_arena(std::size_t block_size)
+    : storage_{new Storage{block_size}}
+{}
+
+Widget_arena::~Widget_arena()
+{
+    storage_->has_owner = false;
+    storage_->release();
+}
+
+auto Widget_arena::live_count() const -> std::size_t
+{
+    return storage_->references - 1;
+}
+
+auto Widget_arena::reserved_bytes() const -> std::size_t
+{
+    auto total = std::size_t{0};
+    for (auto const& block : storage_->blocks)
+        total += block.size;
+    return total;
+}
+
+auto Widget_arena::allocate(std::size_t size) -> void*
+{
+    if (current_ == nullptr)
+        return ::operator new(size);
+    return current_->allocate(::round_up(size));
+}
+
+void Widget_arena::deallocate(void* p) noexcept
+{
+    if (p == nullptr)
+        return;
+    if (auto* const storage = Storage::find(p); storage != nullptr)
+        storage->release();
+    else
+        ::operator delete(p);
+}
+
+}  // namespace ox
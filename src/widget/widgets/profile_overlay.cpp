@@ -0,0 +1,148 @@
+#include <termox/widget/widgets/profile_overlay.hpp>
+
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <memory>
+#include <string>
+
+#include <termox/painter/color.hpp>
+#include <termox/painter/glyph_string.hpp>
+#include <termox/painter/painter.hpp>
+#include <termox/painter/trait.hpp>
+#include <termox/system/profiler.hpp>
+#include <termox/widget/pipe.hpp>
+
+namespace {
+
+using Duration = ox::Profiler::Duration;
+
+/// Return \p d as milliseconds with two decimal places.
+[[nodiscard]] auto ms(Duration d) -> std::string
+{
+    char buffer[32];
+    std::snprintf(buffer, sizeof(buffer), "%.2fms",
+                  std::chrono::duration<double, std::milli>(d).count());
+    return buffer;
+}
+
+/// Return a name for \p w, that is unique even if Widget::name() is empty.
+[[nodiscard]] auto label(ox::Profiler::Widget_paint const& w) -> std::string
+{
+    return w.name + "#" + std::to_string(w.id);
+}
+
+/// Return \p text left aligned in a field of \p width, truncated if longer.
+[[nodiscard]] auto field(std::string text, std::size_t width) -> std::string
+{
+    text.resize(width, ' ');
+    return text;
+}
+
+}  // namespace
+
+namespace ox {
+
+Profile_overlay::Profile_overlay(int top_count, Duration_t period)
+    : top_count_{top_count}, period_{period}
+{
+    this->set_name("Profile_overlay");
+    *this | pipe::fixed_height(4 + top_count_);
+}
+
+Profile_overlay::Profile_overlay(Parameters p)
+    : Profile_overlay{p.top_count, p.period}
+{}
+
+void Profile_overlay::set_top_count(int n)
+{
+    top_count_ = n;
+    *this | pipe::fixed_height(4 + top_count_);
+    this->update();
+}
+
+auto Profile_overlay::top_count() const -> int { return top_count_; }
+
+auto Profile_overlay::paint_event(Painter& p) -> bool
+{
+    if (!Profiler::is_enabled) {
+        p.put(U"Profiler disabled, build with TERMOX_ENABLE_PROFILER",
+              {0, 0});
+        return Widget::paint_event(p);
+    }
+
+    auto const& frames = stats_.frames;
+    auto total         = Duration{0};
+    auto longest       = Duration{0};
+    auto paint         = Duration{0};
+    auto layout        = Duration{0};
+    auto refresh       = Duration{0};
+    auto bytes         = std::size_t{0};
+    for (auto const& f : frames) {
+        total += f.total;
+        longest = std::max(longest, f.total);
+        paint += f.paint;
+        layout += f.layout;
+        refresh += f.refresh;
+        bytes += f.bytes_written;
+    }
+    auto const count = std::max(frames.size(), std::size_t{1});
+
+    p.put(std::to_string(frames.size()) + " frames, avg " +
+              ms(total / count) + ", max " + ms(longest),
+          {0, 0});
+    p.put("paint " + ms(paint / count) + ", layout " + ms(layout / count) +
+              ", refresh " + ms(refresh / count) + ", " +
+              std::to_string(bytes / count) + " B",
+          {0, 1});
+    p.put(Glyph_string{field("Widget", 32) + field("paints", 8) +
+                           field("total", 10) + "max",
+                       Trait::Bold},
+          {0, 3});
+
+    auto const shown =
+        std::min(stats_.widgets.size(), (std::size_t)std::max(top_count_, 0));
+    for (auto i = std::size_t{0}; i < shown; ++i) {
+        auto const& w = stats_.widgets[i];
+        p.put(field(label(w), 31) + " " + field(std::to_string(w.count), 8) +
+                  field(ms(w.total), 10) + ms(w.max),
+              {0, 4 + (int)i});
+    }
+    return Widget::paint_event(p);
+}
+
+auto Profile_overlay::timer_event() -> bool
+{
+    stats_ = Profiler::snapshot(next_frame_);
+    if (!stats_.frames.empty())
+        next_frame_ = stats_.frames.back().number + 1;
+    this->update();
+    return Widget::timer_event();
+}
+
+auto Profile_overlay::enable_event() -> bool
+{
+    if (Profiler::is_enabled)
+        this->enable_animation(period_);
+    return Widget::enable_event();
+}
+
+auto Profile_overlay::disable_event() -> bool
+{
+    this->disable_animation();
+    return Widget::disable_event();
+}
+
+auto profile_overlay(int top_count, Profile_overlay::Duration_t period)
+    -> std::unique_ptr<Profile_overlay>
+{
+    return std::make_unique<Profile_overlay>(top_count, period);
+}
+
+auto profile_overlay(Profile_overlay::Parameters p)
+    -> std::unique_ptr<Profile_overlay>
+{
+    return std::make_unique<Profile_overlay>(std::move(p));
+}
+
+}  // namespace ox
@@ -1,12 +1,15 @@
 #include <termox/widget/widgets/text_view.hpp>
 
 #include <algorithm>
+#include <cstddef>
 #include <iterator>
 #include <memory>
 #include <string>
 #include <utility>
 
+#include <termox/common/span.hpp>
 #include <termox/painter/brush.hpp>
+#include <termox/painter/glyph.hpp>
 #include <termox/painter/glyph_string.hpp>
 #include <termox/painter/painter.hpp>
 #include <termox/widget/align.hpp>
@@ -212,9 +215,7 @@ auto Text_view::paint_event(Painter& p) -> bool
 {
     auto line_n = 0;
     auto paint  = [&p, &line_n, this](Line_info const& line) {
-        auto const sub_begin = std::begin(this->contents_) + line.start_index;
-        auto const sub_end   = sub_begin + line.length;
-        auto start           = 0;
+        auto start = 0;
         switch (alignment_) {
             case Align::Top:
             case Align::Left: start = 0; break;
@@ -224,7 +225,9 @@ auto Text_view::paint_event(Painter& p) -> bool
             case Align::Bottom:
             case Align::Right: start = this->area().width - line.length; break;
         }
-        p.put(Glyph_string(sub_begin, sub_end), {start, line_n++});
+        p.put(Span<Glyph const>{this->contents_.data() + line.start_index,
+                                static_cast<std::size_t>(line.length)},
+              {start, line_n++});
     };
     auto const begin = std::next(std::cbegin(display_state_), this->top_line());
     auto const end   = [&] {
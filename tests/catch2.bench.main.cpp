@@ -0,0 +1,129 @@
+#define CATCH_CONFIG_MAIN
+#include <catch2/catch.hpp>
+
+#include <cstdio>
+#include <ctime>
+#include <ostream>
+#include <string>
+#include <thread>
+#include <vector>
+
+// Adds a "json" reporter, run with `-r json -o results.json` to write every
+// benchmark mean to a file. The layout follows Google Benchmark's JSON output,
+// so its tools/compare.py can diff two runs, each benchmark is named
+// "<test case>/<benchmark>". Times are in nanoseconds.
+
+namespace {
+
+/// Return \p s as a quoted JSON string.
+[[nodiscard]] auto quoted(std::string const& s) -> std::string
+{
+    auto result = std::string{"\""};
+    for (char const c : s) {
+        switch (c) {
+            case '"': result.append("\\\""); break;
+            case '\\': result.append("\\\\"); break;
+            case '\n': result.append("\\n"); break;
+            case '\t': result.append("\\t"); break;
+            default:
+                if ((unsigned char)c < 0x20) {
+                    char buffer[7];
+                    std::snprintf(buffer, sizeof(buffer), "\\u%04x", c);
+                    result.append(buffer);
+                }
+                else
+                    result.push_back(c);
+        }
+    }
+    return result.append("\"");
+}
+
+/// Return the local time as ISO 8601.
+[[nodiscard]] auto now() -> std::string
+{
+    auto const t = std::time(nullptr);
+    char buffer[32];
+    auto const length =
+        std::strftime(buffer, sizeof(buffer), "%FT%T%z", std::localtime(&t));
+    return {buffer, length};
+}
+
+class Json_reporter : public Catch::StreamingReporterBase<Json_reporter> {
+   public:
+    using StreamingReporterBase::StreamingReporterBase;
+
+    [[nodiscard]] static auto getDescription() -> std::string
+    {
+        return "Benchmark results as Google Benchmark compatible JSON";
+    }
+
+   public:
+    void assertionStarting(Catch::AssertionInfo const&) override {}
+
+    auto assertionEnded(Catch::AssertionStats const&) -> bool override
+    {
+        return true;
+    }
+
+    void testCaseStarting(Catch::TestCaseInfo const& info) override
+    {
+        StreamingReporterBase::testCaseStarting(info);
+        test_case_ = info.name;
+    }
+
+    void benchmarkEnded(Catch::BenchmarkStats<> const& stats) override
+    {
+        results_.push_back({test_case_ + "/" + stats.info.name, stats});
+    }
+
+    void testRunEnded(Catch::TestRunStats const& stats) override
+    {
+        auto& os = stream;
+        os.precision(12);
+        os << "{\n  \"context\": {\n"
+           << "    \"date\": " << quoted(now()) << ",\n"
+           << "    \"num_cpus\": " << std::thread::hardware_concurrency()
+           << ",\n"
+#ifdef NDEBUG
+           << "    \"library_build_type\": \"release\"\n"
+#else
+           << "    \"library_build_type\": \"debug\"\n"
+#endif
+           << "  },\n  \"benchmarks\": [";
+        auto separator = "\n";
+        for (auto const& [name, s] : results_) {
+            auto const mean = s.mean.point.count();
+            os << separator << "    {\n"
+               << "      \"name\": " << quoted(name) << ",\n"
+               << "      \"run_name\": " << quoted(name) << ",\n"
+               << "      \"run_type\": \"iteration\",\n"
+               << "      \"iterations\": " << s.info.iterations << ",\n"
+               << "      \"samples\": " << s.info.samples << ",\n"
+               << "      \"real_time\": " << mean << ",\n"
+               << "      \"cpu_time\": " << mean << ",\n"
+               << "      \"mean_low\": " << s.mean.lower_bound.count() << ",\n"
+               << "      \"mean_high\": " << s.mean.upper_bound.count()
+               << ",\n"
+               << "      \"std_dev\": " << s.standardDeviation.point.count()
+               << ",\n"
+               << "      \"time_unit\": \"ns\"\n"
+               << "    }";
+            separator = ",\n";
+        }
+        os << "\n  ]\n}\n";
+        StreamingReporterBase::testRunEnded(stats);
+    }
+
+   private:
+    struct Result {
+        std::string name;
+        Catch::BenchmarkStats<> stats;
+    };
+
+    std::string test_case_;
+    std::vector<Result> results_;
+};
+
+}  // namespace
+
+CATCH_REGISTER_REPORTER("json", Json_reporter)
@@ -0,0 +1,118 @@
+#include <clocale>
+#include <iterator>
+#include <stdexcept>
+
+#include <catch2/catch.hpp>
+
+#include <termox/painter/brush.hpp>
+#include <termox/painter/color.hpp>
+#include <termox/painter/compact_glyph_string.hpp>
+#include <termox/painter/glyph.hpp>
+#include <termox/painter/glyph_string.hpp>
+#include <termox/painter/trait.hpp>
+
+static void init() { std::setlocale(LC_ALL, "en_US.UTF-8"); }
+
+TEST_CASE("Compact_glyph_string construction", "[Compact_glyph_string]")
+{
+    init();
+    using ox::Color;
+    using ox::Trait;
+
+    auto const empty = ox::Compact_glyph_string{};
+    CHECK(empty.empty());
+    CHECK(empty.runs().empty());
+    CHECK(empty.begin() == empty.end());
+
+    auto cs = ox::Compact_glyph_string{"hello,ӵ World!🌎~", Trait::Bold,
+                                       fg(Color::Red)};
+    REQUIRE(cs.size() == 16);
+    CHECK(cs.runs().size() == 1);
+    CHECK(cs.u32str() == U"hello,ӵ World!🌎~");
+    CHECK(cs.str() == "hello,ӵ World!🌎~");
+    CHECK(cs[6] == ox::Glyph{U'ӵ', Trait::Bold, fg(Color::Red)});
+    CHECK(cs.front().symbol == U'h');
+    CHECK(cs.back().symbol == U'~');
+    CHECK_THROWS_AS(cs.at(16), std::out_of_range);
+    for (auto g : cs)
+        CHECK(g.brush == ox::Brush{Trait::Bold, fg(Color::Red)});
+}
+
+TEST_CASE("Compact_glyph_string round trip", "[Compact_glyph_string]")
+{
+    init();
+    using ox::Color;
+    using ox::Trait;
+
+    auto gs = ox::Glyph_string{U"aaa", Trait::Bold};
+    gs.append(ox::Glyph_string{U"bb", bg(Color::Blue)});
+    gs.append(ox::Glyph_string{U"c", Trait::Bold});
+    gs.append(ox::Glyph_string{U"dd", Trait::Bold});
+
+    auto const cs = ox::Compact_glyph_string{gs};
+    REQUIRE(cs.size() == 8);
+    REQUIRE(cs.runs().size() == 3);
+    CHECK(cs.runs()[0].end == 3);
+    CHECK(cs.runs()[1].end == 5);
+    CHECK(cs.runs()[2].end == 8);
+    CHECK(cs.to_glyph_string() == gs);
+
+    auto i = 0;
+    for (auto g : cs)
+        CHECK(g == gs[i++]);
+    CHECK(std::distance(cs.begin(), cs.end()) == 8);
+    CHECK(*(cs.end() - 4) == gs[4]);
+    CHECK(cs.begin()[5] == gs[5]);
+    auto it = cs.end();
+    for (auto j = 7; j >= 0; --j)
+        CHECK(*--it == gs[j]);
+}
+
+TEST_CASE("Compact_glyph_string modification", "[Compact_glyph_string]")
+{
+    init();
+    using ox::Color;
+    using ox::Trait;
+    auto const bold = ox::Brush{Trait::Bold};
+    auto const blue = ox::Brush{bg(Color::Blue)};
+
+    auto cs = ox::Compact_glyph_string{U"abcdef", bold};
+    cs.set_brush(2, 2, blue);
+    REQUIRE(cs.runs().size() == 3);
+    CHECK(cs.brush_at(1) == bold);
+    CHECK(cs.brush_at(2) == blue);
+    CHECK(cs.brush_at(3) == blue);
+    CHECK(cs.brush_at(4) == bold);
+
+    cs.erase(2, 2);
+    CHECK(cs.u32str() == U"abef");
+    REQUIRE(cs.runs().size() == 1);
+    CHECK(cs.runs()[0].end == 4);
+
+    cs.insert(4, U"XY", blue);
+    cs.insert(0, U"Z", bold);
+    CHECK(cs.u32str() == U"ZabefXY");
+    REQUIRE(cs.runs().size() == 2);
+    CHECK(cs.runs()[0].end == 5);
+    CHECK(cs.brush_at(6) == blue);
+
+    cs.clear_traits();
+    cs.remove_background();
+    REQUIRE(cs.runs().size() == 1);
+    CHECK(cs.brush_at(0) == ox::Brush{});
+
+    cs.add_traits(Trait::Italic);
+    cs.add_color(fg(Color::Green));
+    CHECK(cs.brush_at(6) == ox::Brush{Trait::Italic, fg(Color::Green)});
+
+    cs.erase(3);
+    CHECK(cs.u32str() == U"Zab");
+    CHECK(cs.runs().back().end == 3);
+
+    auto other = ox::Compact_glyph_string{U"Zab", Trait::Italic,
+                                          fg(Color::Green)};
+    CHECK(cs == other);
+    other.append(ox::Glyph{U'!', Trait::Italic, fg(Color::Green)});
+    CHECK(other.runs().size() == 1);
+    CHECK(cs != other);
+}
@@ -0,0 +1,29 @@
+#ifndef TERMOX_TESTS_CURRENT_QUEUE_HPP
+#define TERMOX_TESTS_CURRENT_QUEUE_HPP
+#include <termox/system/event_queue.hpp>
+#include <termox/system/system.hpp>
+
+namespace ox::test {
+
+/// Makes an Event_queue current until destroyed, then restores the previous.
+/** Declare it after the Event_queue and before any Widgets, so the Widgets are
+ *  destroyed while the queue is still current and the queue outlives this. */
+class Current_queue {
+   public:
+    explicit Current_queue(Event_queue& queue)
+        : previous_{System::current_queue()}
+    {
+        System::set_current_queue(queue);
+    }
+
+    Current_queue(Current_queue const&) = delete;
+    auto operator=(Current_queue const&) -> Current_queue& = delete;
+
+    ~Current_queue() { System::set_current_queue(previous_); }
+
+   private:
+    Event_queue& previous_;
+};
+
+}  // namespace ox::test
+#endif  // TERMOX_TESTS_CURRENT_QUEUE_HPP
@@ -0,0 +1,137 @@
+#include <cstddef>
+#include <memory>
+#include <thread>
+#include <utility>
+#include <vector>
+
+#include <catch2/catch.hpp>
+
+#include <termox/painter/color.hpp>
+
+#include "../demos/fractal/float_t.hpp"
+#include "../demos/fractal/kernels.hpp"
+#include "../demos/fractal/mandelbrot.hpp"
+#include "../demos/fractal/tile_renderer.hpp"
+
+// A 200x120 pixel view of the Mandelbrot set, one request through to the final
+// pass. Coordinate list is the previous Fractal_demo rendering: every pixel is
+// recomputed into a list of points on each change of the view.
+//
+// Kernel runs iterate the same 24,000 points near the boundary of the set in
+// each Precision, divide 24,000 by the reported mean for points per second.
+
+namespace {
+
+using namespace fractal;
+
+auto constexpr width  = 200;
+auto constexpr height = 120;
+
+[[nodiscard]] auto make_scene() -> Scene
+{
+    auto result        = Scene{};
+    result.width       = width;
+    result.height      = height;
+    result.color_count = 78;
+    return result;
+}
+
+void finish(Tile_renderer& r)
+{
+    while (r.is_busy())
+        std::this_thread::yield();
+}
+
+/// width * height points around -0.75 + 0.1i, a pixel apart.
+template <typename T>
+struct Points {
+    std::vector<T> x;
+    std::vector<T> y;
+    std::vector<unsigned int> out;
+
+    Points() : out(width * height)
+    {
+        for (auto j = 0; j < height; ++j) {
+            for (auto i = 0; i < width; ++i) {
+                x.push_back((T)(-0.85 + i * 0.001));
+                y.push_back((T)(0.04 + j * 0.001));
+            }
+        }
+    }
+
+    auto run() -> unsigned int
+    {
+        mandelbrot_points<T>(x.data(), y.data(), x.size(), 624, out.data());
+        return out.back();
+    }
+};
+
+}  // namespace
+
+TEST_CASE("Fractal Render", "[Fractal][!benchmark]")
+{
+    auto const scene = make_scene();
+    auto pixels      = std::vector<ox::Color>{};
+
+    BENCHMARK("Coordinate list [full frame]")
+    {
+        using Point = std::pair<Float_t, Float_t>;
+        auto points = std::vector<std::pair<Point, unsigned int>>{};
+        points.reserve(width * height);
+        auto const limit = 78u;
+        for (auto y = 0; y < height; ++y) {
+            for (auto x = 0; x < width; ++x) {
+                auto const re = (x - width / 2) * (Float_t)4 / width;
+                auto const im = (y - height / 2) * (Float_t)4 / height;
+                points.push_back({{re, im}, mandelbrot(re, im, limit)});
+            }
+        }
+        return points.size();
+    };
+
+    BENCHMARK_ADVANCED("Tile_renderer [full frame]")
+    (Catch::Benchmark::Chronometer meter)
+    {
+        auto r = std::vector<std::unique_ptr<Tile_renderer>>{};
+        for (auto i = 0; i < meter.runs(); ++i) {
+            r.push_back(std::make_unique<Tile_renderer>());
+            r.back()->set_scene(scene);
+        }
+        auto const view = Pixel_rect{-width / 2, -height / 2, width, height};
+        meter.measure([&](int i) {
+            r[i]->request(0, view);
+            finish(*r[i]);
+            r[i]->paint_to(0, view, pixels);
+        });
+    };
+
+    // Only the column of tiles scrolled into view is rendered.
+    auto panned = Tile_renderer{};
+    panned.set_scene(scene);
+    auto view = Pixel_rect{-width / 2, -height / 2, width, height};
+    panned.request(0, view);
+    finish(panned);
+
+    BENCHMARK("Tile_renderer [pan 8 pixels]")
+    {
+        view.left += 8;
+        panned.request(0, view);
+        finish(panned);
+        panned.paint_to(0, view, pixels);
+        return pixels.size();
+    };
+}
+
+TEST_CASE("Fractal Kernels", "[Fractal][!benchmark]")
+{
+    auto f  = Points<float>{};
+    auto d  = Points<double>{};
+    auto ld = Points<long double>{};
+
+    BENCHMARK("mandelbrot_points float [24,000 points]") { return f.run(); };
+    BENCHMARK("mandelbrot_points double [24,000 points]") { return d.run(); };
+    BENCHMARK("mandelbrot_points long double [24,000 points]")
+    {
+        return ld.run();
+    };
+}
@@ -0,0 +1,153 @@
+#include "../demos/fractal/kernels.hpp"
+
+#include <complex>
+#include <cstddef>
+#include <cstdint>
+#include <random>
+#include <vector>
+
+#include <catch2/catch.hpp>
+
+#include "../demos/fractal/float_t.hpp"
+#include "../demos/fractal/julia.hpp"
+#include "../demos/fractal/mandelbrot.hpp"
+
+using fractal::Float_t;
+using fractal::Precision;
+
+namespace {
+
+/// Iterate z = z^2 + c one point at a time in T, the same operations as the
+/// vector kernels.
+template <typename T>
+[[nodiscard]] auto escape_count(T zx, T zy, T cx, T cy, unsigned int limit)
+    -> unsigned int
+{
+    auto count = 0u;
+    for (; count < limit; ++count) {
+        auto const xx = zx * zx;
+        auto const yy = zy * zy;
+        if (!(xx + yy < 4))
+            break;
+        zy = T{2} * zx * zy + cy;
+        zx = xx - yy + cx;
+    }
+    return count;
+}
+
+template <typename T>
+struct Points {
+    std::vector<T> x;
+    std::vector<T> y;
+};
+
+/// Return \p count points around the Mandelbrot set, some outside radius 2.
+template <typename T>
+[[nodiscard]] auto random_points(std::size_t count) -> Points<T>
+{
+    auto gen    = std::mt19937{static_cast<unsigned>(count)};
+    auto real   = std::uniform_real_distribution<T>{-2.5, 1.5};
+    auto imag   = std::uniform_real_distribution<T>{-1.5, 1.5};
+    auto result = Points<T>{};
+    for (auto i = std::size_t{0}; i < count; ++i) {
+        result.x.push_back(real(gen));
+        result.y.push_back(imag(gen));
+    }
+    return result;
+}
+
+template <typename T>
+void check_against_scalar()
+{
+    auto const c = std::complex<T>{-0.8, 0.156};
+
+    // Counts that are not a multiple of the lane count leave padded lanes.
+    for (auto const count : {0, 1, 3, 7, 8, 13, 64, 101}) {
+        auto const points = random_points<T>(count);
+        for (auto const limit : {0u, 1u, 7u, 100u}) {
+            INFO("count " << count << ", limit " << limit);
+            auto mandelbrot = std::vector<unsigned int>(count);
+            auto julia      = std::vector<unsigned int>(count);
+            fractal::mandelbrot_points<T>(points.x.data(), points.y.data(),
+                                          count, limit, mandelbrot.data());
+            fractal::julia_points<T>(points.x.data(), points.y.data(), count,
+                                     c, limit, julia.data());
+            for (auto i = std::size_t{0}; i < (std::size_t)count; ++i) {
+                auto const x = points.x[i];
+                auto const y = points.y[i];
+                CHECK(mandelbrot[i] == escape_count<T>(0, 0, x, y, limit));
+                CHECK(julia[i] ==
+                      escape_count<T>(x, y, c.real(), c.imag(), limit));
+            }
+        }
+    }
+}
+
+/// Return the fraction of a 64x64 grid of \p pixel_size spaced points whose
+/// Mandelbrot count in T differs from the long double count.
+/** The grid is on the boundary of the set, where rounding shows first. */
+template <typename T>
+[[nodiscard]] auto mismatch_rate(Float_t pixel_size, unsigned int limit)
+    -> double
+{
+    auto constexpr n = 64;
+    auto x           = std::vector<T>{};
+    auto y           = std::vector<T>{};
+    auto exact       = std::vector<unsigned int>{};
+    for (auto row = 0; row < n; ++row) {
+        for (auto column = 0; column < n; ++column) {
+            auto const re = Float_t{-0.7453} + column * pixel_size;
+            auto const im = Float_t{0.1127} - row * pixel_size;
+            x.push_back((T)re);
+            y.push_back((T)im);
+            exact.push_back(fractal::mandelbrot(re, im, limit));
+        }
+    }
+    auto counts = std::vector<unsigned int>(exact.size());
+    fractal::mandelbrot_points<T>(x.data(), y.data(), x.size(), limit,
+                                  counts.data());
+    auto mismatches = 0;
+    for (auto i = std::size_t{0}; i < counts.size(); ++i)
+        mismatches += counts[i] != exact[i] ? 1 : 0;
+    return (double)mismatches / counts.size();
+}
+
+}  // namespace
+
+TEST_CASE("Fractal kernels match scalar iteration in the same type",
+          "[fractal]")
+{
+    check_against_scalar<float>();
+    check_against_scalar<double>();
+
+    auto const points = random_points<long double>(13);
+    auto counts       = std::vector<unsigned int>(13);
+    fractal::mandelbrot_points<long double>(points.x.data(), points.y.data(),
+                                            13, 100, counts.data());
+    for (auto i = std::size_t{0}; i < 13; ++i)
+        CHECK(counts[i] == fractal::mandelbrot(points.x[i], points.y[i], 100));
+}
+
+TEST_CASE("precision_for picks the cheapest precision", "[fractal]")
+{
+    auto const float_limit  = (Float_t)1 / (1 << 14);
+    auto const double_limit = (Float_t)1 / (std::uint64_t{1} << 43);
+
+    CHECK(fractal::precision_for(0.05) == Precision::Float);
+    CHECK(fractal::precision_for(float_limit) == Precision::Float);
+    CHECK(fractal::precision_for(float_limit / 2) == Precision::Double);
+    CHECK(fractal::precision_for(double_limit) == Precision::Double);
+    CHECK(fractal::precision_for(double_limit / 2) == Precision::Long_double);
+}
+
+TEST_CASE("Each precision matches long double at its smallest pixel size",
+          "[fractal]")
+{
+    // 8 * color_count is the most iterations Tile_renderer uses, 128 with 16
+    // colors. Escape counts are chaotic on the boundary, so a few pixels may
+    // round differently, but not enough to show.
+    auto constexpr limit = 128u;
+    CHECK(mismatch_rate<float>((Float_t)1 / (1 << 14), limit) < 0.01);
+    CHECK(mismatch_rate<double>((Float_t)1 / (std::uint64_t{1} << 43), limit) <
+          0.01);
+}
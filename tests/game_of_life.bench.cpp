@@ -0,0 +1,213 @@
+#include <algorithm>
+#include <array>
+#include <cstddef>
+#include <iterator>
+#include <random>
+#include <utility>
+#include <vector>
+
+#include <catch2/catch.hpp>
+
+#include "../demos/game_of_life/bitset.hpp"
+#include "../demos/game_of_life/coordinate.hpp"
+#include "../demos/game_of_life/hashlife.hpp"
+#include "../demos/game_of_life/life_kernel.hpp"
+#include "../demos/game_of_life/pattern.hpp"
+#include "../demos/game_of_life/patterns.hpp"
+#include "../demos/game_of_life/rule.hpp"
+
+// Each run imports a pattern and steps it 100 generations, divide 100 by the
+// reported mean for generations per second. Volatile_list is the previous
+// Game_of_life_engine stepping: a Bitset of cells and a list of coordinates
+// that may change, single threaded. Hashlife runs step one generation at a
+// time, jump runs advance 2^10 generations at once.
+
+namespace {
+
+using namespace gol;
+
+auto constexpr generations = 100;
+
+class Volatile_list {
+   public:
+    explicit Volatile_list(Pattern const& p)
+    {
+        for (auto const c : p.cells) {
+            cells_.insert(c);
+            this->add_volatiles(c);
+        }
+    }
+
+   public:
+    void step(Rule const& rule)
+    {
+        std::sort(std::begin(volatiles_), std::end(volatiles_));
+        volatiles_.erase(
+            std::unique(std::begin(volatiles_), std::end(volatiles_)),
+            std::end(volatiles_));
+        auto diff = std::vector<std::pair<Coordinate, bool>>{};
+        auto next = std::vector<Coordinate>{};
+        for (auto const c : volatiles_) {
+            auto count = 0;
+            for (auto const n : neighbors(c))
+                count += cells_.contains(n) ? 1 : 0;
+            auto const is_alive = cells_.contains(c);
+            if (is_alive ? !rule.survival[count] : rule.birth[count]) {
+                diff.push_back({c, !is_alive});
+                add_volatiles(next, c);
+            }
+        }
+        for (auto const& [c, is_alive] : diff) {
+            if (is_alive)
+                cells_.insert(c);
+            else
+                cells_.remove(c);
+        }
+        volatiles_ = std::move(next);
+    }
+
+    [[nodiscard]] auto is_alive_at(Coordinate c) const -> bool
+    {
+        return cells_.contains(c);
+    }
+
+   private:
+    Bitset cells_;
+    std::vector<Coordinate> volatiles_;
+
+   private:
+    [[nodiscard]] static auto neighbors(Coordinate c)
+        -> std::array<Coordinate, 8>
+    {
+        return {Coordinate{c.x - 1, c.y - 1}, Coordinate{c.x, c.y - 1},
+                Coordinate{c.x + 1, c.y - 1}, Coordinate{c.x - 1, c.y},
+                Coordinate{c.x + 1, c.y},     Coordinate{c.x - 1, c.y + 1},
+                Coordinate{c.x, c.y + 1},     Coordinate{c.x + 1, c.y + 1}};
+    }
+
+    static void add_volatiles(std::vector<Coordinate>& v, Coordinate c)
+    {
+        auto constexpr bound = Life_kernel::outer_bound;
+        if (c.x > bound || c.x < -bound || c.y > bound || c.y < -bound)
+            return;
+        v.push_back(c);
+        for (auto const n : neighbors(c))
+            v.push_back(n);
+    }
+
+    void add_volatiles(Coordinate c) { add_volatiles(volatiles_, c); }
+};
+
+/// Random 512x512 soup, about a third of the cells alive.
+[[nodiscard]] auto soup() -> Pattern
+{
+    auto gen    = std::mt19937{512};
+    auto result = Pattern{{}, parse_rule_string("B3/S23")};
+    for (auto y = -256; y < 256; ++y) {
+        for (auto x = -256; x < 256; ++x) {
+            if (gen() % 3 == 0)
+                result.cells.push_back({x, y});
+        }
+    }
+    return result;
+}
+
+[[nodiscard]] auto run_volatile_list(Pattern const& p) -> bool
+{
+    auto life = Volatile_list{p};
+    for (auto i = 0; i < generations; ++i)
+        life.step(p.rule);
+    return life.is_alive_at({0, 0});
+}
+
+[[nodiscard]] auto run_life_kernel(Pattern const& p) -> bool
+{
+    auto life = Life_kernel{};
+    for (auto const c : p.cells)
+        life.set(c, true);
+    for (auto i = 0; i < generations; ++i)
+        life.step(p.rule);
+    return life.is_alive_at({0, 0});
+}
+
+[[nodiscard]] auto run_hashlife(Pattern const& p) -> bool
+{
+    auto life = Hashlife{};
+    for (auto const c : p.cells)
+        life.set(c, true);
+    for (auto i = 0; i < generations; ++i)
+        life.step(p.rule);
+    return life.is_alive_at({0, 0});
+}
+
+[[nodiscard]] auto run_hashlife_jump(Pattern const& p) -> bool
+{
+    auto life = Hashlife{};
+    for (auto const c : p.cells)
+        life.set(c, true);
+    life.jump(p.rule, 10);
+    return life.is_alive_at({0, 0});
+}
+
+}  // namespace
+
+TEST_CASE("Game of Life Breeder", "[Game_of_life][!benchmark]")
+{
+    BENCHMARK("Volatile_list breeder1 [100 generations]")
+    {
+        return run_volatile_list(pattern::breeder1);
+    };
+    BENCHMARK("Life_kernel breeder1 [100 generations]")
+    {
+        return run_life_kernel(pattern::breeder1);
+    };
+    BENCHMARK("Hashlife breeder1 [100 generations]")
+    {
+        return run_hashlife(pattern::breeder1);
+    };
+    BENCHMARK("Hashlife breeder1 [jump 1024 generations]")
+    {
+        return run_hashlife_jump(pattern::breeder1);
+    };
+}
+
+TEST_CASE("Game of Life Gun", "[Game_of_life][!benchmark]")
+{
+    BENCHMARK("Volatile_list gosper_glyder_gun [100 generations]")
+    {
+        return run_volatile_list(pattern::gosper_glyder_gun);
+    };
+    BENCHMARK("Life_kernel gosper_glyder_gun [100 generations]")
+    {
+        return run_life_kernel(pattern::gosper_glyder_gun);
+    };
+    BENCHMARK("Hashlife gosper_glyder_gun [100 generations]")
+    {
+        return run_hashlife(pattern::gosper_glyder_gun);
+    };
+    BENCHMARK("Hashlife gosper_glyder_gun [jump 1024 generations]")
+    {
+        return run_hashlife_jump(pattern::gosper_glyder_gun);
+    };
+}
+
+TEST_CASE("Game of Life Soup", "[Game_of_life][!benchmark]")
+{
+    auto const p = soup();
+    BENCHMARK("Volatile_list 512x512 soup [100 generations]")
+    {
+        return run_volatile_list(p);
+    };
+    BENCHMARK("Life_kernel 512x512 soup [100 generations]")
+    {
+        return run_life_kernel(p);
+    };
+    BENCHMARK("Hashlife 512x512 soup [100 generations]")
+    {
+        return run_hashlife(p);
+    };
+    BENCHMARK("Hashlife 512x512 soup [jump 1024 generations]")
+    {
+        return run_hashlife_jump(p);
+    };
+}
@@ -0,0 +1,65 @@
+#include <stdexcept>
+
+#include <catch2/catch.hpp>
+
+#include <termox/painter/color.hpp>
+#include <termox/painter/glyph.hpp>
+#include <termox/painter/glyph_matrix.hpp>
+#include <termox/painter/trait.hpp>
+
+TEST_CASE("Glyph_matrix: Contiguous Rows", "[Glyph_matrix]")
+{
+    auto m = ox::Glyph_matrix{{4, 3}};
+    REQUIRE(m.width() == 4);
+    REQUIRE(m.height() == 3);
+    CHECK(m.stride() == 4);
+    CHECK(m({3, 2}) == ox::Glyph{U'\0'});
+
+    m({1, 1}) = ox::Glyph{U'x', bg(ox::Color::Blue)};
+    CHECK(m.row(1).size() == 4);
+    CHECK(m.row(1)[1] == ox::Glyph{U'x', bg(ox::Color::Blue)});
+    CHECK(m.data() + m.stride() + 1 == &m({1, 1}));
+    CHECK_THROWS_AS(m.at({4, 0}), std::out_of_range);
+    CHECK_THROWS_AS(m.at({0, -1}), std::out_of_range);
+}
+
+TEST_CASE("Glyph_matrix: Resize Keeps Glyph Positions", "[Glyph_matrix]")
+{
+    auto m    = ox::Glyph_matrix{{4, 3}};
+    m({3, 2}) = ox::Glyph{U'a'};
+    m({1, 0}) = ox::Glyph{U'b', ox::Trait::Bold};
+
+    m.resize({6, 5});
+    CHECK(m.area() == ox::Area{6, 5});
+    CHECK(m({3, 2}) == ox::Glyph{U'a'});
+    CHECK(m({1, 0}) == ox::Glyph{U'b', ox::Trait::Bold});
+    CHECK(m({5, 4}) == ox::Glyph{U'\0'});
+
+    m.resize({2, 5});
+    CHECK(m({1, 0}) == ox::Glyph{U'b', ox::Trait::Bold});
+
+    m.resize({2, 1});
+    CHECK(m.height() == 1);
+    CHECK(m({1, 0}) == ox::Glyph{U'b', ox::Trait::Bold});
+
+    m.clear();
+    CHECK(m.width() == 0);
+    CHECK(m.height() == 0);
+}
+
+TEST_CASE("Glyph_matrix: Fill and Blit", "[Glyph_matrix]")
+{
+    auto dest = ox::Glyph_matrix{{5, 5}};
+    dest.fill(ox::Glyph{U'.'});
+    auto src = ox::Glyph_matrix{{3, 2}};
+    src.fill(ox::Glyph{U'#'});
+
+    dest.blit(src, {3, -1});
+    CHECK(dest({2, 0}) == ox::Glyph{U'.'});
+    CHECK(dest({3, 0}) == ox::Glyph{U'#'});
+    CHECK(dest({4, 0}) == ox::Glyph{U'#'});
+    CHECK(dest({3, 1}) == ox::Glyph{U'.'});
+
+    dest.blit(src, {-5, 0});
+    CHECK(dest({0, 0}) == ox::Glyph{U'.'});
+}
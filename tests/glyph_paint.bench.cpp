@@ -0,0 +1,214 @@
+#include <cwctype>
+#include <iterator>
+#include <map>
+#include <sstream>
+#include <string>
+
+#include <catch2/catch.hpp>
+
+#include <termox/common/u32_to_mb.hpp>
+#include <termox/painter/glyph.hpp>
+#include <termox/painter/glyph_string.hpp>
+#include <termox/system/event_queue.hpp>
+#include <termox/system/system.hpp>
+#include <termox/widget/area.hpp>
+#include <termox/widget/point.hpp>
+
+#include "../demos/glyph_paint/glyph_grid.hpp"
+#include "../demos/glyph_paint/paint_area.hpp"
+#include "current_queue.hpp"
+
+// Painting runs fill a 200x60 region one cell at a time, as a drag across the
+// canvas does, then erase every other cell. Traversal visits the painted cells
+// of that region, as paint_event() does. Export and import use a 400x4000 art
+// file, about 4.3MB of UTF-8. Ordered map is the previous Paint_area storage:
+// a std::map<Point, Glyph>, written one cell and u32_to_mb() call at a time and
+// read through a std::istream_iterator<char>.
+
+namespace {
+
+auto constexpr region = ox::Area{200, 60};
+auto constexpr art     = ox::Area{400, 4'000};
+
+/// Return true if the art file has a block character at \p p.
+[[nodiscard]] auto is_painted(ox::Point p) -> bool
+{
+    return (p.x + p.y) % 7 != 0;
+}
+
+/// Return the art file as UTF-8 text.
+[[nodiscard]] auto make_art() -> std::string
+{
+    auto result = std::string{};
+    for (auto y = 0; y < art.height; ++y) {
+        for (auto x = 0; x < art.width; ++x)
+            result.append(is_painted({x, y}) ? "█" : " ");
+        result.push_back('\n');
+    }
+    return result;
+}
+
+using Ordered_map = std::map<ox::Point, ox::Glyph>;
+
+/// Return the art file as an Ordered_map, read() would split each symbol into
+/// its UTF-8 bytes.
+[[nodiscard]] auto make_art_map() -> Ordered_map
+{
+    auto result = Ordered_map{};
+    for (auto y = 0; y < art.height; ++y) {
+        for (auto x = 0; x < art.width; ++x) {
+            if (is_painted({x, y}))
+                result[{x, y}] = ox::Glyph{U'█'};
+        }
+    }
+    return result;
+}
+
+void write(Ordered_map const& glyphs, std::ostream& os)
+{
+    auto previous_nl = ox::Point{0, 0};
+    auto previous_s  = ox::Point{0, -1};
+    for (auto const& [point, glyph] : glyphs) {
+        if (previous_nl.y < point.y)
+            os << std::string(point.y - previous_nl.y, '\n');
+        auto spaces_n = point.x;
+        if (previous_s.y == point.y)
+            spaces_n -= previous_s.x + 1;
+        os << std::string(spaces_n, ' ');
+        os << ox::u32_to_mb(glyph.symbol);
+        previous_nl = point;
+        previous_s  = point;
+    }
+}
+
+void read(Ordered_map& glyphs, std::istream& is)
+{
+    glyphs.clear();
+    auto at = ox::Point{0, 0};
+    is >> std::noskipws;
+    auto const text = ox::Glyph_string{std::istream_iterator<char>{is},
+                                       std::istream_iterator<char>()};
+    for (auto const& glyph : text) {
+        if (!std::iswspace(glyph.symbol))
+            glyphs[at] = glyph;
+        ++at.x;
+        if (glyph.symbol == U'\n') {
+            ++at.y;
+            at.x = 0;
+        }
+    }
+}
+
+}  // namespace
+
+TEST_CASE("Glyph_paint painting", "[glyph_paint]")
+{
+    BENCHMARK("Ordered map")
+    {
+        auto glyphs = Ordered_map{};
+        for (auto y = 0; y < region.height; ++y) {
+            for (auto x = 0; x < region.width; ++x)
+                glyphs[{x, y}] = ox::Glyph{U'█'};
+        }
+        for (auto y = 0; y < region.height; ++y) {
+            for (auto x = y % 2; x < region.width; x += 2)
+                glyphs.erase({x, y});
+        }
+        return glyphs.size();
+    };
+
+    BENCHMARK("Glyph_grid")
+    {
+        auto glyphs = paint::Glyph_grid{};
+        for (auto y = 0; y < region.height; ++y) {
+            for (auto x = 0; x < region.width; ++x)
+                glyphs.set({x, y}, ox::Glyph{U'█'});
+        }
+        for (auto y = 0; y < region.height; ++y) {
+            for (auto x = y % 2; x < region.width; x += 2)
+                glyphs.erase({x, y});
+        }
+        return glyphs.find({1, 0}) != nullptr;
+    };
+}
+
+TEST_CASE("Glyph_paint traversal", "[glyph_paint]")
+{
+    auto map  = Ordered_map{};
+    auto grid = paint::Glyph_grid{};
+    for (auto y = 0; y < region.height; ++y) {
+        for (auto x = y % 2; x < region.width; x += 2) {
+            map[{x, y}] = ox::Glyph{U'█'};
+            grid.set({x, y}, ox::Glyph{U'█'});
+        }
+    }
+
+    BENCHMARK("Ordered map")
+    {
+        auto sum = char32_t{0};
+        for (auto const& [at, glyph] : map) {
+            if (at.x < region.width && at.y < region.height)
+                sum += glyph.symbol;
+        }
+        return sum;
+    };
+
+    BENCHMARK("Glyph_grid")
+    {
+        auto sum = char32_t{0};
+        grid.for_each_within(region, [&sum](ox::Point, ox::Glyph const& g) {
+            sum += g.symbol;
+        });
+        return sum;
+    };
+}
+
+TEST_CASE("Glyph_paint export", "[glyph_paint]")
+{
+    auto const map = make_art_map();
+    BENCHMARK("Ordered map")
+    {
+        auto os = std::ostringstream{};
+        write(map, os);
+        return os.str().size();
+    };
+
+    // Collects events posted by Paint_area, they are discarded unsent.
+    auto queue         = ox::Event_queue{};
+    auto const current = ox::test::Current_queue{queue};
+    auto canvas        = paint::Paint_area{};
+    {
+        auto is = std::istringstream{make_art()};
+        canvas.read(is);
+    }
+    BENCHMARK("Paint_area")
+    {
+        auto os = std::ostringstream{};
+        canvas.write(os);
+        return os.str().size();
+    };
+}
+
+TEST_CASE("Glyph_paint import", "[glyph_paint]")
+{
+    auto const text = make_art();
+
+    BENCHMARK("Ordered map")
+    {
+        auto map = Ordered_map{};
+        auto is  = std::istringstream{text};
+        read(map, is);
+        return map.size();
+    };
+
+    // Collects events posted by Paint_area, they are discarded unsent.
+    auto queue         = ox::Event_queue{};
+    auto const current = ox::test::Current_queue{queue};
+    auto canvas        = paint::Paint_area{};
+    BENCHMARK("Paint_area")
+    {
+        auto is = std::istringstream{text};
+        canvas.read(is);
+        return is.eof();
+    };
+}
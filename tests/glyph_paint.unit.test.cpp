@@ -0,0 +1,150 @@
+#include <map>
+#include <random>
+#include <sstream>
+#include <string>
+
+#include <catch2/catch.hpp>
+
+#include <termox/common/utf8.hpp>
+#include <termox/painter/glyph.hpp>
+#include <termox/system/event_queue.hpp>
+#include <termox/widget/point.hpp>
+
+#include "../demos/glyph_paint/glyph_grid.hpp"
+#include "../demos/glyph_paint/paint_area.hpp"
+#include "current_queue.hpp"
+
+using paint::Glyph_grid;
+
+namespace {
+
+using Cells = std::map<ox::Point, char32_t>;
+
+auto constexpr chunk_width  = Glyph_grid::chunk_width;
+auto constexpr chunk_height = Glyph_grid::chunk_height;
+
+/// Return \p cells as text, one line per row and a space for each empty cell.
+/** The format Paint_area::write() produces, no trailing spaces or newline. */
+[[nodiscard]] auto to_text(Cells const& cells) -> std::string
+{
+    auto result = std::string{};
+    auto at     = ox::Point{0, 0};
+    for (auto const& [point, symbol] : cells) {
+        if (point.y > at.y) {
+            result.append(point.y - at.y, '\n');
+            at = {0, point.y};
+        }
+        result.append(point.x - at.x, ' ');
+        char bytes[4];
+        result.append(bytes, ox::utf8_encode(symbol, bytes));
+        at.x = point.x + 1;
+    }
+    return result;
+}
+
+/// Cells on both sides of chunk borders, wide and multi-byte symbols, a row
+/// with nothing painted and a chunk left empty between painted chunks.
+[[nodiscard]] auto make_cells() -> Cells
+{
+    auto const symbols = std::u32string{U"x#█🙂漢é"};
+    auto gen           = std::mt19937{50};
+    auto result        = Cells{};
+    auto const paint   = [&](int x, int y) {
+        result[{x, y}] = symbols[gen() % symbols.size()];
+    };
+    for (auto const y : {0, chunk_height - 1, chunk_height, 2 * chunk_height}) {
+        for (auto const x : {0, 1, chunk_width - 1, chunk_width,
+                             2 * chunk_width - 1, 4 * chunk_width + 3})
+            paint(x, y);
+    }
+    for (auto y = chunk_height + 1; y < 2 * chunk_height; ++y) {
+        if (y == chunk_height + 5)
+            continue;
+        for (auto x = 0; x < 3 * chunk_width; ++x) {
+            if (gen() % 4 == 0)
+                paint(x, y);
+        }
+    }
+    return result;
+}
+
+[[nodiscard]] auto written(paint::Paint_area& canvas) -> std::string
+{
+    auto os = std::ostringstream{};
+    canvas.write(os);
+    return os.str();
+}
+
+void read(paint::Paint_area& canvas, std::string const& text)
+{
+    auto is = std::istringstream{text};
+    canvas.read(is);
+}
+
+}  // namespace
+
+TEST_CASE("Glyph_grid finds cells across chunk borders", "[glyph_paint]")
+{
+    auto const cells = make_cells();
+    auto grid        = Glyph_grid{};
+    for (auto const& [point, symbol] : cells)
+        grid.set(point, ox::Glyph{symbol});
+    CHECK(grid.height() == 3 * chunk_height);
+
+    auto visited = Cells{};
+    grid.for_each_within({5 * chunk_width, 3 * chunk_height},
+                         [&](ox::Point p, ox::Glyph const& g) {
+                             visited[p] = g.symbol;
+                         });
+    CHECK(visited == cells);
+
+    for (auto y = 0; y < grid.height(); ++y) {
+        auto previous = -1;
+        grid.for_each_in_row(y, [&](int x, ox::Glyph const& g) {
+            CHECK(x > previous);
+            CHECK(cells.at({x, y}) == g.symbol);
+            previous = x;
+        });
+    }
+
+    grid.erase({chunk_width, chunk_height});
+    grid.erase({chunk_width + 1, chunk_height});
+    CHECK(grid.find({chunk_width, chunk_height}) == nullptr);
+    CHECK(grid.find({chunk_width - 1, chunk_height}) != nullptr);
+    CHECK(grid.find({3 * chunk_width, 0}) == nullptr);
+
+    grid.set({-1, 0}, ox::Glyph{U'x'});
+    CHECK(grid.find({-1, 0}) == nullptr);
+}
+
+TEST_CASE("Paint_area write and read round trip", "[glyph_paint]")
+{
+    auto queue         = ox::Event_queue{};
+    auto const current = ox::test::Current_queue{queue};
+    auto const text    = to_text(make_cells());
+
+    auto canvas = paint::Paint_area{};
+    read(canvas, text);
+    CHECK(written(canvas) == text);
+
+    auto copy = paint::Paint_area{};
+    read(copy, written(canvas));
+    CHECK(written(copy) == text);
+
+    // Leading empty rows and trailing whitespace are kept and dropped.
+    read(canvas, "\n\n  a  \t\n\n b\n\n");
+    CHECK(written(canvas) == "\n\n  a\n\n b");
+
+    read(canvas, "");
+    CHECK(written(canvas).empty());
+}
+
+TEST_CASE("Paint_area reads a row that is not UTF-8 as Latin-1",
+          "[glyph_paint]")
+{
+    auto queue         = ox::Event_queue{};
+    auto const current = ox::test::Current_queue{queue};
+    auto canvas        = paint::Paint_area{};
+    read(canvas, "caf\xE9\n漢 x");
+    CHECK(written(canvas) == "café\n漢 x");
+}
@@ -0,0 +1,90 @@
+#include <algorithm>
+#include <cstddef>
+#include <random>
+#include <string>
+#include <vector>
+
+#include <catch2/catch.hpp>
+
+#include <termox/painter/painter.hpp>
+#include <termox/terminal/detail/canvas.hpp>
+#include <termox/widget/area.hpp>
+#include <termox/widget/boundary.hpp>
+#include <termox/widget/widgets/graph.hpp>
+
+// Each Graph covers a 200x50 screen. Rebuild runs map every point onto the
+// cell grid, as after a resize or a new Boundary. Repaint runs reuse the bins
+// and only touch the cells, append runs add 1000 points and repaint.
+
+namespace {
+
+auto constexpr screen = ox::Area{200, 50};
+
+using Coordinate = ox::Graph<double>::Coordinate;
+
+struct Paintable : ox::Graph<double> {
+    using Graph::Graph;
+    using Graph::paint_event;
+};
+
+/// Sampled random walk, the shape of a long time series.
+[[nodiscard]] auto time_series(std::size_t count) -> std::vector<Coordinate>
+{
+    auto gen    = std::mt19937{count};
+    auto step   = std::normal_distribution<double>{0., 0.001};
+    auto result = std::vector<Coordinate>{};
+    result.reserve(count);
+    auto y = 0.;
+    for (auto i = std::size_t{0}; i < count; ++i) {
+        y = std::clamp(y + step(gen), -1., 1.);
+        result.push_back({(double)i / count, y});
+    }
+    return result;
+}
+
+void paint(Paintable& g, ox::detail::Canvas& canvas)
+{
+    auto p = ox::Painter{g, canvas};
+    g.paint_event(p);
+}
+
+void run(std::size_t count)
+{
+    auto const boundary = ox::Boundary<double>{0., 1., 1., -1.};
+    auto const zoomed   = ox::Boundary<double>{0., 1., 1.5, -1.5};
+    auto canvas         = ox::detail::Canvas{screen};
+    auto g              = Paintable{boundary, time_series(count)};
+    g.set_area(screen);
+    g.set_top_left({0, 0});
+
+    auto const label = " [" + std::to_string(count) + " points]";
+    auto flip        = false;
+    BENCHMARK("Graph rebuild" + label)
+    {
+        flip = !flip;
+        g.set_boundary(flip ? zoomed : boundary);
+        paint(g, canvas);
+        return canvas.at({0, 25});
+    };
+
+    paint(g, canvas);
+    BENCHMARK("Graph repaint" + label)
+    {
+        paint(g, canvas);
+        return canvas.at({0, 25});
+    };
+
+    auto const more = time_series(1'000);
+    BENCHMARK("Graph append 1000 and repaint" + label)
+    {
+        g.add(std::cbegin(more), std::cend(more));
+        paint(g, canvas);
+        return canvas.at({0, 25});
+    };
+}
+
+}  // namespace
+
+TEST_CASE("Graph 1M Points", "[Graph][!benchmark]") { run(1'000'000); }
+
+TEST_CASE("Graph 10M Points", "[Graph][!benchmark]") { run(10'000'000); }
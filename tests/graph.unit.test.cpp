@@ -0,0 +1,231 @@
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <iterator>
+#include <random>
+#include <thread>
+#include <utility>
+#include <vector>
+
+#include <catch2/catch.hpp>
+
+#include <termox/painter/color.hpp>
+#include <termox/painter/glyph.hpp>
+#include <termox/painter/painter.hpp>
+#include <termox/terminal/detail/canvas.hpp>
+#include <termox/widget/area.hpp>
+#include <termox/widget/boundary.hpp>
+#include <termox/widget/widgets/graph.hpp>
+
+namespace {
+
+template <typename Graph_t>
+struct Paintable : Graph_t {
+    using Graph_t::Graph_t;
+    using Graph_t::paint_event;
+};
+
+using Braille_graph = Paintable<ox::Graph<double>>;
+using Half_graph    = Paintable<ox::Color_graph<double>>;
+using Stream_graph  = Paintable<ox::Streaming_graph<double>>;
+
+/// Return the Canvas painted by \p g's paint_event.
+template <typename Graph_t>
+[[nodiscard]] auto paint(Graph_t& g) -> ox::detail::Canvas
+{
+    auto canvas = ox::detail::Canvas{g.area()};
+    auto p      = ox::Painter{g, canvas};
+    g.paint_event(p);
+    return canvas;
+}
+
+/// Return the Canvas with only the wallpaper of \p w painted.
+[[nodiscard]] auto wallpaper(ox::Widget& w) -> ox::detail::Canvas
+{
+    auto canvas = ox::detail::Canvas{w.area()};
+    ox::Painter{w, canvas};  // Constructor paints the wallpaper.
+    return canvas;
+}
+
+/// Cell offsets of \p c within \p g, false if \p c is outside of the Graph.
+template <typename Graph_t, typename Coordinate>
+[[nodiscard]] auto offsets(Graph_t const& g, Coordinate c)
+    -> std::pair<bool, std::pair<double, double>>
+{
+    auto const a = g.area();
+    auto const b = g.boundary();
+    auto const h = a.width / (b.east - b.west) * (c.x - b.west);
+    auto const v = a.height - a.height / (b.north - b.south) * (c.y - b.south);
+    auto const is_in = h >= 0 && h < a.width && v >= 0 && v < a.height;
+    return {is_in, {h, v}};
+}
+
+/// One point at a time, as Graph::paint_event did before binning.
+[[nodiscard]] auto reference(Braille_graph& g) -> ox::detail::Canvas
+{
+    auto canvas = wallpaper(g);
+    for (auto const c : g.coordinates()) {
+        auto const [is_in, hv] = offsets(g, c);
+        if (!is_in)
+            continue;
+        auto const [h, v] = hv;
+        auto const dx     = h - std::floor(h) < 0.5 ? 0 : 1;
+        auto const dy     = (int)((v - std::floor(v)) * 4);
+        auto const bits =
+            static_cast<std::uint8_t>(dy == 3 ? 0b0100'0000 << dx
+                                              : 1 << (dy + 3 * dx));
+        canvas.at({(int)h, (int)v}).symbol |= bits;
+    }
+    return canvas;
+}
+
+/// One point at a time, as Color_graph::paint_event did before binning.
+[[nodiscard]] auto reference(Half_graph& g) -> ox::detail::Canvas
+{
+    auto canvas = wallpaper(g);
+    for (auto const& [c, color] : g.coordinates()) {
+        auto const [is_in, hv] = offsets(g, c);
+        if (!is_in)
+            continue;
+        auto const [h, v] = hv;
+        auto& glyph       = canvas.at({(int)h, (int)v});
+        if (glyph.symbol == U' ')
+            glyph = U'▀' | fg(ox::Color::Background);
+        if (v - std::floor(v) < 0.5)
+            glyph |= fg(color);
+        else
+            glyph |= bg(color);
+    }
+    return canvas;
+}
+
+[[nodiscard]] auto is_same(ox::detail::Canvas const& a,
+                           ox::detail::Canvas const& b) -> bool
+{
+    return a.area() == b.area() &&
+           std::equal(std::cbegin(a), std::cend(a), std::cbegin(b));
+}
+
+auto gen = std::mt19937{7};
+
+[[nodiscard]] auto random_points(std::size_t count)
+    -> std::vector<ox::Graph<double>::Coordinate>
+{
+    // Some points land outside of the Boundary.
+    auto dist   = std::uniform_real_distribution<double>{-1.2, 1.2};
+    auto result = std::vector<ox::Graph<double>::Coordinate>{};
+    for (auto i = std::size_t{0}; i < count; ++i)
+        result.push_back({dist(gen), dist(gen)});
+    return result;
+}
+
+[[nodiscard]] auto random_colored_points(std::size_t count)
+    -> std::vector<std::pair<ox::Color_graph<double>::Coordinate, ox::Color>>
+{
+    auto color  = std::uniform_int_distribution<int>{0, 15};
+    auto result = std::vector<
+        std::pair<ox::Color_graph<double>::Coordinate, ox::Color>>{};
+    for (auto const c : random_points(count))
+        result.push_back({{c.x, c.y}, ox::Color(color(gen))});
+    return result;
+}
+
+}  // namespace
+
+TEST_CASE("Graph binning matches point by point painting", "[Graph]")
+{
+    auto g = Braille_graph{{-1, 1, 1, -1}, random_points(500)};
+    g.set_area({30, 10});
+    CHECK_FALSE(is_same(paint(g), wallpaper(g)));
+    CHECK(is_same(paint(g), reference(g)));
+
+    SECTION("appended points update their cells")
+    {
+        for (auto const c : random_points(100))
+            g.add(c);
+        auto const more = random_points(100);
+        g.add(std::cbegin(more), std::cend(more));
+        CHECK(g.coordinates().size() == 700);
+        CHECK(is_same(paint(g), reference(g)));
+    }
+
+    SECTION("resize, new boundary and reset rebuild the bins")
+    {
+        g.set_area({17, 23});
+        CHECK(is_same(paint(g), reference(g)));
+        g.set_boundary({-0.5, 0.25, 1, 0});
+        CHECK(is_same(paint(g), reference(g)));
+        g.reset(random_points(50));
+        CHECK(is_same(paint(g), reference(g)));
+        g.clear();
+        CHECK(is_same(paint(g), wallpaper(g)));
+    }
+}
+
+TEST_CASE("Color_graph binning keeps the last Color per half", "[Graph]")
+{
+    auto g = Half_graph{{-1, 1, 1, -1}, random_colored_points(500)};
+    g.set_area({20, 8});
+    CHECK(is_same(paint(g), reference(g)));
+
+    for (auto const& p : random_colored_points(300))
+        g.add(p);
+    CHECK(is_same(paint(g), reference(g)));
+
+    g.set_area({41, 3});
+    CHECK(is_same(paint(g), reference(g)));
+    g.reset(random_colored_points(10));
+    CHECK(is_same(paint(g), reference(g)));
+}
+
+TEST_CASE("Streaming_graph keeps a sliding window", "[Graph]")
+{
+    using Coordinate = Stream_graph::Coordinate;
+    auto g           = Stream_graph{4, -1., 1.};
+    auto samples     = std::vector<Coordinate>{};
+    for (auto i = 0; i < 6; ++i)
+        samples.push_back({(double)i, i % 2 == 0 ? -0.9 : 0.9});
+
+    g.append(ox::Span<Coordinate const>{samples}.first(3));
+    CHECK(g.size() == 0);
+    g.flush();
+    REQUIRE(g.size() == 3);
+    CHECK(g.at(0).x == 0.);
+    CHECK(g.boundary().east == 2.);
+
+    g.append(ox::Span<Coordinate const>{samples}.last(3));
+    g.flush();
+    REQUIRE(g.size() == 4);
+    for (auto i = std::size_t{0}; i < g.size(); ++i)
+        CHECK(g.at(i).x == i + 2.);
+    CHECK(g.boundary().west == 2.);
+    CHECK(g.boundary().east == 5.);
+
+    // Oldest sample low in the first column, newest high in the last.
+    g.set_area({4, 2});
+    auto const canvas = paint(g);
+    CHECK(canvas.at({0, 1}).symbol != U'⠀');
+    CHECK(canvas.at({3, 0}).symbol == (U'⠀' | 0b0000'1000));
+    CHECK(canvas.at({3, 1}).symbol == U'⠀');
+
+    g.clear();
+    CHECK(g.size() == 0);
+    CHECK(is_same(paint(g), wallpaper(g)));
+}
+
+TEST_CASE("Streaming_graph accepts batches from another thread", "[Graph]")
+{
+    using Coordinate = Stream_graph::Coordinate;
+    auto g           = Stream_graph{100};
+    auto producer    = std::thread{[&g] {
+        for (auto i = 0; i < 1'000; ++i) {
+            auto const batch = std::vector<Coordinate>{{(double)i, 0.5}};
+            g.append(batch);
+        }
+    }};
+    producer.join();
+    g.flush();
+    REQUIRE(g.size() == 100);
+    CHECK(g.at(0).x == 900.);
+    CHECK(g.at(99).x == 999.);
+}
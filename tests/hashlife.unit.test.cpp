@@ -0,0 +1,122 @@
+#include "../demos/game_of_life/hashlife.hpp"
+
+#include <set>
+#include <stdexcept>
+#include <vector>
+
+#include <catch2/catch.hpp>
+
+#include "../demos/game_of_life/coordinate.hpp"
+#include "../demos/game_of_life/life_kernel.hpp"
+#include "../demos/game_of_life/rule.hpp"
+#include "life_reference.hpp"
+
+using gol::Coordinate;
+using gol::Hashlife;
+using gol::test::alive_cells;
+
+namespace {
+
+auto const life = gol::parse_rule_string("B3/S23");
+
+// Moves one cell south east every four generations.
+auto const glider = std::vector<Coordinate>{
+    {1, 0}, {2, 1}, {0, 2}, {1, 2}, {2, 2}};
+
+// Stabilizes at generation 1103 with 116 cells, including six gliders.
+auto const r_pentomino = std::vector<Coordinate>{
+    {1, 0}, {2, 0}, {0, 1}, {1, 1}, {1, 2}};
+
+[[nodiscard]] auto make_hashlife(std::vector<Coordinate> const& cells)
+    -> Hashlife
+{
+    auto result = Hashlife{};
+    for (auto const c : cells)
+        result.set(c, true);
+    return result;
+}
+
+}  // namespace
+
+TEST_CASE("Hashlife jump of 2^k equals 2^k single steps", "[Hashlife]")
+{
+    auto const k = GENERATE(range(0, 8));
+    INFO("k = " << k);
+
+    auto jumped = make_hashlife(r_pentomino);
+    jumped.jump(life, k);
+
+    auto stepped   = make_hashlife(r_pentomino);
+    auto reference = gol::test::Life_reference{};
+    for (auto const c : r_pentomino)
+        reference.set(c);
+    for (auto i = 0; i < (1 << k); ++i) {
+        stepped.step(life);
+        reference.step(life);
+    }
+
+    CHECK(alive_cells(jumped) == reference.cells());
+    CHECK(alive_cells(stepped) == reference.cells());
+    CHECK(jumped.population() == reference.cells().size());
+}
+
+TEST_CASE("Hashlife jump moves a glider", "[Hashlife]")
+{
+    auto const k = GENERATE(range(2, 12));
+    INFO("k = " << k);
+
+    auto hashlife = make_hashlife(glider);
+    hashlife.jump(life, k);
+
+    auto const distance = 1 << (k - 2);
+    auto expected       = std::vector<Coordinate>{};
+    for (auto const c : glider)
+        expected.push_back({c.x + distance, c.y + distance});
+    CHECK(alive_cells(hashlife) ==
+          std::set<Coordinate>(expected.begin(), expected.end()));
+}
+
+TEST_CASE("Hashlife jumps the R-pentomino to its final population",
+          "[Hashlife]")
+{
+    auto hashlife = make_hashlife(r_pentomino);
+
+    // 1103 = 1024 + 64 + 8 + 4 + 2 + 1
+    for (auto const k : {10, 6, 3, 2, 1, 0})
+        hashlife.jump(life, k);
+    CHECK(hashlife.population() == 116);
+
+    auto kernel = gol::Life_kernel{};
+    for (auto const c : r_pentomino)
+        kernel.set(c, true);
+    for (auto i = 0; i < 1103; ++i)
+        kernel.step(life);
+    CHECK(alive_cells(hashlife) == alive_cells(kernel));
+
+    hashlife.jump(life, 4);
+    CHECK(hashlife.population() == 116);
+}
+
+TEST_CASE("Hashlife world stops growing at max_level", "[Hashlife]")
+{
+    // Bounded patterns can jump the maximum any number of times.
+    auto blinker = make_hashlife({{0, 0}, {1, 0}, {2, 0}});
+    for (auto i = 0; i < 8; ++i)
+        blinker.jump(life, 60);
+    CHECK(alive_cells(blinker) ==
+          std::set<Coordinate>{{0, 0}, {1, 0}, {2, 0}});
+
+    // A glider moves 2^58 cells each jump and eventually leaves the world.
+    auto hashlife = make_hashlife(glider);
+    auto jumps    = 0;
+    CHECK_THROWS_AS(
+        [&] {
+            for (; jumps < 8; ++jumps)
+                hashlife.jump(life, 60);
+        }(),
+        std::length_error);
+    CHECK(jumps == 4);
+    CHECK(hashlife.population() == 5);
+    CHECK_THROWS_AS(hashlife.step(life), std::length_error);
+    CHECK(hashlife.population() == 5);
+}
@@ -0,0 +1,170 @@
+#include <termox/terminal/headless_backend.hpp>
+
+#include <clocale>
+#include <memory>
+#include <string>
+#include <utility>
+#include <variant>
+
+#include <catch2/catch.hpp>
+
+#include <esc/event.hpp>
+
+#include <termox/painter/color.hpp>
+#include <termox/painter/glyph.hpp>
+#include <termox/painter/trait.hpp>
+#include <termox/system/event.hpp>
+#include <termox/system/key.hpp>
+#include <termox/terminal/terminal.hpp>
+#include <termox/terminal/terminal_backend.hpp>
+
+using ox::Emulated_color;
+using ox::Headless_backend;
+using ox::Trait;
+
+TEST_CASE("Headless_backend places text at the cursor", "[Headless_backend]")
+{
+    auto hb = Headless_backend{{10, 3}};
+    hb.write("\x1B[2;3Hab");
+    CHECK(hb.row_text(1) == "  ab      ");
+    CHECK(hb.cursor() == ox::Point{4, 1});
+
+    SECTION("and wraps at the right edge")
+    {
+        hb.write("\x1B[1;9Hxyz");
+        CHECK(hb.row_text(0) == "        xy");
+        CHECK(hb.row_text(1) == "z ab      ");
+    }
+
+    SECTION("with sequences and UTF8 split across writes")
+    {
+        hb.write("\x1B[3");
+        hb.write(";1H\xE2\x96");
+        hb.write("\x80!");
+        CHECK(hb.row_text(2) == "▀!        ");
+        CHECK(hb.cell({0, 2}).symbol == U'▀');
+    }
+
+    SECTION("and skips escape sequences it does not model")
+    {
+        hb.write("\x1B]4;1;rgb:ff/00/00\x1B\\\x1B[?1049h\x1B[1;1Hq");
+        CHECK(hb.row_text(0) == "q         ");
+    }
+}
+
+TEST_CASE("Headless_backend applies SGR to written cells", "[Headless_backend]")
+{
+    auto hb = Headless_backend{{8, 1}};
+    hb.write("\x1B[1;3;38;5;200;48;2;1;2;3ma\x1B[22;39mb\x1B[0mc\x1B[31;102md");
+
+    auto const a = hb.cell({0, 0});
+    CHECK(a.traits.contains(Trait::Bold));
+    CHECK(a.traits.contains(Trait::Italic));
+    CHECK(a.foreground.kind == Emulated_color::Kind::Index);
+    CHECK(a.foreground.index == 200);
+    CHECK(a.background.kind == Emulated_color::Kind::RGB);
+    CHECK(a.background.red == 1);
+    CHECK(a.background.green == 2);
+    CHECK(a.background.blue == 3);
+
+    auto const b = hb.cell({1, 0});
+    CHECK(!b.traits.contains(Trait::Bold));
+    CHECK(b.traits.contains(Trait::Italic));
+    CHECK(b.foreground == Emulated_color{});
+    CHECK(b.background == a.background);
+
+    auto const c = hb.cell({2, 0});
+    CHECK(c.traits == ox::Traits{Trait::None});
+    CHECK(c.background == Emulated_color{});
+
+    auto const d = hb.cell({3, 0});
+    CHECK(d.foreground.index == 1);
+    CHECK(d.background.index == 10);
+}
+
+TEST_CASE("Headless_backend records output and cursor state",
+          "[Headless_backend]")
+{
+    auto hb = Headless_backend{{4, 2}};
+    hb.write("\x1B[?25l");
+    hb.flush();
+    CHECK(!hb.is_cursor_visible());
+    hb.show_cursor(true);
+    CHECK(hb.is_cursor_visible());
+    hb.write("xy");
+    CHECK(hb.bytes_written() == 8);
+    CHECK(hb.flush_count() == 1);
+    CHECK(hb.take_output() == "\x1B[?25lxy");
+    CHECK(hb.take_output().empty());
+    CHECK(hb.bytes_written() == 8);
+
+    hb.write("z");
+    hb.clear_output();
+    CHECK(hb.take_output().empty());
+    CHECK(hb.bytes_written() == 9);
+    CHECK(hb.row_text(0) == "xyz ");
+}
+
+TEST_CASE("Headless_backend reads scripted input", "[Headless_backend]")
+{
+    auto hb = Headless_backend{{4, 2}};
+    hb.write("ab\x1B[2;1Hcd");
+    hb.push_input(::esc::Key_press{ox::Key::Arrow_up});
+    hb.resize({3, 3});
+    CHECK(hb.pending_input() == 2);
+
+    auto const key = hb.read();
+    REQUIRE(std::holds_alternative<::esc::Key_press>(key));
+    CHECK(std::get<::esc::Key_press>(key).key == ox::Key::Arrow_up);
+
+    auto const resize = hb.read();
+    REQUIRE(std::holds_alternative<::esc::Window_resize>(resize));
+    CHECK(std::get<::esc::Window_resize>(resize).new_dimensions ==
+          ox::Area{3, 3});
+    CHECK(hb.pending_input() == 0);
+
+    CHECK(hb.area() == ox::Area{3, 3});
+    CHECK(hb.row_text(0) == "ab ");
+    CHECK(hb.row_text(1) == "cd ");
+    CHECK(hb.row_text(2) == "   ");
+}
+
+TEST_CASE("Terminal writes through a Headless_backend", "[Headless_backend]")
+{
+    std::setlocale(LC_ALL, "en_US.UTF-8");
+    auto owned   = std::make_unique<Headless_backend>(ox::Area{6, 2});
+    auto& screen = *owned;
+    ox::Terminal::handle_signint(false);
+    ox::Terminal::set_backend(std::move(owned));
+    ox::Terminal::initialize();
+    CHECK(screen.is_initialized());
+    CHECK(ox::Terminal::area() == ox::Area{6, 2});
+    CHECK_THROWS_AS(
+        ox::Terminal::set_backend(std::make_unique<ox::Tty_backend>()),
+        std::logic_error);
+
+    ox::Terminal::screen_buffers.next.at({1, 1}) = U'h' | Trait::Bold;
+    ox::Terminal::screen_buffers.next.at({2, 1}) = U'i';
+    ox::Terminal::refresh();
+    CHECK(screen.row_text(1) == " hi   ");
+    CHECK(screen.cell({1, 1}).traits.contains(Trait::Bold));
+    CHECK(screen.flush_count() == 1);
+
+    // Unchanged cells are not written again.
+    auto const bytes = screen.bytes_written();
+    ox::Terminal::screen_buffers.next.at({1, 1}) = U'h' | Trait::Bold;
+    ox::Terminal::screen_buffers.next.at({2, 1}) = U'i';
+    ox::Terminal::refresh();
+    CHECK(screen.bytes_written() == bytes);
+
+    // Invalid code points are written as U+FFFD instead of throwing.
+    ox::Terminal::screen_buffers.next.at({0, 0}) = char32_t{0xD800};
+    ox::Terminal::screen_buffers.next.at({1, 0}) = char32_t{0x110000};
+    CHECK_NOTHROW(ox::Terminal::refresh());
+    CHECK(screen.row_text(0) == "\uFFFD\uFFFD    ");
+
+    ox::Terminal::uninitialize();
+    CHECK(!screen.is_initialized());
+    ox::Terminal::set_backend(std::make_unique<ox::Tty_backend>());
+    ox::Terminal::handle_signint(true);
+}
@@ -0,0 +1,129 @@
+#include <array>
+#include <cmath>
+#include <memory>
+
+#include <catch2/catch.hpp>
+
+#include <termox/system/event.hpp>
+#include <termox/system/event_queue.hpp>
+#include <termox/system/system.hpp>
+#include <termox/widget/area.hpp>
+#include <termox/widget/layouts/detail/shared_space.hpp>
+#include <termox/widget/layouts/horizontal.hpp>
+#include <termox/widget/layouts/vertical.hpp>
+#include <termox/widget/size_policy.hpp>
+#include <termox/widget/widget.hpp>
+
+#include "current_queue.hpp"
+
+// Benchmark names include the number of Widgets in the tree. Each run sends a
+// single Resize_event to the root, alternating between two terminal sizes, and
+// includes laying out every nested layout in the tree.
+
+namespace {
+
+/// Build alternating Vertical/Horizontal layouts \p depth levels deep.
+/** Each layout has \p fanout children, the last level holds plain Widgets. */
+[[nodiscard]] auto make_tree(int depth, int fanout, bool vertical = true)
+    -> std::unique_ptr<ox::Widget>
+{
+    if (depth == 0)
+        return std::make_unique<ox::Widget>();
+    auto build = [&](auto& layout) {
+        for (auto i = 0; i < fanout; ++i)
+            layout.append_child(make_tree(depth - 1, fanout, !vertical));
+    };
+    if (vertical) {
+        auto v = ox::layout::vertical();
+        build(*v);
+        return v;
+    }
+    auto h = ox::layout::horizontal();
+    build(*h);
+    return h;
+}
+
+/// Send alternating Resize_events to \p root, \p i selects the size.
+auto resize(ox::Widget& root, int i) -> bool
+{
+    auto constexpr sizes = std::array{ox::Area{400, 200}, ox::Area{380, 190}};
+    return ox::System::send_event(ox::Resize_event{root, sizes[i % 2]});
+}
+
+/// Horizontal layout of \p count children with tight max lengths.
+/** Stretch is heavily skewed, so children reach their max a few at a time,
+ *  over many rounds of the distribution. */
+[[nodiscard]] auto make_tight_layout(int count)
+    -> std::unique_ptr<ox::layout::Horizontal<>>
+{
+    auto layout = ox::layout::horizontal();
+    auto total  = 0;
+    for (auto i = 0; i < count; ++i) {
+        auto& child = layout->make_child();
+        auto const max = 1 + i % 3;
+        child.width_policy =
+            ox::Size_policy{0, 0, max, std::pow(1.5, i % 300), true};
+        total += max;
+    }
+    layout->set_area({total - count / 4, 1});
+    return layout;
+}
+
+}  // namespace
+
+TEST_CASE("Shared_space Scaling", "[Layout][!benchmark]")
+{
+    using Parameters = ox::layout::h_detail::Horizontal_parameters;
+    auto space       = ox::layout::detail::Shared_space<Parameters>{};
+
+    auto const l10 = make_tight_layout(10);
+    BENCHMARK("calculate_lengths [10 children]")
+    {
+        return space.calculate_lengths(*l10);
+    };
+
+    auto const l100 = make_tight_layout(100);
+    BENCHMARK("calculate_lengths [100 children]")
+    {
+        return space.calculate_lengths(*l100);
+    };
+
+    auto const l1000 = make_tight_layout(1'000);
+    BENCHMARK("calculate_lengths [1000 children]")
+    {
+        return space.calculate_lengths(*l1000);
+    };
+
+    auto const l10000 = make_tight_layout(10'000);
+    BENCHMARK("calculate_lengths [10000 children]")
+    {
+        return space.calculate_lengths(*l10000);
+    };
+}
+
+TEST_CASE("Layout Resize Latency", "[Layout][!benchmark]")
+{
+    // Posted Paint_events collect here instead of the user input loop.
+    static auto queue  = ox::Event_queue{};
+    auto const current = ox::test::Current_queue{queue};
+
+    auto deep = make_tree(6, 4);  // 4^6 leaves, 5461 Widgets.
+    deep->enable();
+    resize(*deep, 1);
+
+    BENCHMARK_ADVANCED("6 deep, fanout 4 [5461 widgets]")
+    (Catch::Benchmark::Chronometer meter)
+    {
+        meter.measure([&](int i) { return resize(*deep, i); });
+    };
+
+    auto wide = make_tree(3, 17);  // 17^3 leaves, 5220 Widgets.
+    wide->enable();
+    resize(*wide, 1);
+
+    BENCHMARK_ADVANCED("3 deep, fanout 17 [5220 widgets]")
+    (Catch::Benchmark::Chronometer meter)
+    {
+        meter.measure([&](int i) { return resize(*wide, i); });
+    };
+}
@@ -0,0 +1,143 @@
+#include <memory>
+#include <vector>
+
+#include <catch2/catch.hpp>
+
+#include <termox/system/event.hpp>
+#include <termox/system/event_queue.hpp>
+#include <termox/system/system.hpp>
+#include <termox/widget/area.hpp>
+#include <termox/widget/layouts/horizontal.hpp>
+#include <termox/widget/widget.hpp>
+
+#include "current_queue.hpp"
+
+namespace {
+
+[[nodiscard]] auto make_widgets(int count)
+    -> std::vector<std::unique_ptr<ox::Widget>>
+{
+    auto result = std::vector<std::unique_ptr<ox::Widget>>{};
+    for (auto i = 0; i < count; ++i)
+        result.push_back(std::make_unique<ox::Widget>());
+    return result;
+}
+
+/// Check find_child_position() against the actual child order.
+void check_positions(ox::layout::Horizontal<> const& layout)
+{
+    auto i = std::size_t{0};
+    for (auto const& child : layout.get_children())
+        CHECK(layout.find_child_position(&child) == i++);
+}
+
+}  // namespace
+
+TEST_CASE("find_child_position follows child changes", "[Layout]")
+{
+    auto queue         = ox::Event_queue{};
+    auto const current = ox::test::Current_queue{queue};
+
+    auto layout = ox::layout::horizontal();
+    auto& a     = layout->make_child();
+    auto& b     = layout->make_child();
+    auto& c     = layout->make_child();
+    check_positions(*layout);
+
+    auto& front = layout->insert_child(std::make_unique<ox::Widget>(), 0);
+    CHECK(layout->find_child_position(&front) == 0);
+    CHECK(layout->find_child_position(&c) == 3);
+
+    auto removed = layout->remove_child(&a);
+    CHECK(layout->find_child_position(&b) == 1);
+    CHECK(layout->find_child_position(removed.get()) == -1uL);
+    CHECK_FALSE(layout->contains_child(removed.get()));
+
+    layout->swap_children(0, 2);
+    CHECK(layout->find_child_position(&c) == 0);
+    CHECK(layout->find_child_position(&front) == 2);
+
+    layout->sort([](auto const& x, auto const& y) { return &x < &y; });
+    check_positions(*layout);
+
+    auto other = ox::Widget{};
+    CHECK(layout->find_child_position(&other) == -1uL);
+    CHECK(layout->find_child_position(nullptr) == -1uL);
+}
+
+TEST_CASE("Bulk child insert and removal", "[Layout]")
+{
+    auto queue         = ox::Event_queue{};
+    auto const current = ox::test::Current_queue{queue};
+
+    auto layout = ox::layout::horizontal();
+    layout->make_child();
+    layout->make_child();
+    layout->insert_children(make_widgets(4), 1);
+    CHECK(layout->child_count() == 6);
+    check_positions(*layout);
+
+    auto i = 0;
+    auto removed =
+        layout->remove_children_if([&i](auto&) { return i++ % 2 == 0; });
+    CHECK(removed.size() == 3);
+    CHECK(layout->child_count() == 3);
+    check_positions(*layout);
+    for (auto const& w : removed)
+        CHECK(w->parent() == nullptr);
+
+    layout->append_children(make_widgets(2));
+    CHECK(layout->child_count() == 5);
+    check_positions(*layout);
+
+    CHECK(layout->remove_and_delete_children_if([](auto&) { return true; }) ==
+          5);
+    CHECK(layout->child_count() == 0);
+}
+
+TEST_CASE("Bulk insert is laid out at the last Child_added_event", "[Layout]")
+{
+    auto queue         = ox::Event_queue{};
+    auto const current = ox::test::Current_queue{queue};
+
+    auto layout = ox::layout::horizontal();
+    layout->enable();
+    ox::System::send_event(ox::Resize_event{*layout, {30, 1}});
+
+    layout->append_children(make_widgets(3));
+    auto children = layout->get_children();
+    ox::System::send_event(ox::Child_added_event{*layout, children[0]});
+    ox::System::send_event(ox::Child_added_event{*layout, children[1]});
+    CHECK(children[0].area() == ox::Area{0, 0});
+
+    ox::System::send_event(ox::Child_added_event{*layout, children[2]});
+    CHECK(children[0].area() == ox::Area{10, 1});
+    CHECK(children[2].area() == ox::Area{10, 1});
+}
+
+TEST_CASE("Bulk removal keeps the child offset in bounds", "[Layout]")
+{
+    auto queue         = ox::Event_queue{};
+    auto const current = ox::test::Current_queue{queue};
+
+    auto layout = ox::layout::horizontal();
+    layout->enable();
+    ox::System::send_event(ox::Resize_event{*layout, {30, 1}});
+    layout->append_children(make_widgets(10));
+    layout->set_child_offset(8);
+
+    auto i       = 0;
+    auto removed = layout->remove_children_if([&i](auto&) { return i++ < 7; });
+    CHECK(removed.size() == 7);
+    CHECK(layout->child_count() == 3);
+    CHECK(layout->get_child_offset() == 2);
+    ox::System::send_event(ox::Resize_event{*layout, {20, 1}});
+    CHECK(layout->get_children()[2].area() == ox::Area{20, 1});
+
+    CHECK(layout->remove_and_delete_children_if(
+              [](auto const& w) { return w.area().width == 0; }) == 2);
+    CHECK(layout->child_count() == 1);
+    CHECK(layout->get_child_offset() == 0);
+    ox::System::send_event(ox::Resize_event{*layout, {10, 1}});
+    CHECK(layout->get_children()[0].area() == ox::Area{10, 1});
+}
@@ -0,0 +1,134 @@
+#include <catch2/catch.hpp>
+
+#include <termox/system/event.hpp>
+#include <termox/system/system.hpp>
+#include <termox/widget/area.hpp>
+#include <termox/widget/layouts/horizontal.hpp>
+#include <termox/widget/layouts/vertical.hpp>
+#include <termox/widget/point.hpp>
+#include <termox/widget/size_policy.hpp>
+#include <termox/widget/widget.hpp>
+
+namespace {
+
+/// Two rows of three Widgets each, no event loop required.
+class Grid : public ox::layout::Vertical<ox::layout::Horizontal<>> {
+   public:
+    int resize_count = 0;
+    int move_count   = 0;
+
+   public:
+    Grid()
+    {
+        for (auto i = 0; i < 2; ++i) {
+            auto& row = this->make_child();
+            for (auto j = 0; j < 3; ++j) {
+                auto& w = row.make_child();
+                w.resized.connect([this](auto, auto) { ++resize_count; });
+                w.moved.connect([this](auto, auto) { ++move_count; });
+            }
+        }
+        this->enable();
+    }
+
+   public:
+    [[nodiscard]] auto cell(int row, int column) -> ox::Widget&
+    {
+        return this->get_children()[row].get_children()[column];
+    }
+};
+
+/// Consumes every Resize_event sent to the Widgets it is installed on.
+class Resize_blocker : public ox::Widget {
+   protected:
+    auto resize_event_filter(ox::Widget&, ox::Area, ox::Area) -> bool override
+    {
+        return true;
+    }
+};
+
+}  // namespace
+
+TEST_CASE("Layout pass applies geometry to the whole tree", "[Layout]")
+{
+    auto grid = Grid{};
+    ox::System::send_event(ox::Resize_event{grid, {30, 10}});
+
+    // No events have been processed from the queue, every level is laid out.
+    CHECK(grid.cell(0, 0).area() == ox::Area{10, 5});
+    CHECK(grid.cell(1, 2).area() == ox::Area{10, 5});
+    CHECK(grid.cell(0, 0).top_left() == ox::Point{0, 0});
+    CHECK(grid.cell(0, 2).top_left() == ox::Point{20, 0});
+    CHECK(grid.cell(1, 1).top_left() == ox::Point{10, 5});
+    CHECK(grid.resize_count == 6);
+
+    // Same geometry, nothing is sent to the children.
+    grid.resize_count = 0;
+    grid.move_count   = 0;
+    ox::System::send_event(ox::Resize_event{grid, {30, 10}});
+    CHECK(grid.resize_count == 0);
+    CHECK(grid.move_count == 0);
+
+    // Only positions change, each leaf is moved exactly once.
+    ox::System::send_event(ox::Move_event{grid, {2, 1}});
+    CHECK(grid.resize_count == 0);
+    CHECK(grid.move_count == 6);
+    CHECK(grid.cell(1, 1).top_left() == ox::Point{12, 6});
+
+    // Nested rows are both moved and resized, leaves are laid out once.
+    grid.move_count = 0;
+    ox::System::send_event(ox::Resize_event{grid, {30, 20}});
+    CHECK(grid.resize_count == 6);
+    CHECK(grid.move_count == 3);
+    CHECK(grid.cell(1, 0).top_left() == ox::Point{2, 11});
+    CHECK(grid.cell(1, 0).area() == ox::Area{10, 10});
+}
+
+TEST_CASE("Layout recalculates lengths only when inputs change", "[Layout]")
+{
+    auto grid = Grid{};
+    ox::System::send_event(ox::Resize_event{grid, {30, 10}});
+    auto& row = grid.get_children()[0];
+
+    // A changed Size_policy is only seen after the Child_polished_event.
+    grid.cell(0, 0).width_policy = ox::Size_policy::fixed(6);
+    ox::System::send_event(ox::Child_polished_event{row, grid.cell(0, 0)});
+    CHECK(grid.cell(0, 0).area() == ox::Area{6, 5});
+    CHECK(grid.cell(0, 1).area() == ox::Area{12, 5});
+    CHECK(grid.cell(0, 2).top_left() == ox::Point{18, 0});
+
+    // Moving reuses the cached lengths, positions are translated.
+    grid.resize_count = 0;
+    ox::System::send_event(ox::Move_event{grid, {5, 5}});
+    CHECK(grid.resize_count == 0);
+    CHECK(grid.cell(0, 0).top_left() == ox::Point{5, 5});
+    CHECK(grid.cell(0, 2).top_left() == ox::Point{23, 5});
+    CHECK(grid.cell(1, 2).top_left() == ox::Point{25, 10});
+
+    // Removing a child changes the child count, lengths are recalculated.
+    auto removed = row.remove_child_at(2);
+    ox::System::send_event(ox::Move_event{grid, {0, 0}});
+    CHECK(grid.cell(0, 0).area() == ox::Area{6, 5});
+    CHECK(grid.cell(0, 1).area() == ox::Area{24, 5});
+}
+
+TEST_CASE("Layout pass arranges a moved layout whose resize is filtered",
+          "[Layout]")
+{
+    auto grid = Grid{};
+    ox::System::send_event(ox::Resize_event{grid, {30, 10}});
+    auto& row    = grid.get_children()[1];
+    auto blocker  = Resize_blocker{};
+    row.install_event_filter(blocker);
+
+    // The row is moved and resized, it keeps its size but its children still
+    // follow it to the new position.
+    ox::System::send_event(ox::Resize_event{grid, {30, 20}});
+    CHECK(row.top_left() == ox::Point{0, 10});
+    CHECK(row.area() == ox::Area{30, 5});
+    CHECK(grid.cell(1, 0).top_left() == ox::Point{0, 10});
+    CHECK(grid.cell(1, 2).top_left() == ox::Point{20, 10});
+    CHECK(grid.cell(1, 2).area() == ox::Area{10, 5});
+
+    row.remove_event_filter(blocker);
+}
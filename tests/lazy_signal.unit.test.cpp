@@ -0,0 +1,47 @@
+#include <catch2/catch.hpp>
+
+#include <termox/common/lazy_signal.hpp>
+#include <termox/widget/area.hpp>
+#include <termox/widget/widget.hpp>
+
+TEST_CASE("Lazy_signal allocates on first connect", "[Lazy_signal]")
+{
+    auto signal = ox::Lazy_signal<bool(int)>{};
+    CHECK_FALSE(signal.is_allocated());
+    CHECK_FALSE(signal.emit(5).has_value());
+    CHECK_FALSE(signal.is_allocated());
+
+    signal.connect([](int x) { return x > 3; });
+    REQUIRE(signal.is_allocated());
+    CHECK(signal.emit(5).value());
+    CHECK_FALSE(signal(2).value());
+
+    signal.disconnect_all();
+    CHECK_FALSE(signal.emit(5).has_value());
+}
+
+TEST_CASE("Lazy_signal is a single pointer", "[Lazy_signal]")
+{
+    CHECK(sizeof(ox::Lazy_signal<void()>) == sizeof(void*));
+    CHECK(sizeof(ox::Lazy_signal<bool(ox::Area, ox::Area)>) == sizeof(void*));
+}
+
+TEST_CASE("Widget Signals and filters are allocated on use", "[Widget]")
+{
+    auto w = ox::Widget{};
+    CHECK_FALSE(w.resized.is_allocated());
+    CHECK(w.get_event_filters().empty());
+    w.resized.emit(ox::Area{1, 1}, ox::Area{0, 0});
+
+    auto count = 0;
+    w.resized.connect([&count](auto, auto) { ++count; });
+    w.resized.emit(ox::Area{1, 1}, ox::Area{0, 0});
+    CHECK(count == 1);
+    CHECK_FALSE(w.moved.is_allocated());
+
+    auto filter = ox::Widget{};
+    w.install_event_filter(filter);
+    CHECK(w.get_event_filters().size() == 1);
+    w.remove_event_filter(filter);
+    CHECK(w.get_event_filters().empty());
+}
@@ -0,0 +1,112 @@
+#include "../demos/game_of_life/life_kernel.hpp"
+
+#include <random>
+#include <vector>
+
+#include <catch2/catch.hpp>
+
+#include "../demos/game_of_life/coordinate.hpp"
+#include "../demos/game_of_life/rule.hpp"
+#include "life_reference.hpp"
+
+using gol::Coordinate;
+using gol::Life_kernel;
+using gol::test::alive_cells;
+
+namespace {
+
+/// Return a \p width x \p height field from \p origin, about a third alive.
+[[nodiscard]] auto random_field(Coordinate origin,
+                                int width,
+                                int height,
+                                unsigned seed) -> std::vector<Coordinate>
+{
+    auto gen    = std::mt19937{seed};
+    auto result = std::vector<Coordinate>{};
+    for (auto y = 0; y < height; ++y) {
+        for (auto x = 0; x < width; ++x) {
+            if (gen() % 3 == 0)
+                result.push_back({origin.x + x, origin.y + y});
+        }
+    }
+    return result;
+}
+
+/// Step \p cells with Life_kernel and the reference, comparing each generation.
+void check_against_reference(std::vector<Coordinate> const& cells,
+                             char const* rule_string,
+                             int generations)
+{
+    auto const rule = gol::parse_rule_string(rule_string);
+    auto kernel     = Life_kernel{};
+    auto reference  = gol::test::Life_reference{};
+    for (auto const c : cells) {
+        kernel.set(c, true);
+        reference.set(c);
+    }
+    REQUIRE(alive_cells(kernel) == reference.cells());
+    for (auto g = 1; g <= generations; ++g) {
+        kernel.step(rule);
+        reference.step(rule);
+        INFO(rule_string << ", generation " << g);
+        REQUIRE(alive_cells(kernel) == reference.cells());
+        REQUIRE(kernel.population() == reference.cells().size());
+    }
+}
+
+}  // namespace
+
+// Tile borders are at multiples of 64 cells from the origin. A row of a tile is
+// one word, so the west and east neighbors of its first and last cells are
+// shifted in from the neighboring tile's word.
+
+TEST_CASE("Life_kernel matches the per-cell step on random fields",
+          "[Life_kernel]")
+{
+    auto const rule = GENERATE(as<char const*>{}, "B3/S23", "B36/S23", "B2/S");
+
+    // Widths and heights that are not multiples of 64, across tile borders.
+    check_against_reference(random_field({-70, -40}, 130, 100, 1), rule, 12);
+    check_against_reference(random_field({1, -3}, 63, 65, 2), rule, 12);
+    check_against_reference(random_field({-200, 60}, 300, 9, 3), rule, 12);
+
+    // Exactly one tile.
+    check_against_reference(random_field({-64, -64}, 64, 64, 4), rule, 12);
+}
+
+TEST_CASE("Life_kernel steps patterns across tile borders", "[Life_kernel]")
+{
+    // Blinkers on the first and last cells of a tile's row and column.
+    check_against_reference({{63, -1}, {63, 0}, {63, 1}}, "B3/S23", 4);
+    check_against_reference({{64, -1}, {64, 0}, {64, 1}}, "B3/S23", 4);
+    check_against_reference({{-1, 63}, {0, 63}, {1, 63}}, "B3/S23", 4);
+    check_against_reference({{-1, -64}, {0, -64}, {1, -64}}, "B3/S23", 4);
+
+    // Gliders through the corner where four tiles meet, in each direction.
+    check_against_reference(
+        {{-9, -10}, {-8, -9}, {-10, -8}, {-9, -8}, {-8, -8}}, "B3/S23", 40);
+    check_against_reference({{8, 10}, {7, 9}, {9, 8}, {8, 8}, {7, 8}},
+                            "B3/S23", 40);
+    check_against_reference({{8, -10}, {7, -9}, {9, -8}, {8, -8}, {7, -8}},
+                            "B3/S23", 40);
+    check_against_reference({{-9, 10}, {-8, 9}, {-10, 8}, {-9, 8}, {-8, 8}},
+                            "B3/S23", 40);
+}
+
+TEST_CASE("Life_kernel keeps cells past the world edge dead", "[Life_kernel]")
+{
+    auto constexpr bound = Life_kernel::outer_bound;
+
+    // The edge is not on a tile border, the kernel masks cells past it.
+    check_against_reference(random_field({bound - 20, bound - 20}, 21, 21, 5),
+                            "B3/S23", 20);
+    check_against_reference(random_field({-bound, -bound}, 21, 21, 6),
+                            "B3/S23", 20);
+    check_against_reference(random_field({bound - 30, -10}, 31, 20, 7),
+                            "B2/S", 20);
+
+    auto kernel = Life_kernel{};
+    kernel.set({bound + 1, 0}, true);
+    kernel.set({0, -bound - 1}, true);
+    CHECK(kernel.population() == 0);
+}
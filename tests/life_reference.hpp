@@ -0,0 +1,80 @@
+#ifndef TERMOX_TESTS_LIFE_REFERENCE_HPP
+#define TERMOX_TESTS_LIFE_REFERENCE_HPP
+#include <set>
+#include <utility>
+
+#include "../demos/game_of_life/coordinate.hpp"
+#include "../demos/game_of_life/life_kernel.hpp"
+#include "../demos/game_of_life/rule.hpp"
+
+namespace gol::test {
+
+/// Living cells stepped one cell at a time, as Game_of_life_engine once did.
+/** The reference the faster engines are checked against. Cells outside of
+ *  [-Life_kernel::outer_bound, Life_kernel::outer_bound] on either axis are
+ *  always dead. */
+class Life_reference {
+   public:
+    /// Set the cell at \p c alive. No-op if \p c is out of bounds.
+    void set(Coordinate c)
+    {
+        if (is_in_bounds(c))
+            cells_.insert(c);
+    }
+
+    /// Compute the next generation with \p rule.
+    void step(Rule const& rule)
+    {
+        auto candidates = std::set<Coordinate>{};
+        for (auto const c : cells_) {
+            for (auto dy = -1; dy <= 1; ++dy) {
+                for (auto dx = -1; dx <= 1; ++dx)
+                    candidates.insert({c.x + dx, c.y + dy});
+            }
+        }
+        auto next = std::set<Coordinate>{};
+        for (auto const c : candidates) {
+            if (!is_in_bounds(c))
+                continue;
+            auto count = 0;
+            for (auto dy = -1; dy <= 1; ++dy) {
+                for (auto dx = -1; dx <= 1; ++dx) {
+                    if (dx != 0 || dy != 0)
+                        count += (int)cells_.count({c.x + dx, c.y + dy});
+                }
+            }
+            auto const is_alive = cells_.count(c) != 0;
+            if (is_alive ? rule.survival[count] : rule.birth[count])
+                next.insert(c);
+        }
+        cells_ = std::move(next);
+    }
+
+    /// Return the living cells.
+    [[nodiscard]] auto cells() const -> std::set<Coordinate> const&
+    {
+        return cells_;
+    }
+
+   private:
+    std::set<Coordinate> cells_;
+
+   private:
+    [[nodiscard]] static auto is_in_bounds(Coordinate c) -> bool
+    {
+        auto constexpr bound = Life_kernel::outer_bound;
+        return c.x >= -bound && c.x <= bound && c.y >= -bound && c.y <= bound;
+    }
+};
+
+/// Return the living cells of \p life, which has a for_each_alive() method.
+template <typename Life>
+[[nodiscard]] auto alive_cells(Life const& life) -> std::set<Coordinate>
+{
+    auto result = std::set<Coordinate>{};
+    life.for_each_alive([&result](Coordinate c) { result.insert(c); });
+    return result;
+}
+
+}  // namespace gol::test
+#endif  // TERMOX_TESTS_LIFE_REFERENCE_HPP
@@ -0,0 +1,131 @@
+#include <string>
+#include <vector>
+
+#include <catch2/catch.hpp>
+
+#include <termox/common/span.hpp>
+#include <termox/painter/color.hpp>
+#include <termox/painter/glyph.hpp>
+#include <termox/painter/glyph_matrix.hpp>
+#include <termox/painter/glyph_string.hpp>
+#include <termox/painter/painter.hpp>
+#include <termox/terminal/detail/canvas.hpp>
+#include <termox/widget/area.hpp>
+#include <termox/widget/widget.hpp>
+
+// Benchmark names include the number of cells written per run, divide by the
+// reported mean to get cells per second. Each run also constructs a Painter,
+// which paints the Widget's wallpaper over the entire screen first.
+
+namespace {
+
+auto constexpr screen = ox::Area{200, 50};
+
+/// Widget covering the entire screen, no event loop required.
+auto make_widget(ox::Brush b) -> ox::Widget&
+{
+    static auto w = ox::Widget{};
+    w.set_area(screen);
+    w.set_top_left({0, 0});
+    w.brush = b;
+    return w;
+}
+
+}  // namespace
+
+TEST_CASE("Painter Fill Throughput", "[Painter][!benchmark]")
+{
+    auto canvas = ox::detail::Canvas{screen};
+    auto& w     = make_widget(ox::Brush{bg(ox::Color::Blue)});
+
+    BENCHMARK("Painter::fill 200x50 [10000 cells]")
+    {
+        auto p = ox::Painter{w, canvas};
+        p.fill(U'#' | fg(ox::Color::Red), {0, 0}, screen);
+        return canvas.at({199, 49});
+    };
+
+    BENCHMARK("Painter::hline x50 [10000 cells]")
+    {
+        auto p = ox::Painter{w, canvas};
+        for (auto y = 0; y < screen.height; ++y)
+            p.hline(U'-', {0, y}, {screen.width - 1, y});
+        return canvas.at({199, 49});
+    };
+
+    BENCHMARK("Painter::vline x200 [10000 cells]")
+    {
+        auto p = ox::Painter{w, canvas};
+        for (auto x = 0; x < screen.width; ++x)
+            p.vline(U'|', {x, 0}, {x, screen.height - 1});
+        return canvas.at({199, 49});
+    };
+
+    BENCHMARK("Painter::put(Glyph) x10000 [10000 cells]")
+    {
+        auto p = ox::Painter{w, canvas};
+        for (auto y = 0; y < screen.height; ++y) {
+            for (auto x = 0; x < screen.width; ++x)
+                p.put(ox::Glyph{U'x'}, {x, y});
+        }
+        return canvas.at({199, 49});
+    };
+}
+
+TEST_CASE("Painter Put Throughput", "[Painter][!benchmark]")
+{
+    auto canvas = ox::detail::Canvas{screen};
+    auto const line =
+        ox::Glyph_string{std::u32string(screen.width, U'a'), ox::Trait::Bold};
+    auto const run = std::vector<ox::Glyph>(screen.width, ox::Glyph{U'b'});
+    auto matrix    = ox::Glyph_matrix{screen};
+    matrix.fill(ox::Glyph{U'c', fg(ox::Color::Green)});
+
+    SECTION("Default Brush")
+    {
+        auto& w = make_widget(ox::Brush{});
+
+        BENCHMARK("Painter::put(Glyph_string) x50 [10000 cells]")
+        {
+            auto p = ox::Painter{w, canvas};
+            for (auto y = 0; y < screen.height; ++y)
+                p.put(line, {0, y});
+            return canvas.at({199, 49});
+        };
+
+        BENCHMARK("Painter::put(Span<Glyph const>) x50 [10000 cells]")
+        {
+            auto p = ox::Painter{w, canvas};
+            for (auto y = 0; y < screen.height; ++y)
+                p.put(ox::Span<ox::Glyph const>{run}, {0, y});
+            return canvas.at({199, 49});
+        };
+
+        BENCHMARK("Painter::put(Glyph_matrix) [10000 cells]")
+        {
+            auto p = ox::Painter{w, canvas};
+            p.put(matrix, {0, 0});
+            return canvas.at({199, 49});
+        };
+    }
+
+    SECTION("Widget Brush")
+    {
+        auto& w = make_widget(ox::Brush{bg(ox::Color::Blue), ox::Trait::Bold});
+
+        BENCHMARK("Painter::put(Glyph_string) merge x50 [10000 cells]")
+        {
+            auto p = ox::Painter{w, canvas};
+            for (auto y = 0; y < screen.height; ++y)
+                p.put(line, {0, y});
+            return canvas.at({199, 49});
+        };
+
+        BENCHMARK("Painter::put(Glyph_matrix) merge [10000 cells]")
+        {
+            auto p = ox::Painter{w, canvas};
+            p.put(matrix, {0, 0});
+            return canvas.at({199, 49});
+        };
+    }
+}
@@ -0,0 +1,202 @@
+#include <termox/painter/painter.hpp>
+
+#include <algorithm>
+#include <cstddef>
+#include <functional>
+#include <iterator>
+#include <vector>
+
+#include <catch2/catch.hpp>
+
+#include <termox/common/span.hpp>
+#include <termox/painter/brush.hpp>
+#include <termox/painter/color.hpp>
+#include <termox/painter/glyph.hpp>
+#include <termox/painter/glyph_string.hpp>
+#include <termox/painter/trait.hpp>
+#include <termox/system/event.hpp>
+#include <termox/system/event_queue.hpp>
+#include <termox/terminal/detail/canvas.hpp>
+#include <termox/widget/area.hpp>
+#include <termox/widget/point.hpp>
+#include <termox/widget/widget.hpp>
+
+#include "current_queue.hpp"
+
+using ox::Area;
+using ox::Glyph;
+using ox::Painter;
+using ox::Point;
+
+namespace {
+
+// Painter's span operations clip a run or rectangle to the Widget once, these
+// are the per-cell versions they replaced, each cell clipped by put(Glyph).
+
+void put_each(Painter& p, ox::Glyph_string const& text, Point at)
+{
+    for (Glyph g : text)
+        p.put(g, {at.x++, at.y});
+}
+
+void hline_each(Painter& p, Glyph tile, Point a, Point b)
+{
+    for (; a.x <= b.x; ++a.x)
+        p.put(tile, a);
+}
+
+void vline_each(Painter& p, Glyph tile, Point a, Point b)
+{
+    for (; a.y <= b.y; ++a.y)
+        p.put(tile, a);
+}
+
+void fill_each(Painter& p, Glyph tile, Point point, Area area)
+{
+    if (area.width == 0)
+        return;
+    auto const y_limit = point.y + area.height;
+    auto const x_limit = point.x + area.width - 1;
+    for (; point.y < y_limit; ++point.y)
+        hline_each(p, tile, point, {x_limit, point.y});
+}
+
+auto constexpr screen = Area{16, 10};
+
+/// Top left and size of a Widget on the screen.
+struct Geometry {
+    Point top_left;
+    Area area;
+};
+
+// The screen, Widgets offset within it as if nested in layouts, one touching
+// the bottom right corner of the screen, and Widgets with no cells.
+auto const geometries = std::vector<Geometry>{
+    {{0, 0}, screen},  {{3, 2}, {6, 4}},  {{10, 7}, {6, 3}},
+    {{1, 5}, {15, 1}}, {{7, 0}, {1, 10}}, {{4, 4}, {0, 0}},
+    {{4, 4}, {0, 3}},  {{4, 4}, {5, 0}},
+};
+
+/// Glyphs with a few different Brushes, so runs of a Brush are merged.
+[[nodiscard]] auto make_text(int length) -> ox::Glyph_string
+{
+    auto result = ox::Glyph_string{};
+    for (auto i = 0; i < length; ++i) {
+        auto const brush = i % 3 == 0 ? ox::Brush{fg(ox::Color::Red)}
+                           : i % 3 == 1
+                               ? ox::Brush{ox::Trait::Italic}
+                               : ox::Brush{};
+        result.append(Glyph{static_cast<char32_t>(U'a' + i), brush});
+    }
+    return result;
+}
+
+using Paint = std::function<void(Painter&)>;
+
+/// Return true if \p painted and \p expected leave the same canvas.
+/** Each paints \p w on its own canvas, which has every cell set beforehand so
+ *  writes outside of \p w are seen. */
+[[nodiscard]] auto paints_same(ox::Widget& w,
+                               Paint const& painted,
+                               Paint const& expected) -> bool
+{
+    static auto a    = ox::detail::Canvas{screen};
+    static auto b    = ox::detail::Canvas{screen};
+    auto const paint = [&w](ox::detail::Canvas& canvas, Paint const& f) {
+        std::fill(std::begin(canvas), std::end(canvas),
+                  Glyph{U'~', bg(ox::Color::Green)});
+        auto p = Painter{w, canvas};
+        f(p);
+    };
+    paint(a, painted);
+    paint(b, expected);
+    return std::equal(std::begin(a), std::end(a), std::begin(b));
+}
+
+/// Call \p f with a Widget of each Geometry and Brush, and each start Point.
+/** Points range from off the top left of the screen to off its bottom right.
+ *  Posted events go to a local Event_queue and are discarded. */
+template <typename F>
+void for_each_case(F&& f)
+{
+    auto queue         = ox::Event_queue{};
+    auto const current = ox::test::Current_queue{queue};
+    auto const brushes = {ox::Brush{},
+                          ox::Brush{bg(ox::Color::Blue), ox::Trait::Bold}};
+    for (auto const& g : geometries) {
+        for (auto const& brush : brushes) {
+            auto w = ox::Widget{};
+            w.set_top_left(g.top_left);
+            w.set_area(g.area);
+            w.brush = brush;
+            for (auto y = -2; y <= screen.height + 1; ++y) {
+                for (auto x = -8; x <= screen.width + 1; ++x) {
+                    INFO("at " << x << ", " << y << " in Widget at "
+                               << g.top_left.x << ", " << g.top_left.y
+                               << " of " << g.area.width << "x"
+                               << g.area.height);
+                    f(w, Point{x, y});
+                }
+            }
+        }
+    }
+}
+
+}  // namespace
+
+TEST_CASE("Painter::put of a run clips like put of each Glyph", "[Painter]")
+{
+    for (auto const length : {0, 1, 3, 7, 12, 20}) {
+        auto const text = make_text(length);
+        auto const span =
+            ox::Span<Glyph const>{text.data(), (std::size_t)text.size()};
+        INFO("length " << length);
+        for_each_case([&](ox::Widget& w, Point at) {
+            auto const expected = [&](Painter& p) { put_each(p, text, at); };
+            CHECK(paints_same(w, [&](Painter& p) { p.put(text, at); },
+                              expected));
+            CHECK(paints_same(w, [&](Painter& p) { p.put(span, at); },
+                              expected));
+        });
+    }
+}
+
+TEST_CASE("Painter::fill clips like put of each Glyph", "[Painter]")
+{
+    auto const tile = Glyph{U'#', fg(ox::Color::Red)};
+
+    for (auto const area : {Area{0, 0}, Area{0, 4}, Area{4, 0}, Area{1, 1},
+                            Area{3, 2}, Area{9, 12}, Area{-2, 3}}) {
+        INFO(area.width << "x" << area.height);
+        for_each_case([&](ox::Widget& w, Point at) {
+            CHECK(paints_same(
+                w, [&](Painter& p) { p.fill(tile, at, area); },
+                [&](Painter& p) { fill_each(p, tile, at, area); }));
+        });
+    }
+
+    for_each_case([&](ox::Widget& w, Point) {
+        CHECK(paints_same(
+            w, [&](Painter& p) { p.fill(tile); },
+            [&](Painter& p) { fill_each(p, tile, {0, 0}, w.area()); }));
+    });
+}
+
+TEST_CASE("Painter::hline and vline clip like put of each Glyph", "[Painter]")
+{
+    auto const tile = Glyph{U'-', ox::Trait::Underline};
+
+    for (auto const length : {-1, 0, 1, 5, 30}) {
+        INFO("length " << length);
+        for_each_case([&](ox::Widget& w, Point a) {
+            auto const right = Point{a.x + length - 1, a.y};
+            auto const down  = Point{a.x, a.y + length - 1};
+            CHECK(paints_same(
+                w, [&](Painter& p) { p.hline(tile, a, right); },
+                [&](Painter& p) { hline_each(p, tile, a, right); }));
+            CHECK(paints_same(
+                w, [&](Painter& p) { p.vline(tile, a, down); },
+                [&](Painter& p) { vline_each(p, tile, a, down); }));
+        });
+    }
+}
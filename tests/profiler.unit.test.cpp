@@ -0,0 +1,87 @@
+#include <termox/system/profiler.hpp>
+
+#include <cstddef>
+
+#include <catch2/catch.hpp>
+
+#include <termox/widget/widget.hpp>
+
+using ox::Profiler;
+
+#ifdef TERMOX_PROFILE
+
+TEST_CASE("Profiler records nested hooks into a Frame", "[Profiler]")
+{
+    Profiler::clear();
+    auto w = ox::Widget{};
+    w.set_name("Profiled");
+    {
+        auto frame = ox::detail::Frame_profile{};
+        {
+            auto const outer = ox::detail::Layout_profile{};
+            auto const inner = ox::detail::Layout_profile{};
+        }
+        {
+            auto const paint = ox::detail::Paint_profile{w};
+        }
+        {
+            auto const paint = ox::detail::Paint_profile{w};
+        }
+        auto refresh = ox::detail::Refresh_profile{};
+        refresh.record(12, 345);
+        frame.record();
+    }
+
+    auto const stats = Profiler::snapshot();
+    REQUIRE(stats.frames.size() == 1);
+    auto const& frame = stats.frames.front();
+    CHECK(frame.paint_count == 2);
+    CHECK(frame.diff_size == 12);
+    CHECK(frame.bytes_written == 345);
+    CHECK(frame.paint + frame.layout + frame.refresh <= frame.total);
+
+    REQUIRE(stats.widgets.size() == 1);
+    auto const& paint = stats.widgets.front();
+    CHECK(paint.id == w.unique_id());
+    CHECK(paint.name == "Profiled");
+    CHECK(paint.count == 2);
+    CHECK(paint.max <= paint.total);
+
+    CHECK(Profiler::snapshot(frame.number + 1).frames.empty());
+}
+
+TEST_CASE("Profiler skips Frames without record()", "[Profiler]")
+{
+    Profiler::clear();
+    {
+        auto const frame = ox::detail::Frame_profile{};
+    }
+    CHECK(Profiler::snapshot().frames.empty());
+}
+
+TEST_CASE("Profiler keeps only the most recent records", "[Profiler]")
+{
+    Profiler::clear();
+    auto const count = Profiler::capacity + 100;
+    for (auto i = std::size_t{0}; i < count; ++i)
+        ox::detail::Frame_profile{}.record();
+    CHECK(Profiler::snapshot().frames.size() == Profiler::capacity);
+
+    Profiler::clear();
+    CHECK(Profiler::snapshot().frames.empty());
+}
+
+#else
+
+TEST_CASE("Profiler is empty when disabled", "[Profiler]")
+{
+    {
+        auto frame = ox::detail::Frame_profile{};
+        frame.record();
+    }
+    auto const stats = Profiler::snapshot();
+    CHECK(stats.frames.empty());
+    CHECK(stats.widgets.empty());
+}
+
+#endif  // TERMOX_PROFILE
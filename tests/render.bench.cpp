@@ -0,0 +1,221 @@
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <string_view>
+#include <vector>
+
+#include <catch2/catch.hpp>
+
+#include <esc/event.hpp>
+
+#include <termox/common/unique_queue.hpp>
+#include <termox/painter/color.hpp>
+#include <termox/painter/glyph.hpp>
+#include <termox/painter/glyph_string.hpp>
+#include <termox/system/event.hpp>
+#include <termox/system/event_queue.hpp>
+#include <termox/terminal/detail/screen_buffers.hpp>
+#include <termox/terminal/terminal.hpp>
+#include <termox/terminal/terminal_backend.hpp>
+#include <termox/widget/area.hpp>
+#include <termox/widget/point.hpp>
+#include <termox/widget/widget.hpp>
+#include <termox/widget/widgets/text_view.hpp>
+#include <termox/widget/wrap.hpp>
+
+// Benchmarks of the per-frame render and event paths, each parameterized by
+// the input size. Names end with the parameters in brackets so results from
+// different commits can be matched by name, see catch2.bench.main.cpp for the
+// JSON reporter. Dirty cells change every run, so each run has the stated
+// number of cells to diff and write.
+
+namespace {
+
+auto constexpr screens =
+    std::array{ox::Area{80, 24}, ox::Area{200, 50}, ox::Area{400, 100}};
+
+auto constexpr dirty_percents = std::array{1, 10, 100};
+
+/// Terminal_backend that only counts bytes, so escape generation is measured.
+class Discard_backend : public ox::Terminal_backend {
+   public:
+    std::uint64_t bytes = 0;
+
+   public:
+    void initialize(ox::Mouse_mode, ox::Key_mode, ox::Signals) override {}
+
+    void uninitialize() override {}
+
+    [[nodiscard]] auto area() const -> ox::Area override { return {0, 0}; }
+
+    void write(std::string_view b) override { bytes += b.size(); }
+
+    void flush() override {}
+
+    void show_cursor(bool) override {}
+
+    [[nodiscard]] auto read() -> ::esc::Event override { return {}; }
+
+    [[nodiscard]] auto color_count() const -> std::uint16_t override
+    {
+        return 16;
+    }
+
+    [[nodiscard]] auto has_true_color() const -> bool override { return false; }
+};
+
+/// Exposes update_display() so it can be called without an event loop.
+class Bench_text_view : public ox::Text_view {
+   public:
+    using Text_view::Text_view;
+    using Text_view::update_display;
+};
+
+/// Return the Points of \p percent of the cells in \p a, spread evenly.
+[[nodiscard]] auto dirty_points(ox::Area a, int percent)
+    -> std::vector<ox::Point>
+{
+    auto result = std::vector<ox::Point>{};
+    for (auto y = 0; y < a.height; ++y) {
+        for (auto x = 0; x < a.width; ++x) {
+            auto const i = (std::uint32_t)(y * a.width + x);
+            if ((i * 2654435761u) % 100 < (std::uint32_t)percent)
+                result.push_back({x, y});
+        }
+    }
+    return result;
+}
+
+/// Write a Glyph to each of \p points in \p canvas, different for odd \p run.
+void touch(ox::detail::Canvas& canvas,
+           std::vector<ox::Point> const& points,
+           int run)
+{
+    auto const glyph =
+        run % 2 == 0 ? U'x' | fg(ox::Color::Red) : U'o' | bg(ox::Color::Blue);
+    for (auto const p : points)
+        canvas.at(p) = glyph;
+}
+
+/// " [WxH, P% dirty]"
+[[nodiscard]] auto screen_label(ox::Area a, int percent) -> std::string
+{
+    return " [" + std::to_string(a.width) + "x" + std::to_string(a.height) +
+           ", " + std::to_string(percent) + "% dirty]";
+}
+
+/// Return \p count characters of lowercase text with spaces between words.
+[[nodiscard]] auto make_text(int count) -> std::string
+{
+    auto result = std::string{};
+    result.reserve(count);
+    for (auto i = 0; i < count; ++i)
+        result.push_back(i % 7 == 6 ? ' ' : 'a' + (i % 26));
+    return result;
+}
+
+}  // namespace
+
+TEST_CASE("Screen_buffers merge_and_diff", "[Render][!benchmark]")
+{
+    auto const a       = GENERATE(from_range(screens));
+    auto const percent = GENERATE(from_range(dirty_percents));
+    auto const points  = dirty_points(a, percent);
+    auto buffers       = ox::detail::Screen_buffers{a};
+    auto run           = 0;
+
+    BENCHMARK("merge_and_diff" + screen_label(a, percent))
+    {
+        touch(buffers.next, points, run++);
+        auto const size = buffers.merge_and_diff().size();
+        buffers.next.reset();
+        return size;
+    };
+}
+
+TEST_CASE("Terminal refresh", "[Render][!benchmark]")
+{
+    auto const a       = GENERATE(from_range(screens));
+    auto const percent = GENERATE(from_range(dirty_percents));
+    auto const points  = dirty_points(a, percent);
+    auto owned         = std::make_unique<Discard_backend>();
+    auto& backend      = *owned;
+    ox::Terminal::set_backend(std::move(owned));
+    ox::Terminal::screen_buffers.resize(a);
+    auto run = 0;
+
+    // Includes merge_and_diff(), to_escape_sequence() and the backend write.
+    BENCHMARK("Terminal::refresh" + screen_label(a, percent))
+    {
+        touch(ox::Terminal::screen_buffers.next, points, run++);
+        ox::Terminal::refresh();
+        return backend.bytes;
+    };
+
+    ox::Terminal::screen_buffers.resize({0, 0});
+    ox::Terminal::set_backend(std::make_unique<ox::Tty_backend>());
+}
+
+TEST_CASE("Unique_queue compress", "[Event_queue][!benchmark]")
+{
+    auto const count = GENERATE(10, 100, 1'000, 10'000);
+    auto widgets     = std::vector<ox::Widget>(count);
+
+    // Each Widget is updated four times per frame, in an interleaved order.
+    auto events = std::vector<ox::Paint_event>{};
+    for (auto repeat = 0; repeat < 4; ++repeat) {
+        for (auto i = 0; i < count; ++i)
+            events.push_back({widgets[(i * 7 + repeat) % count]});
+    }
+
+    BENCHMARK("compress [" + std::to_string(count) + " widgets, " +
+              std::to_string(events.size()) + " events]")
+    {
+        auto queue = ox::Unique_queue<ox::Paint_event>{};
+        for (auto const& e : events)
+            queue.append(e);
+        queue.compress();
+        auto const size = queue.size();
+        queue.clear();
+        return size;
+    };
+}
+
+TEST_CASE("Glyph_string construction", "[Glyph_string][!benchmark]")
+{
+    auto const count = GENERATE(16, 256, 4'096, 65'536);
+    auto const text  = make_text(count);
+    auto const wide  = std::u32string(std::begin(text), std::end(text));
+    auto const label = " [" + std::to_string(count) + " symbols]";
+
+    BENCHMARK("Glyph_string from UTF8" + label)
+    {
+        return ox::Glyph_string{text};
+    };
+
+    BENCHMARK("Glyph_string from UTF32" + label)
+    {
+        return ox::Glyph_string{wide};
+    };
+
+    BENCHMARK("Glyph_string from UTF32 with Brush" + label)
+    {
+        return ox::Glyph_string{wide, fg(ox::Color::Red), ox::Trait::Bold};
+    };
+}
+
+TEST_CASE("Text_view update_display", "[Text_view][!benchmark]")
+{
+    auto const count = GENERATE(256, 4'096, 65'536);
+    auto const label = " [" + std::to_string(count) + " symbols, 200 wide]";
+    auto view        = Bench_text_view{ox::Glyph_string{make_text(count)}};
+    view.set_area({200, 50});
+
+    BENCHMARK("update_display word wrap" + label) { view.update_display(); };
+
+    view.set_wrap(Wrap::Any);
+
+    BENCHMARK("update_display any wrap" + label) { view.update_display(); };
+}
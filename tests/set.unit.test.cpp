@@ -0,0 +1,128 @@
+#include <memory>
+#include <random>
+#include <vector>
+
+#include <catch2/catch.hpp>
+
+#include <termox/system/event_queue.hpp>
+#include <termox/system/system.hpp>
+#include <termox/widget/layouts/set.hpp>
+#include <termox/widget/layouts/vertical.hpp>
+#include <termox/widget/widget.hpp>
+
+#include "current_queue.hpp"
+
+namespace {
+
+struct Row : ox::Widget {
+    explicit Row(int s, int i = 0) : score{s}, id{i} {}
+    int score;
+    int id;
+};
+
+struct By_score {
+    auto operator()(Row const& r) const -> int { return r.score; }
+};
+
+using Leaderboard = ox::layout::Set<ox::layout::Vertical<Row>, By_score>;
+
+/// Return (score, id) of each child, in order.
+[[nodiscard]] auto contents(Leaderboard const& set)
+    -> std::vector<std::pair<int, int>>
+{
+    auto result = std::vector<std::pair<int, int>>{};
+    for (auto const& row : set.get_children())
+        result.push_back({row.score, row.id});
+    return result;
+}
+
+/// Check the cached positions and the sorted order.
+void check_invariants(Leaderboard const& set)
+{
+    auto i = std::size_t{0};
+    for (auto const& row : set.get_children())
+        CHECK(set.find_child_position(&row) == i++);
+    auto const c = contents(set);
+    CHECK(std::is_sorted(std::begin(c), std::end(c),
+                         [](auto a, auto b) { return a.first < b.first; }));
+}
+
+}  // namespace
+
+TEST_CASE("Set inserts and finds by key", "[Set]")
+{
+    auto queue         = ox::Event_queue{};
+    auto const current = ox::test::Current_queue{queue};
+
+    auto set = Leaderboard{};
+    set.make_child(5, 0);
+    set.make_child(1, 1);
+    set.make_child(5, 2);
+    set.make_child(3, 3);
+    using V = std::vector<std::pair<int, int>>;
+    CHECK(contents(set) == V{{1, 1}, {3, 3}, {5, 0}, {5, 2}});
+
+    REQUIRE(set.find_child(5) != nullptr);
+    CHECK(set.find_child(5)->id == 0);
+    CHECK(set.find_child(3)->id == 3);
+    CHECK(set.find_child(4) == nullptr);
+    CHECK(set.find_child(9) == nullptr);
+
+    auto batch = std::vector<std::unique_ptr<Row>>{};
+    batch.push_back(std::make_unique<Row>(5, 4));
+    batch.push_back(std::make_unique<Row>(0, 5));
+    batch.push_back(std::make_unique<Row>(3, 6));
+    set.insert_children(std::move(batch));
+    CHECK(contents(set) ==
+          V{{0, 5}, {1, 1}, {3, 3}, {3, 6}, {5, 0}, {5, 2}, {5, 4}});
+    check_invariants(set);
+}
+
+TEST_CASE("Set repositions a child after its key changes", "[Set]")
+{
+    auto queue         = ox::Event_queue{};
+    auto const current = ox::test::Current_queue{queue};
+
+    auto set = Leaderboard{};
+    for (auto i = 0; i < 5; ++i)
+        set.make_child(i * 10, i);
+
+    auto& row = *set.find_child(10);
+    row.score = 35;
+    CHECK(set.update_position(row));
+    using V = std::vector<std::pair<int, int>>;
+    CHECK(contents(set) == V{{0, 0}, {20, 2}, {30, 3}, {35, 1}, {40, 4}});
+
+    row.score = 20;  // Moves after the existing 20.
+    CHECK(set.update_position(row));
+    CHECK(contents(set) == V{{0, 0}, {20, 2}, {20, 1}, {30, 3}, {40, 4}});
+    check_invariants(set);
+
+    auto other = Row{0};
+    CHECK_FALSE(set.update_position(other));
+}
+
+TEST_CASE("Set stays sorted under random batches and updates", "[Set]")
+{
+    auto queue         = ox::Event_queue{};
+    auto const current = ox::test::Current_queue{queue};
+
+    auto gen   = std::mt19937{3};
+    auto score = std::uniform_int_distribution{0, 50};
+    auto set   = Leaderboard{};
+    auto next_id = 0;
+    for (auto round = 0; round < 50; ++round) {
+        auto batch = std::vector<std::unique_ptr<Row>>{};
+        for (auto i = 0u; i < gen() % 8; ++i)
+            batch.push_back(std::make_unique<Row>(score(gen), next_id++));
+        set.insert_children(std::move(batch));
+        set.make_child(score(gen), next_id++);
+
+        auto children = set.get_children();
+        auto& row     = children[gen() % children.size()];
+        row.score     = score(gen);
+        set.update_position(row);
+        check_invariants(set);
+    }
+    CHECK(set.child_count() > 50);
+}
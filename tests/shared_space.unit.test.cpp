@@ -0,0 +1,195 @@
+#include <cmath>
+#include <memory>
+#include <random>
+#include <vector>
+
+#include <catch2/catch.hpp>
+
+#include <termox/widget/area.hpp>
+#include <termox/widget/layouts/detail/layout_span.hpp>
+#include <termox/widget/layouts/detail/shared_space.hpp>
+#include <termox/widget/layouts/horizontal.hpp>
+#include <termox/widget/size_policy.hpp>
+#include <termox/widget/widget.hpp>
+
+namespace {
+
+using Parameters = ox::layout::h_detail::Horizontal_parameters;
+
+/// The iterative disperse/reclaim algorithm Shared_space used previously.
+/** Kept as the reference the closed-form solver is checked against. */
+class Reference_shared_space {
+   public:
+    [[nodiscard]] auto calculate_lengths(ox::Widget& parent) -> std::vector<int>
+    {
+        auto children = [&parent] {
+            auto const temp = parent.get_children();
+            return ox::layout::detail::Layout_span{
+                std::begin(temp), std::end(temp),
+                Parameters::Primary::get_length{}(parent),
+                [](ox::Widget const& w) -> ox::Size_policy const& {
+                    return Parameters::Primary::get_policy{}(w);
+                }};
+        }();
+        auto const difference =
+            Parameters::Primary::get_length{}(parent) - children.entire_length();
+        if (difference > 0)
+            disperse(children, difference);
+        else if (difference < 0)
+            reclaim(children, -1 * difference);
+        return children.get_results();
+    }
+
+   private:
+    template <typename Children_span>
+    static void disperse(Children_span& children, int surplus)
+    {
+        auto given_away = -1;
+        while (given_away != 0) {
+            given_away = 0;
+            for (auto iter = children.begin_max(); iter != children.end();
+                 ++iter) {
+                auto const& policy    = iter.get_policy();
+                auto const max_length = policy.max();
+                auto const stretch_ratio =
+                    policy.stretch() / children.total_stretch();
+                auto to_add = int(stretch_ratio * surplus);
+                if ((iter->length + to_add) > max_length)
+                    to_add = max_length - iter->length;
+                iter->length += to_add;
+                given_away += to_add;
+            }
+            surplus -= given_away;
+        }
+        while (children.size() != 0 && surplus != 0) {
+            for (auto iter = children.begin_max();
+                 iter != children.end() && surplus != 0; ++iter) {
+                iter->length += 1;
+                --surplus;
+            }
+        }
+    }
+
+    template <typename Children_span>
+    static void reclaim(Children_span& children, int deficit)
+    {
+        auto taken_back = -1;
+        while (taken_back != 0) {
+            taken_back = 0;
+            for (auto iter = children.begin_min(); iter != children.end();
+                 ++iter) {
+                auto const& policy    = iter.get_policy();
+                auto const min_length = policy.min();
+                auto const inverse_stretch_ratio =
+                    (1. / policy.stretch()) / children.total_inverse_stretch();
+                auto to_sub = static_cast<int>(inverse_stretch_ratio * deficit);
+                if ((iter->length - to_sub) < min_length)
+                    to_sub = iter->length - min_length;
+                iter->length -= to_sub;
+                taken_back += to_sub;
+            }
+            deficit -= taken_back;
+        }
+        while (children.size() != 0 && deficit != 0) {
+            for (auto iter = children.begin_min();
+                 iter != children.end() && deficit != 0; ++iter, --deficit) {
+                iter->length -= 1;
+            }
+        }
+    }
+};
+
+/// Return a valid Size_policy with random hint, min, max and stretch.
+[[nodiscard]] auto random_policy(std::mt19937& gen) -> ox::Size_policy
+{
+    auto const pick = [&gen](int low, int high) {
+        return std::uniform_int_distribution<int>{low, high}(gen);
+    };
+    auto const min     = pick(0, 8);
+    auto const hint    = min + pick(0, 12);
+    auto const max     = pick(0, 3) == 0 ? ox::Size_policy::maximum_max
+                                         : hint + pick(0, 20);
+    auto const stretch = std::uniform_real_distribution<double>{0.1, 5.}(gen);
+    return ox::Size_policy{hint, min, max, stretch, pick(0, 1) == 0};
+}
+
+/// Horizontal layout with \p count children of random width policies.
+[[nodiscard]] auto random_layout(std::mt19937& gen, int count)
+    -> std::unique_ptr<ox::layout::Horizontal<>>
+{
+    auto result = ox::layout::horizontal();
+    for (auto i = 0; i < count; ++i)
+        result->make_child().width_policy = random_policy(gen);
+    return result;
+}
+
+}  // namespace
+
+TEST_CASE("Shared_space matches iterative reference", "[Shared_space]")
+{
+    auto gen = std::mt19937{20210222};
+    for (auto run = 0; run < 5'000; ++run) {
+        auto const count =
+            std::uniform_int_distribution<int>{1, run % 10 == 0 ? 300 : 12}(gen);
+        auto const layout = random_layout(gen, count);
+        auto const length =
+            std::uniform_int_distribution<int>{0, count * 15}(gen);
+        layout->set_area({length, 1});
+
+        auto const expected =
+            Reference_shared_space{}.calculate_lengths(*layout);
+        auto const actual =
+            ox::layout::detail::Shared_space<Parameters>{}.calculate_lengths(
+                *layout);
+        INFO("run: " << run << ", children: " << count
+                     << ", length: " << length);
+        REQUIRE(actual == expected);
+    }
+}
+
+TEST_CASE("Shared_space matches reference with skewed stretch",
+          "[Shared_space]")
+{
+    // Each round fills only the few children with the largest stretch.
+    auto const layout = ox::layout::horizontal();
+    for (auto i = 0; i < 1'000; ++i) {
+        layout->make_child().width_policy =
+            ox::Size_policy{0, 0, 1 + i % 3, std::pow(1.5, i % 300), true};
+    }
+    for (auto length : {0, 10, 999, 1'500, 1'997, 2'500}) {
+        layout->set_area({length, 1});
+        auto const expected =
+            Reference_shared_space{}.calculate_lengths(*layout);
+        auto const actual =
+            ox::layout::detail::Shared_space<Parameters>{}.calculate_lengths(
+                *layout);
+        INFO("length: " << length);
+        CHECK(actual == expected);
+    }
+}
+
+TEST_CASE("Shared_space sums stretch in child order", "[Shared_space]")
+{
+    // 2^53 + 1 rounds back to 2^53, so the sum of the remaining stretch
+    // depends on the order it is added in. The last child fills in the first
+    // round, the second round must sum 1 + 2^53 + 1 + 1 left to right as the
+    // reference does, or the 2^53 child gets one cell less.
+    auto const layout = ox::layout::horizontal();
+    auto const add    = [&layout](int max, double stretch) {
+        layout->make_child().width_policy =
+            ox::Size_policy{0, 0, max, stretch, true};
+    };
+    add(10, 1.);
+    add(1'000, std::pow(2., 53));
+    add(10, 1.);
+    add(10, 1.);
+    add(5, std::pow(2., 60));
+    layout->set_area({50, 1});
+
+    auto const expected = Reference_shared_space{}.calculate_lengths(*layout);
+    auto const actual =
+        ox::layout::detail::Shared_space<Parameters>{}.calculate_lengths(
+            *layout);
+    CHECK(expected == std::vector<int>{0, 45, 0, 0, 5});
+    CHECK(actual == expected);
+}
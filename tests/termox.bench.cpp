@@ -0,0 +1,157 @@
+#include <atomic>
+#include <chrono>
+#include <clocale>
+#include <cstddef>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <memory>
+#include <new>
+#include <string>
+#include <utility>
+
+#include <termox/termox.hpp>
+
+#include "../demos/game_of_life/gol_widget.hpp"
+#include "../demos/game_of_life/patterns.hpp"
+#include "../demos/notepad/notepad.hpp"
+#include "current_queue.hpp"
+
+// Runs demo Widgets against a Headless_backend and prints one line per demo:
+// frames per second, bytes of escape sequences written per frame and heap
+// allocations per frame. A frame is one step of the demo followed by the
+// Event_queue::send_all() that the event loop would make, painting and
+// flushing included. System::run() is not used, its exit path ends the
+// process. Pass a frame count as the first argument, 500 by default.
+
+namespace {
+
+std::atomic<std::uint64_t> allocation_count = 0;
+
+auto constexpr screen_size = ox::Area{120, 40};
+
+struct Result {
+    double frames_per_second;
+    double bytes_per_frame;
+    double allocations_per_frame;
+};
+
+/// Make \p head the head Widget and run \p frames calls of \p step.
+/** The first send_all() lays out and paints the whole screen, it is not
+ *  measured. The screen's captured output is cleared after each frame, so
+ *  its buffer stops growing after the first, full screen, frame. */
+template <typename Step>
+[[nodiscard]] auto run_frames(ox::Event_queue& queue,
+                              ox::Widget& head,
+                              ox::Headless_backend& screen,
+                              int frames,
+                              Step&& step) -> Result
+{
+    ox::System::set_head(&head);
+    queue.send_all();
+    screen.clear_output();
+
+    auto const bytes_before       = screen.bytes_written();
+    auto const allocations_before = allocation_count.load();
+    auto const start              = std::chrono::steady_clock::now();
+    for (auto i = 0; i < frames; ++i) {
+        step(i);
+        queue.send_all();
+        screen.clear_output();
+    }
+    auto const elapsed = std::chrono::duration<double>(
+        std::chrono::steady_clock::now() - start);
+    auto const allocations = allocation_count.load() - allocations_before;
+    auto const bytes       = screen.bytes_written() - bytes_before;
+
+    ox::System::set_head(nullptr);
+    queue.send_all();
+    return {frames / elapsed.count(), (double)bytes / frames,
+            (double)allocations / frames};
+}
+
+void print(char const* name, int frames, Result const& r)
+{
+    std::printf("%-16s %8d %12.1f %12.1f %14.1f\n", name, frames,
+                r.frames_per_second, r.bytes_per_frame,
+                r.allocations_per_frame);
+}
+
+/// Full screen hi-res redraw of a growing pattern, one generation per frame.
+[[nodiscard]] auto game_of_life(ox::Event_queue& queue,
+                                ox::Headless_backend& screen,
+                                int frames) -> Result
+{
+    auto gol = gol::GoL_widget{};
+    gol.enable_hi_res();
+    gol.import_pattern(gol::pattern::r_pentomino);
+    return run_frames(queue, gol, screen, frames, [&](int) { gol.step(); });
+}
+
+/// Typing into the Notepad Textbox, one key per frame with a line break
+/// every 60 keys.
+[[nodiscard]] auto notepad(ox::Event_queue& queue,
+                           ox::Headless_backend& screen,
+                           int frames) -> Result
+{
+    auto pad      = demo::Notepad{};
+    auto& textbox = pad.txt_trait.text_and_scroll.textbox;
+    return run_frames(queue, pad, screen, frames, [&](int i) {
+        auto const key = i % 60 == 59 ? ox::Key::Enter
+                                      : static_cast<ox::Key>(U'a' + i % 26);
+        ox::System::post_event(ox::Key_press_event{textbox, key});
+    });
+}
+
+}  // namespace
+
+auto operator new(std::size_t size) -> void*
+{
+    ++allocation_count;
+    if (void* const p = std::malloc(size == 0 ? 1 : size); p != nullptr)
+        return p;
+    throw std::bad_alloc{};
+}
+
+auto operator new(std::size_t size, std::nothrow_t const&) noexcept -> void*
+{
+    ++allocation_count;
+    return std::malloc(size == 0 ? 1 : size);
+}
+
+void operator delete(void* p) noexcept { std::free(p); }
+
+void operator delete(void* p, std::size_t) noexcept { ::operator delete(p); }
+
+void operator delete(void* p, std::nothrow_t const&) noexcept
+{
+    ::operator delete(p);
+}
+
+auto main(int argc, char* argv[]) -> int
+{
+    std::setlocale(LC_ALL, "en_US.UTF-8");
+    auto const frames = argc > 1 ? std::atoi(argv[1]) : 500;
+    if (frames <= 0) {
+        std::fprintf(stderr, "usage: termox.bench [frames]\n");
+        return 1;
+    }
+
+    auto owned   = std::make_unique<ox::Headless_backend>(screen_size);
+    auto& screen = *owned;
+    ox::Terminal::handle_signint(false);
+    ox::Terminal::set_backend(std::move(owned));
+    ox::Terminal::initialize();
+
+    // Widgets post to the current queue from their constructors.
+    auto queue         = ox::Event_queue{};
+    auto const current = ox::test::Current_queue{queue};
+
+    std::printf("%-16s %8s %12s %12s %14s\n", "demo", "frames", "frames/sec",
+                "bytes/frame", "allocs/frame");
+    print("game_of_life", frames, game_of_life(queue, screen, frames));
+    print("notepad", frames, notepad(queue, screen, frames));
+
+    ox::Terminal::uninitialize();
+    return 0;
+}
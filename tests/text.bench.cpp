@@ -0,0 +1,89 @@
+#include <string>
+
+#include <catch2/catch.hpp>
+
+#include <termox/painter/brush.hpp>
+#include <termox/painter/color.hpp>
+#include <termox/painter/glyph_string.hpp>
+#include <termox/painter/painter.hpp>
+#include <termox/painter/trait.hpp>
+#include <termox/terminal/detail/canvas.hpp>
+#include <termox/widget/area.hpp>
+#include <termox/widget/widgets/label.hpp>
+#include <termox/widget/widgets/text_view.hpp>
+
+namespace {
+
+auto constexpr screen = ox::Area{200, 50};
+
+/// Exposes paint_event() so it can be called without an event loop.
+class Bench_label : public ox::HLabel {
+   public:
+    using ox::HLabel::Label;
+    using ox::HLabel::paint_event;
+};
+
+/// Exposes paint_event() so it can be called without an event loop.
+class Bench_text_view : public ox::Text_view {
+   public:
+    using Text_view::paint_event;
+    using Text_view::Text_view;
+    using Text_view::update_display;
+};
+
+/// Return \p count characters of lowercase text with spaces between words.
+[[nodiscard]] auto make_text(int count) -> std::u32string
+{
+    auto result = std::u32string{};
+    result.reserve(count);
+    for (auto i = 0; i < count; ++i)
+        result.push_back(i % 7 == 6 ? U' ' : U'a' + (i % 26));
+    return result;
+}
+
+}  // namespace
+
+TEST_CASE("Label Paint", "[Label][!benchmark]")
+{
+    auto canvas = ox::detail::Canvas{screen};
+    auto label  = Bench_label{ox::Glyph_string{make_text(screen.width),
+                                              fg(ox::Color::Green)}};
+    label.set_area({screen.width, 1});
+
+    BENCHMARK("Label paint_event default Brush [200 cells]")
+    {
+        auto p = ox::Painter{label, canvas};
+        return label.paint_event(p);
+    };
+
+    label.brush = ox::Brush{bg(ox::Color::Blue), ox::Trait::Bold};
+
+    BENCHMARK("Label paint_event Widget Brush [200 cells]")
+    {
+        auto p = ox::Painter{label, canvas};
+        return label.paint_event(p);
+    };
+}
+
+TEST_CASE("Text_view Paint", "[Text_view][!benchmark]")
+{
+    auto canvas = ox::detail::Canvas{screen};
+    auto view   = Bench_text_view{ox::Glyph_string{
+        make_text(screen.width * screen.height), ox::Trait::Italic}};
+    view.set_area(screen);
+    view.update_display();
+
+    BENCHMARK("Text_view paint_event default Brush [10000 cells]")
+    {
+        auto p = ox::Painter{view, canvas};
+        return view.paint_event(p);
+    };
+
+    view.brush = ox::Brush{bg(ox::Color::Blue), ox::Trait::Bold};
+
+    BENCHMARK("Text_view paint_event Widget Brush [10000 cells]")
+    {
+        auto p = ox::Painter{view, canvas};
+        return view.paint_event(p);
+    };
+}
@@ -0,0 +1,69 @@
+#include <algorithm>
+#include <cmath>
+#include <cstddef>
+#include <future>
+#include <thread>
+#include <vector>
+
+#include <catch2/catch.hpp>
+
+#include <termox/common/thread_pool.hpp>
+
+// One run is one frame of parallel work, split as the demos did before the
+// Thread_pool: hardware_concurrency() + 1 std::async tasks. A 60 FPS frame is
+// 16.7ms, divide the reported mean by that for the share of a frame spent on
+// scheduling. The empty runs measure overhead alone, the loaded runs add work
+// that is uneven across the index range.
+
+namespace {
+
+auto constexpr items = std::size_t{4'096};
+
+/// Work that grows with \p i, like rows near the set in a fractal.
+[[nodiscard]] auto work(std::size_t i, std::size_t scale) -> double
+{
+    auto sum = 0.;
+    for (auto k = std::size_t{0}; k < (i * scale) / items; ++k)
+        sum += std::sqrt((double)k);
+    return sum;
+}
+
+[[nodiscard]] auto run_async(std::size_t scale) -> double
+{
+    auto const task_count = std::thread::hardware_concurrency() + 1;
+    auto const chunk      = items / task_count + 1;
+    auto results          = std::vector<double>(items);
+    auto futures          = std::vector<std::future<void>>{};
+    for (auto first = std::size_t{0}; first < items; first += chunk) {
+        futures.push_back(std::async(std::launch::async, [&, first] {
+            for (auto i = first; i < std::min(first + chunk, items); ++i)
+                results[i] = work(i, scale);
+        }));
+    }
+    for (auto& f : futures)
+        f.get();
+    return results.back();
+}
+
+[[nodiscard]] auto run_pool(std::size_t scale) -> double
+{
+    auto results = std::vector<double>(items);
+    ox::shared_thread_pool().parallel_for(
+        0, items, [&](std::size_t i) { results[i] = work(i, scale); });
+    return results.back();
+}
+
+}  // namespace
+
+TEST_CASE("Thread_pool Frame Overhead", "[Thread_pool][!benchmark]")
+{
+    (void)run_pool(0);  // Start the shared pool outside of the measurement.
+
+    BENCHMARK("std::async fan-out empty frame") { return run_async(0); };
+    BENCHMARK("Thread_pool parallel_for empty frame") { return run_pool(0); };
+    BENCHMARK("std::async fan-out uneven frame") { return run_async(2'000); };
+    BENCHMARK("Thread_pool parallel_for uneven frame")
+    {
+        return run_pool(2'000);
+    };
+}
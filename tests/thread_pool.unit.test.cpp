@@ -0,0 +1,66 @@
+#include <termox/common/thread_pool.hpp>
+
+#include <algorithm>
+#include <atomic>
+#include <cstddef>
+#include <future>
+#include <stdexcept>
+#include <vector>
+
+#include <catch2/catch.hpp>
+
+TEST_CASE("Thread_pool::submit returns results and exceptions", "[Thread_pool]")
+{
+    auto pool = ox::Thread_pool{3};
+    CHECK(pool.thread_count() == 3);
+
+    auto results = std::vector<std::future<int>>{};
+    for (auto i = 0; i < 100; ++i)
+        results.push_back(pool.submit([i] { return i * i; }));
+    for (auto i = 0; i < 100; ++i)
+        CHECK(results[i].get() == i * i);
+
+    auto failed = pool.submit([]() -> int { throw std::runtime_error{"x"}; });
+    CHECK_THROWS_AS(failed.get(), std::runtime_error);
+}
+
+TEST_CASE("Thread_pool::parallel_for visits each index once", "[Thread_pool]")
+{
+    auto pool   = ox::Thread_pool{4};
+    auto counts = std::vector<std::atomic<int>>(10'007);
+    pool.parallel_for(7, counts.size(), [&](std::size_t i) { ++counts[i]; });
+    CHECK(std::all_of(std::cbegin(counts), std::cbegin(counts) + 7,
+                      [](auto const& c) { return c == 0; }));
+    CHECK(std::all_of(std::cbegin(counts) + 7, std::cend(counts),
+                      [](auto const& c) { return c == 1; }));
+
+    SECTION("with an explicit grain")
+    {
+        auto sum = std::atomic<std::size_t>{0};
+        pool.parallel_for(0, 1'000, [&](std::size_t i) { sum += i; }, 3);
+        CHECK(sum == 999 * 1'000 / 2);
+    }
+
+    SECTION("from within tasks, without deadlock")
+    {
+        auto sum   = std::atomic<std::size_t>{0};
+        auto tasks = std::vector<std::future<void>>{};
+        for (auto t = 0; t < 8; ++t) {
+            tasks.push_back(pool.submit([&] {
+                pool.parallel_for(0, 100, [&](std::size_t) { ++sum; }, 1);
+            }));
+        }
+        for (auto& t : tasks)
+            t.get();
+        CHECK(sum == 800);
+    }
+
+    SECTION("rethrows the first exception")
+    {
+        auto const f = [](std::size_t i) {
+            if (i == 500)
+                throw std::logic_error{"500"};
+        };
+        CHECK_THROWS_AS(pool.parallel_for(0, 1'000, f), std::logic_error);
+    }
+}
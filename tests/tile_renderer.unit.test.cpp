@@ -0,0 +1,203 @@
+#include "../demos/fractal/tile_renderer.hpp"
+
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <thread>
+#include <vector>
+
+#include <catch2/catch.hpp>
+
+#include <termox/painter/color.hpp>
+
+#include "../demos/fractal/julia.hpp"
+#include "../demos/fractal/mandelbrot.hpp"
+
+using fractal::Pixel_rect;
+using fractal::Scene;
+using fractal::Tile_renderer;
+
+namespace {
+
+// 96x64 pixels centered on the origin, at zoom level zero a pixel is 1/16 or
+// 1/24 wide, where float iteration gives the same counts as long double.
+auto constexpr view = Pixel_rect{-48, -32, 96, 64};
+
+[[nodiscard]] auto make_scene(fractal::Fractal type) -> Scene
+{
+    auto result        = Scene{};
+    result.type        = type;
+    result.julia_c     = {-0.8, 0.156};
+    result.width       = view.width;
+    result.height      = view.height;
+    result.color_count = 16;
+    return result;
+}
+
+/// Block until the last request() has finished.
+void wait_for(Tile_renderer const& renderer)
+{
+    while (renderer.is_busy())
+        std::this_thread::sleep_for(std::chrono::milliseconds{1});
+}
+
+[[nodiscard]] auto painted(Tile_renderer& renderer, int zoom, Pixel_rect v)
+    -> std::vector<ox::Color>
+{
+    auto result = std::vector<ox::Color>{};
+    renderer.paint_to(zoom, v, result);
+    return result;
+}
+
+/// Return the colors of \p v, each pixel iterated alone in long double.
+[[nodiscard]] auto reference(Tile_renderer const& renderer,
+                             Scene const& scene,
+                             int zoom,
+                             Pixel_rect v) -> std::vector<ox::Color>
+{
+    auto const size  = renderer.pixel_size(zoom);
+    auto const limit = renderer.max_iterations(zoom);
+    auto result      = std::vector<ox::Color>{};
+    for (auto y = v.top; y < v.top + v.height; ++y) {
+        for (auto x = v.left; x < v.left + v.width; ++x) {
+            auto const re = (fractal::Float_t)x * size.real();
+            auto const im = -(fractal::Float_t)y * size.imag();
+            auto const count =
+                scene.type == fractal::Fractal::Mandelbrot
+                    ? fractal::mandelbrot(re, im, limit)
+                    : fractal::julia(re, im, scene.julia_c, limit);
+            result.push_back(
+                ox::Color((count - 1) % scene.color_count + scene.first_color));
+        }
+    }
+    return result;
+}
+
+/// Return the pixels of \p v that are left of pixel column \p x.
+[[nodiscard]] auto left_of(std::vector<ox::Color> const& pixels,
+                           Pixel_rect v,
+                           std::int64_t x) -> std::vector<ox::Color>
+{
+    auto result = std::vector<ox::Color>{};
+    for (auto row = 0; row < v.height; ++row) {
+        for (auto column = 0; v.left + column < x; ++column)
+            result.push_back(pixels[(std::size_t)(row * v.width + column)]);
+    }
+    return result;
+}
+
+}  // namespace
+
+TEST_CASE("Tile_renderer paints the per-pixel reference", "[Tile_renderer]")
+{
+    auto const scene = make_scene(
+        GENERATE(fractal::Fractal::Mandelbrot, fractal::Fractal::Julia));
+    auto renderer    = Tile_renderer{};
+    renderer.set_scene(scene);
+
+    // Views are tiled from pixel 0, so this is 4 tiles across and 2 down.
+    renderer.request(0, view);
+    CHECK(renderer.tile_count() == 8);
+    wait_for(renderer);
+    CHECK(renderer.take_updates());
+    CHECK(painted(renderer, 0, view) == reference(renderer, scene, 0, view));
+
+    auto const zoomed = 20;
+    renderer.request(zoomed, view);
+    wait_for(renderer);
+    CHECK(painted(renderer, zoomed, view) ==
+          reference(renderer, scene, zoomed, view));
+}
+
+TEST_CASE("Tile_renderer pans by rendering only new tiles", "[Tile_renderer]")
+{
+    auto const scene = make_scene(fractal::Fractal::Mandelbrot);
+    auto renderer    = Tile_renderer{};
+    renderer.set_scene(scene);
+    renderer.request(0, view);
+    wait_for(renderer);
+
+    // Within the tiles already rendered, nothing is left to do.
+    auto const nudged = Pixel_rect{view.left + 5, view.top + 7, 80, 50};
+    renderer.request(0, nudged);
+    CHECK(renderer.tile_count() == 8);
+    CHECK_FALSE(renderer.is_busy());
+    CHECK(painted(renderer, 0, nudged) ==
+          reference(renderer, scene, 0, nudged));
+
+    // One tile column comes into view, the rest is painted from the cache
+    // before the new column is rendered.
+    auto const panned = Pixel_rect{view.left + 32, view.top, 96, 64};
+    renderer.request(0, panned);
+    CHECK(renderer.tile_count() == 10);
+    auto const expected = reference(renderer, scene, 0, panned);
+    CHECK(left_of(painted(renderer, 0, panned), panned, 64) ==
+          left_of(expected, panned, 64));
+    wait_for(renderer);
+    CHECK(painted(renderer, 0, panned) == expected);
+}
+
+TEST_CASE("Tile_renderer zooms into a new tile set and keeps the old",
+          "[Tile_renderer]")
+{
+    auto const scene = make_scene(fractal::Fractal::Mandelbrot);
+    auto renderer    = Tile_renderer{};
+    renderer.set_scene(scene);
+    renderer.request(0, view);
+    wait_for(renderer);
+    auto const at_zero = painted(renderer, 0, view);
+
+    renderer.request(3, view);
+    CHECK(renderer.tile_count() == 16);
+    CHECK(painted(renderer, 0, view) == at_zero);
+    wait_for(renderer);
+    CHECK(painted(renderer, 3, view) == reference(renderer, scene, 3, view));
+
+    renderer.request(0, view);
+    CHECK_FALSE(renderer.is_busy());
+    CHECK(painted(renderer, 0, view) == at_zero);
+}
+
+TEST_CASE("Tile_renderer drops every tile for a new scene", "[Tile_renderer]")
+{
+    auto scene    = make_scene(fractal::Fractal::Mandelbrot);
+    auto renderer = Tile_renderer{};
+    renderer.set_scene(scene);
+    renderer.request(0, view);
+    wait_for(renderer);
+
+    renderer.set_scene(scene);
+    CHECK(renderer.tile_count() == 8);
+
+    scene.color_count = 7;
+    renderer.set_scene(scene);
+    CHECK(renderer.tile_count() == 0);
+    CHECK(painted(renderer, 0, view) ==
+          std::vector<ox::Color>(view.width * view.height,
+                                 ox::Color::Background));
+    renderer.request(0, view);
+    wait_for(renderer);
+    CHECK(painted(renderer, 0, view) == reference(renderer, scene, 0, view));
+}
+
+TEST_CASE("Tile_renderer evicts the least recently requested tiles",
+          "[Tile_renderer]")
+{
+    auto const scene = make_scene(fractal::Fractal::Mandelbrot);
+    auto renderer    = Tile_renderer{10};
+    renderer.set_scene(scene);
+    renderer.request(0, view);
+    wait_for(renderer);
+
+    // 8 new tiles go over the limit of 10, tiles no longer visible are
+    // evicted.
+    auto const away = Pixel_rect{view.left + 512, view.top, 96, 64};
+    renderer.request(0, away);
+    CHECK(renderer.tile_count() == 8);
+    wait_for(renderer);
+
+    renderer.request(0, view);
+    CHECK(renderer.tile_count() == 8);
+    wait_for(renderer);
+    CHECK(painted(renderer, 0, view) == reference(renderer, scene, 0, view));
+}
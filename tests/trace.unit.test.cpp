@@ -0,0 +1,94 @@
+#include <termox/system/trace.hpp>
+
+#include <sstream>
+#include <string>
+#include <thread>
+
+#include <catch2/catch.hpp>
+
+using ox::Trace;
+
+namespace {
+
+/// Return the number of times \p x is found in \p s.
+[[nodiscard]] auto count(std::string const& s, std::string const& x) -> int
+{
+    auto result = 0;
+    for (auto at = s.find(x); at != std::string::npos; at = s.find(x, at + 1))
+        ++result;
+    return result;
+}
+
+[[nodiscard]] auto written() -> std::string
+{
+    auto ss = std::ostringstream{};
+    Trace::write(ss);
+    return ss.str();
+}
+
+}  // namespace
+
+#ifdef TERMOX_TRACE
+
+TEST_CASE("Trace writes spans as complete events", "[Trace]")
+{
+    Trace::clear();
+    {
+        auto const outer = ox::detail::Trace_span{"outer", "test"};
+        auto inner       = ox::detail::Trace_span{"inner", "test"};
+        inner.end();
+    }
+    auto const json = written();
+    CHECK(count(json, R"("ph":"X")") == 2);
+    CHECK(count(json, R"({"name":"outer","cat":"test")") == 1);
+    CHECK(count(json, R"({"name":"inner","cat":"test")") == 1);
+    CHECK(json.front() == '{');
+    CHECK(json.find("]}") != std::string::npos);
+
+    Trace::clear();
+    CHECK(count(written(), R"("ph":"X")") == 0);
+}
+
+TEST_CASE("Trace names threads and gives each its own id", "[Trace]")
+{
+    Trace::clear();
+    auto other = std::thread{[] {
+        Trace::set_thread_name("Traced thread");
+        Trace::set_thread_name("Traced thread");
+        auto const span = ox::detail::Trace_span{"on thread", "test"};
+    }};
+    other.join();
+    {
+        auto const span = ox::detail::Trace_span{"on main", "test"};
+    }
+
+    auto const json = written();
+    CHECK(count(json, R"("args":{"name":"Traced thread"})") == 1);
+    auto const tid = [&](std::string const& name) {
+        auto const at = json.find(R"("tid":)", json.find(name));
+        return json.substr(at, json.find(',', at) - at);
+    };
+    CHECK(tid("on thread") != tid("on main"));
+}
+
+TEST_CASE("Trace keeps only the most recent spans", "[Trace]")
+{
+    Trace::clear();
+    for (auto i = std::size_t{0}; i < Trace::capacity + 10; ++i)
+        ox::detail::Trace_span{"span", "test"}.end();
+    CHECK(count(written(), R"("ph":"X")") == (int)Trace::capacity);
+}
+
+#else
+
+TEST_CASE("Trace writes no spans when disabled", "[Trace]")
+{
+    {
+        auto const span = ox::detail::Trace_span{"span", "test"};
+    }
+    auto const json = written();
+    CHECK(count(json, R"("ph":"X")") == 0);
+    CHECK(count(json, R"("traceEvents":[)") == 1);
+}
+
+#endif  // TERMOX_TRACE
@@ -0,0 +1,130 @@
+#include <climits>
+#include <clocale>
+#include <cuchar>
+#include <cwchar>
+#include <string>
+
+#include <catch2/catch.hpp>
+
+#include <termox/common/utf8.hpp>
+
+// Benchmark names include the number of symbols converted per run, divide by
+// the reported mean to get symbols per second. The locale based baselines are
+// what mb_to_u32() and u32_to_mb() used before the UTF-8 fast path.
+
+namespace {
+
+auto constexpr count = 10'000;
+
+/// Return \p count symbols of mostly ASCII text, with one CJK symbol per 64.
+[[nodiscard]] auto make_ascii_heavy() -> std::u32string
+{
+    auto result = std::u32string{};
+    result.reserve(count);
+    for (auto i = 0; i < count; ++i)
+        result.push_back(i % 64 == 63 ? U'漢' : U'a' + (i % 26));
+    return result;
+}
+
+/// Return \p count symbols of CJK text.
+[[nodiscard]] auto make_cjk_heavy() -> std::u32string
+{
+    auto result = std::u32string{};
+    result.reserve(count);
+    for (auto i = 0; i < count; ++i)
+        result.push_back(U'\x4E00' + (i % 512));
+    return result;
+}
+
+[[nodiscard]] auto encode(std::u32string const& symbols) -> std::string
+{
+    auto result = std::string(symbols.size() * 4, '\0');
+    result.resize(ox::utf8_encode(symbols, result.data()));
+    return result;
+}
+
+/// mbrtoc32 loop, the locale dependent decoder.
+[[nodiscard]] auto locale_decode(std::string const& bytes) -> std::u32string
+{
+    auto result = std::u32string{};
+    result.reserve(bytes.size());
+    auto state = std::mbstate_t{};
+    auto c     = char32_t{};
+    for (auto i = std::size_t{0}; i < bytes.size();) {
+        auto const n =
+            std::mbrtoc32(&c, bytes.data() + i, bytes.size() - i, &state);
+        i += n;
+        result.push_back(c);
+    }
+    return result;
+}
+
+/// c32rtomb loop, the locale dependent encoder.
+[[nodiscard]] auto locale_encode(std::u32string const& symbols) -> std::string
+{
+    auto result = std::string{};
+    result.reserve(symbols.size() * 4);
+    auto state = std::mbstate_t{};
+    char buffer[MB_LEN_MAX];
+    for (char32_t c : symbols)
+        result.append(buffer, std::c32rtomb(buffer, c, &state));
+    return result;
+}
+
+}  // namespace
+
+TEST_CASE("UTF-8 Decode Throughput", "[utf8][!benchmark]")
+{
+    std::setlocale(LC_ALL, "en_US.UTF-8");
+    auto const ascii = encode(make_ascii_heavy());
+    auto const cjk   = encode(make_cjk_heavy());
+    auto out         = std::u32string(count, U'\0');
+
+    BENCHMARK("utf8_decode ascii heavy [10000 symbols]")
+    {
+        return ox::utf8_decode(ascii, out.data());
+    };
+
+    BENCHMARK("mbrtoc32 ascii heavy [10000 symbols]")
+    {
+        return locale_decode(ascii);
+    };
+
+    BENCHMARK("utf8_decode cjk heavy [10000 symbols]")
+    {
+        return ox::utf8_decode(cjk, out.data());
+    };
+
+    BENCHMARK("mbrtoc32 cjk heavy [10000 symbols]")
+    {
+        return locale_decode(cjk);
+    };
+}
+
+TEST_CASE("UTF-8 Encode Throughput", "[utf8][!benchmark]")
+{
+    std::setlocale(LC_ALL, "en_US.UTF-8");
+    auto const ascii = make_ascii_heavy();
+    auto const cjk   = make_cjk_heavy();
+    auto out         = std::string(count * 4, '\0');
+
+    BENCHMARK("utf8_encode ascii heavy [10000 symbols]")
+    {
+        return ox::utf8_encode(ascii, out.data());
+    };
+
+    BENCHMARK("c32rtomb ascii heavy [10000 symbols]")
+    {
+        return locale_encode(ascii);
+    };
+
+    BENCHMARK("utf8_encode cjk heavy [10000 symbols]")
+    {
+        return ox::utf8_encode(cjk, out.data());
+    };
+
+    BENCHMARK("c32rtomb cjk heavy [10000 symbols]")
+    {
+        return locale_encode(cjk);
+    };
+}
@@ -0,0 +1,116 @@
+#include <clocale>
+#include <stdexcept>
+#include <string>
+#include <string_view>
+
+#include <catch2/catch.hpp>
+
+#include <termox/common/mb_to_u32.hpp>
+#include <termox/common/u32_to_mb.hpp>
+#include <termox/common/utf8.hpp>
+
+namespace {
+
+void init() { std::setlocale(LC_ALL, "en_US.UTF-8"); }
+
+[[nodiscard]] auto decode(std::string_view bytes) -> std::u32string
+{
+    auto result = std::u32string(bytes.size(), U'\0');
+    result.resize(ox::utf8_decode(bytes, result.data()));
+    return result;
+}
+
+[[nodiscard]] auto encode(std::u32string_view symbols) -> std::string
+{
+    auto result = std::string(symbols.size() * 4, '\0');
+    result.resize(ox::utf8_encode(symbols, result.data()));
+    return result;
+}
+
+}  // namespace
+
+TEST_CASE("UTF-8 round trip", "[utf8]")
+{
+    init();
+    CHECK(ox::is_utf8_locale());
+
+    auto const ascii = std::string{"The quick brown fox jumps over the dog."};
+    CHECK(decode(ascii) == U"The quick brown fox jumps over the dog.");
+    CHECK(encode(decode(ascii)) == ascii);
+
+    auto const mixed = std::string{"hello,ӵ World!🌎~ 漢字かな交じり文 ok"};
+    CHECK(decode(mixed) == U"hello,ӵ World!🌎~ 漢字かな交じり文 ok");
+    CHECK(encode(decode(mixed)) == mixed);
+
+    CHECK(decode("") == U"");
+    CHECK(encode(U"") == "");
+
+    // Boundaries of each encoded length.
+    auto const edges = std::u32string{U'\x7F', U'\x80', U'\x7FF', U'\x800',
+                                      U'\xFFFF', U'\x10000', U'\x10FFFF'};
+    CHECK(decode(encode(edges)) == edges);
+    CHECK(encode(edges).size() == 1 + 2 + 2 + 3 + 3 + 4 + 4);
+}
+
+TEST_CASE("UTF-8 matches locale conversion", "[utf8]")
+{
+    init();
+    auto const text = std::string{"Ɣѝ₪⌛aǺӜ🥬▚😳ㅎꂆ plain ascii text"};
+    CHECK(ox::mb_to_u32(text) == U"Ɣѝ₪⌛aǺӜ🥬▚😳ㅎꂆ plain ascii text");
+    CHECK(ox::u32_to_mb(ox::mb_to_u32(text)) == text);
+    CHECK(ox::u32_to_mb(U'🌎') == "🌎");
+}
+
+TEST_CASE("UTF-8 rejects invalid input", "[utf8]")
+{
+    char32_t out[8];
+    char bytes[4];
+
+    // Lone continuation byte.
+    CHECK_THROWS_AS(ox::utf8_decode("\x80", out), std::runtime_error);
+    // Truncated sequence.
+    CHECK_THROWS_AS(ox::utf8_decode("\xE6\xBC", out), std::runtime_error);
+    // Overlong encoding of '/'.
+    CHECK_THROWS_AS(ox::utf8_decode("\xC0\xAF", out), std::runtime_error);
+    // Encoded surrogate.
+    CHECK_THROWS_AS(ox::utf8_decode("\xED\xA0\x80", out), std::runtime_error);
+    // Larger than U+10FFFF.
+    CHECK_THROWS_AS(ox::utf8_decode("\xF4\x90\x80\x80", out),
+                    std::runtime_error);
+    // Invalid lead byte.
+    CHECK_THROWS_AS(ox::utf8_decode("\xFF", out), std::runtime_error);
+
+    CHECK_THROWS_AS(ox::utf8_encode(char32_t{0xD800}, bytes),
+                    std::runtime_error);
+    CHECK_THROWS_AS(ox::utf8_encode(char32_t{0x110000}, bytes),
+                    std::runtime_error);
+}
+
+TEST_CASE("utf8_encode_lossy replaces invalid code points", "[utf8]")
+{
+    char bytes[4];
+    auto const lossy = [&](char32_t symbol) {
+        return std::string(bytes, ox::utf8_encode_lossy(symbol, bytes));
+    };
+    CHECK(lossy(U'a') == "a");
+    CHECK(lossy(U'🌎') == "🌎");
+    CHECK(lossy(U'\x10FFFF') == "\xF4\x8F\xBF\xBF");
+    CHECK(lossy(char32_t{0xD800}) == "\xEF\xBF\xBD");
+    CHECK(lossy(char32_t{0xDFFF}) == "\xEF\xBF\xBD");
+    CHECK(lossy(char32_t{0x110000}) == "\xEF\xBF\xBD");
+    CHECK(lossy(char32_t{0xFFFFFFFF}) == "\xEF\xBF\xBD");
+}
+
+TEST_CASE("is_utf8_locale follows setlocale", "[utf8]")
+{
+    init();
+    CHECK(ox::is_utf8_locale());
+    CHECK(ox::mb_to_u32("🌎") == U"🌎");
+
+    std::setlocale(LC_ALL, "C");
+    CHECK_FALSE(ox::is_utf8_locale());
+
+    init();
+    CHECK(ox::is_utf8_locale());
+    CHECK(ox::u32_to_mb(U"🌎") == "🌎");
+}
@@ -0,0 +1,113 @@
+#include <memory>
+#include <vector>
+
+#include <catch2/catch.hpp>
+
+#include <termox/system/detail/focus.hpp>
+#include <termox/system/event.hpp>
+#include <termox/system/event_queue.hpp>
+#include <termox/system/system.hpp>
+#include <termox/widget/focus_policy.hpp>
+#include <termox/widget/layouts/horizontal.hpp>
+#include <termox/widget/layouts/vertical.hpp>
+#include <termox/widget/widget.hpp>
+#include <termox/widget/widget_arena.hpp>
+
+#include "current_queue.hpp"
+
+// Construction runs build a tree of layouts 4 deep with 21 children each,
+// 204205 Widgets in total, then destroy it. Traversal runs use a tree 6 deep
+// with 6 children each, 55987 Widgets. Posted events are discarded unsent.
+
+namespace {
+
+/// Build alternating Vertical/Horizontal layouts \p depth levels deep.
+[[nodiscard]] auto make_tree(int depth, int fanout, bool vertical = true)
+    -> std::unique_ptr<ox::Widget>
+{
+    if (depth == 0)
+        return std::make_unique<ox::Widget>();
+    auto build = [&](auto& layout) {
+        for (auto i = 0; i < fanout; ++i)
+            layout.append_child(make_tree(depth - 1, fanout, !vertical));
+    };
+    if (vertical) {
+        auto v = ox::layout::vertical();
+        build(*v);
+        return v;
+    }
+    auto h = ox::layout::horizontal();
+    build(*h);
+    return h;
+}
+
+/// Enable every Widget in the tree, with every 997th Widget tab focusable.
+void prepare_focus(ox::Widget& root)
+{
+    root.enable();
+    auto i = 0;
+    root.for_each_descendant([&i](ox::Widget& w) {
+        w.enable();
+        if (++i % 997 == 0)
+            w.focus_policy = ox::Focus_policy::Tab;
+    });
+}
+
+/// Build and destroy the tree, with a fresh Event_queue for posted events.
+auto build_and_destroy() -> std::size_t
+{
+    auto queue         = ox::Event_queue{};
+    auto const current = ox::test::Current_queue{queue};
+    return make_tree(4, 21)->child_count();
+}
+
+}  // namespace
+
+TEST_CASE("Widget Tree Construction", "[Widget][!benchmark]")
+{
+    BENCHMARK("make_unique [204205 widgets]") { return build_and_destroy(); };
+
+    auto arena = ox::Widget_arena{};
+    BENCHMARK("Widget_arena [204205 widgets]")
+    {
+        return arena.build(build_and_destroy);
+    };
+}
+
+TEST_CASE("Widget Tree Traversal", "[Widget][!benchmark]")
+{
+    static auto queue  = ox::Event_queue{};
+    auto const current = ox::test::Current_queue{queue};
+
+    BENCHMARK_ADVANCED("Delete_event [55987 widgets]")
+    (Catch::Benchmark::Chronometer meter)
+    {
+        auto trees = std::vector<std::unique_ptr<ox::Widget>>{};
+        {
+            auto build_queue    = ox::Event_queue{};
+            auto const building = ox::test::Current_queue{build_queue};
+            for (auto i = 0; i < meter.runs(); ++i)
+                trees.push_back(make_tree(6, 6));
+        }
+        meter.measure([&](int i) {
+            return ox::System::send_event(ox::Delete_event{std::move(trees[i])});
+        });
+    };
+
+    auto tree = make_tree(6, 6);
+    prepare_focus(*tree);
+    ox::System::set_head(tree.get());
+
+    BENCHMARK("Tab [55987 widgets]")
+    {
+        return ox::detail::Focus::tab_press();
+    };
+
+    BENCHMARK("Shift Tab [55987 widgets]")
+    {
+        return ox::detail::Focus::shift_tab_press();
+    };
+
+    ox::System::set_head(nullptr);
+    ox::detail::Focus::clear_without_posting_event();
+}
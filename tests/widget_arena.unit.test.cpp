@@ -0,0 +1,125 @@
+#include <memory>
+#include <vector>
+
+#include <catch2/catch.hpp>
+
+#include <termox/system/event.hpp>
+#include <termox/system/event_queue.hpp>
+#include <termox/widget/layouts/vertical.hpp>
+#include <termox/widget/widget.hpp>
+#include <termox/widget/widget_arena.hpp>
+
+#include "current_queue.hpp"
+
+TEST_CASE("Widgets are allocated from the arena during build()", "[Widget]")
+{
+    auto arena   = ox::Widget_arena{1'024};
+    auto widgets = std::vector<std::unique_ptr<ox::Widget>>{};
+    arena.build([&] {
+        for (auto i = 0; i < 10; ++i)
+            widgets.push_back(std::make_unique<ox::Widget>());
+    });
+    auto const outside = std::make_unique<ox::Widget>();
+
+    CHECK(arena.live_count() == 10);
+    CHECK(arena.reserved_bytes() >= 10 * sizeof(ox::Widget));
+    CHECK(widgets[0]->unique_id() != widgets[1]->unique_id());
+
+    widgets.pop_back();
+    CHECK(arena.live_count() == 9);
+    widgets.clear();
+    CHECK(arena.live_count() == 0);
+
+    // Blocks are reused once the arena is empty.
+    auto const reserved = arena.reserved_bytes();
+    auto const count    = arena.build([&] {
+        for (auto i = 0; i < 10; ++i)
+            widgets.push_back(std::make_unique<ox::Widget>());
+        return widgets.size();
+    });
+    CHECK(count == 10);
+    CHECK(arena.reserved_bytes() == reserved);
+}
+
+TEST_CASE("Nested Widget_arena builds use the innermost arena", "[Widget]")
+{
+    auto outer   = ox::Widget_arena{};
+    auto inner   = ox::Widget_arena{};
+    auto widgets = std::vector<std::unique_ptr<ox::Widget>>{};
+    outer.build([&] {
+        widgets.push_back(std::make_unique<ox::Widget>());
+        inner.build([&] { widgets.push_back(std::make_unique<ox::Widget>()); });
+        widgets.push_back(std::make_unique<ox::Widget>());
+    });
+    CHECK(outer.live_count() == 2);
+    CHECK(inner.live_count() == 1);
+}
+
+TEST_CASE("Widgets can outlive their Widget_arena", "[Widget]")
+{
+    auto w = std::unique_ptr<ox::Widget>{};
+    {
+        auto arena = ox::Widget_arena{};
+        w          = arena.build([] { return std::make_unique<ox::Widget>(); });
+    }
+    w->set_name("still alive");
+    CHECK(w->name() == "still alive");
+}
+
+TEST_CASE("Widget_arena memory is not reused while any Widget is alive",
+          "[Widget]")
+{
+    auto queue         = ox::Event_queue{};
+    auto const current = ox::test::Current_queue{queue};
+
+    // A list that stays up and replaces its 20 rows on each refresh.
+    auto arena      = ox::Widget_arena{4 * 1'024};
+    auto list       = arena.build([] { return ox::layout::vertical(); });
+    auto const fill = [&list] {
+        for (auto i = 0; i < 20; ++i)
+            list->make_child();
+    };
+    auto const clear = [&list] {
+        while (list->child_count() > 0)
+            list->remove_child_at(0).reset();
+    };
+
+    // Rows built in the arena are freed, but their memory is not reused while
+    // the list is alive, each refresh reserves more.
+    for (auto i = 0; i < 100; ++i) {
+        clear();
+        arena.build(fill);
+    }
+    CHECK(arena.live_count() == 21);
+    CHECK(arena.reserved_bytes() >= 100 * 20 * sizeof(ox::Widget));
+
+    // Rows built outside of build() use the heap, the arena does not grow.
+    clear();
+    auto const reserved = arena.reserved_bytes();
+    for (auto i = 0; i < 100; ++i) {
+        clear();
+        fill();
+    }
+    CHECK(arena.live_count() == 1);
+    CHECK(arena.reserved_bytes() == reserved);
+
+    // Once nothing from the arena is alive its memory is reused.
+    clear();
+    list.reset();
+    CHECK(arena.live_count() == 0);
+    list = arena.build([] { return ox::layout::vertical(); });
+    arena.build(fill);
+    CHECK(arena.reserved_bytes() == reserved);
+}
+
+TEST_CASE("Widget unique IDs do not wrap at 16 bits", "[Widget]")
+{
+    auto arena = ox::Widget_arena{};
+    arena.build([] {
+        auto const first = std::make_unique<ox::Widget>();
+        for (auto i = 0; i < 70'000; ++i)
+            (void)std::make_unique<ox::Widget>();
+        auto const last = std::make_unique<ox::Widget>();
+        CHECK(last->unique_id() - first->unique_id() == 70'001);
+    });
+}
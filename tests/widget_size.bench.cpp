@@ -0,0 +1,119 @@
+#include <atomic>
+#include <cstddef>
+#include <cstdio>
+#include <cstdlib>
+#include <memory>
+#include <new>
+#include <vector>
+
+#include <signals_light/signal.hpp>
+
+#include <termox/system/event_queue.hpp>
+#include <termox/system/system.hpp>
+#include <termox/widget/area.hpp>
+#include <termox/widget/layouts/vertical.hpp>
+#include <termox/widget/widget.hpp>
+#include <termox/widget/widgets/button.hpp>
+#include <termox/widget/widgets/checkbox.hpp>
+#include <termox/widget/widgets/label.hpp>
+
+// Prints sizeof and the heap use of each constructed Widget, for the common
+// Widget types. Heap use is counted by replacing the global operator new, and
+// is measured twice: with nothing connected, and with one Slot connected to
+// resized. Only API that predates Lazy_signal is used, so the same program can
+// be built on either side of that change to compare the two. Events posted by
+// constructors are left in the Event_queue, their heap use is included.
+
+namespace {
+
+std::atomic<std::size_t> allocation_count = 0;
+std::atomic<std::size_t> allocation_bytes = 0;
+
+auto constexpr instances = 1'000;
+
+struct Heap_use {
+    double allocations;
+    double bytes;
+};
+
+/// Construct \p instances Widgets with \p make and return the heap use of each.
+/** If \p connect is true, a Slot is connected to each Widget's resized
+ *  Signal. The Widgets are destroyed before this returns. */
+template <typename Make>
+[[nodiscard]] auto measure(Make&& make, bool connect) -> Heap_use
+{
+    using Widget_ptr = decltype(make());
+    auto widgets     = std::vector<Widget_ptr>{};
+    widgets.reserve(instances);
+
+    auto const count_before = allocation_count.load();
+    auto const bytes_before = allocation_bytes.load();
+    for (auto i = 0; i < instances; ++i) {
+        widgets.push_back(make());
+        if (connect)
+            widgets.back()->resized.connect([](ox::Area, ox::Area) {});
+    }
+    auto const count = allocation_count.load() - count_before;
+    auto const bytes = allocation_bytes.load() - bytes_before;
+    return {(double)count / instances, (double)bytes / instances};
+}
+
+template <typename Widget_t, typename Make>
+void print(char const* name, Make&& make)
+{
+    auto const unconnected = measure(make, false);
+    auto const connected   = measure(make, true);
+    std::printf("%-20s %8zu %12.1f %12.1f %12.1f %12.1f\n", name,
+                sizeof(Widget_t), unconnected.allocations, unconnected.bytes,
+                connected.allocations, connected.bytes);
+}
+
+}  // namespace
+
+auto operator new(std::size_t size) -> void*
+{
+    ++allocation_count;
+    allocation_bytes += size;
+    if (void* const p = std::malloc(size == 0 ? 1 : size); p != nullptr)
+        return p;
+    throw std::bad_alloc{};
+}
+
+auto operator new(std::size_t size, std::nothrow_t const&) noexcept -> void*
+{
+    ++allocation_count;
+    allocation_bytes += size;
+    return std::malloc(size == 0 ? 1 : size);
+}
+
+void operator delete(void* p) noexcept { std::free(p); }
+
+void operator delete(void* p, std::size_t) noexcept { ::operator delete(p); }
+
+void operator delete(void* p, std::nothrow_t const&) noexcept
+{
+    ::operator delete(p);
+}
+
+auto main() -> int
+{
+    auto queue = ox::Event_queue{};
+    ox::System::set_current_queue(queue);
+
+    std::printf("sizeof(sl::Signal<void(ox::Area, ox::Area)>) = %zu\n\n",
+                sizeof(sl::Signal<void(ox::Area, ox::Area)>));
+    std::printf("%-20s %8s %12s %12s %12s %12s\n", "type", "sizeof", "allocs",
+                "heap bytes", "allocs+slot", "bytes+slot");
+    print<ox::Widget>("Widget", [] { return std::make_unique<ox::Widget>(); });
+    print<ox::HLabel>("HLabel", [] {
+        return std::make_unique<ox::HLabel>(ox::HLabel::Parameters{U"Label"});
+    });
+    print<ox::Button>("Button",
+                      [] { return std::make_unique<ox::Button>(U"Button"); });
+    print<ox::HCheckbox>("HCheckbox", [] {
+        return std::make_unique<ox::HCheckbox>(ox::HCheckbox::Parameters{});
+    });
+    print<ox::layout::Vertical<>>("layout::Vertical<>",
+                                  [] { return ox::layout::vertical(); });
+    return 0;
+}
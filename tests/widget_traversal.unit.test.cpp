@@ -0,0 +1,130 @@
+#include <algorithm>
+#include <iterator>
+#include <memory>
+#include <random>
+#include <vector>
+
+#include <catch2/catch.hpp>
+
+#include <termox/system/detail/focus.hpp>
+#include <termox/system/event_queue.hpp>
+#include <termox/system/system.hpp>
+#include <termox/widget/focus_policy.hpp>
+#include <termox/widget/layouts/horizontal.hpp>
+#include <termox/widget/layouts/vertical.hpp>
+#include <termox/widget/widget.hpp>
+
+#include "current_queue.hpp"
+
+namespace {
+
+/// Random tree of Vertical layouts, with random focus policies and states.
+[[nodiscard]] auto make_random_tree(std::mt19937& gen, int depth)
+    -> std::unique_ptr<ox::Widget>
+{
+    auto const policies =
+        std::array{ox::Focus_policy::None, ox::Focus_policy::Tab,
+                   ox::Focus_policy::Click, ox::Focus_policy::Strong};
+    auto result = std::unique_ptr<ox::Widget>{};
+    if (depth == 0 || gen() % 4 == 0)
+        result = std::make_unique<ox::Widget>();
+    else {
+        auto layout      = ox::layout::vertical();
+        auto const count = gen() % 5;
+        for (auto i = 0u; i < count; ++i)
+            layout->append_child(make_random_tree(gen, depth - 1));
+        result = std::move(layout);
+    }
+    result->focus_policy = policies[gen() % policies.size()];
+    return result;
+}
+
+/// Previous get_descendants() based implementation of tab focus.
+auto reference_tab_focus(bool forward) -> ox::Widget*
+{
+    auto const is_tab_focusable = [](ox::Widget const* w) {
+        return w->is_enabled() && (w->focus_policy == ox::Focus_policy::Tab ||
+                                   w->focus_policy == ox::Focus_policy::Strong);
+    };
+    auto* const head = ox::System::head();
+    auto tree        = head->get_descendants();
+    tree.insert(std::begin(tree), head);
+    auto* const focus = ox::detail::Focus::focus_widget();
+    auto const iter   = std::find(std::begin(tree), std::end(tree), focus);
+    if (focus != nullptr && iter != std::end(tree))
+        std::rotate(std::begin(tree), iter, std::end(tree));
+    if (forward) {
+        auto const next = std::find_if(std::next(std::begin(tree)),
+                                       std::end(tree), is_tab_focusable);
+        return next != std::end(tree) ? *next : focus;
+    }
+    auto const previous =
+        std::find_if(std::rbegin(tree), std::rend(tree), is_tab_focusable);
+    return previous != std::rend(tree) ? *previous : focus;
+}
+
+}  // namespace
+
+TEST_CASE("for_each_descendant visits in pre and post order", "[Widget]")
+{
+    auto queue         = ox::Event_queue{};
+    auto const current = ox::test::Current_queue{queue};
+
+    auto root = ox::layout::vertical();
+    auto& a   = root->make_child<ox::layout::Horizontal<>>();
+    auto& a1  = a.make_child();
+    auto& a2  = a.make_child();
+    auto& b   = root->make_child();
+
+    auto pre = std::vector<ox::Widget*>{};
+    CHECK(root->for_each_descendant([&](ox::Widget& w) { pre.push_back(&w); }));
+    CHECK(pre == std::vector<ox::Widget*>{&a, &a1, &a2, &b});
+    CHECK(pre == root->get_descendants());
+
+    auto post = std::vector<ox::Widget*>{};
+    root->for_each_descendant_post_order(
+        [&](ox::Widget& w) { post.push_back(&w); });
+    CHECK(post == std::vector<ox::Widget*>{&a1, &a2, &a, &b});
+
+    // Returning false stops the traversal.
+    auto visited = 0;
+    CHECK_FALSE(root->for_each_descendant([&](ox::Widget& w) {
+        ++visited;
+        return &w != &a1;
+    }));
+    CHECK(visited == 2);
+
+    CHECK(root->contains_descendant(&a2));
+    CHECK_FALSE(a.contains_descendant(&b));
+    CHECK_FALSE(root->contains_descendant(root.get()));
+}
+
+TEST_CASE("Tab focus order matches the rotated pre-order tree", "[Widget]")
+{
+    auto queue         = ox::Event_queue{};
+    auto const current = ox::test::Current_queue{queue};
+    auto gen = std::mt19937{7};
+    for (auto trial = 0; trial < 200; ++trial) {
+        auto root  = make_random_tree(gen, 4);
+        auto nodes = root->get_descendants();
+        nodes.insert(std::begin(nodes), root.get());
+        for (auto* w : nodes)
+            w->enable(gen() % 3 != 0);
+        ox::System::set_head(root.get());
+
+        for (auto* start : nodes) {
+            for (auto forward : {true, false}) {
+                ox::detail::Focus::clear_without_posting_event();
+                ox::detail::Focus::set(*start);
+                auto* const expected = reference_tab_focus(forward);
+                if (forward)
+                    ox::detail::Focus::tab_press();
+                else
+                    ox::detail::Focus::shift_tab_press();
+                CHECK(ox::detail::Focus::focus_widget() == expected);
+            }
+        }
+        ox::System::set_head(nullptr);
+        ox::detail::Focus::clear_without_posting_event();
+    }
+}